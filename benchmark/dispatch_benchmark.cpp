@@ -0,0 +1,61 @@
+#include <benchmark/benchmark.h>
+
+#include <sstream>
+#include <string>
+
+#include "comlint/command_line_interface.hpp"
+
+using namespace comlint;
+
+static char kProgramName[] = "program";
+static char kCommand[] = "command_500";
+
+class CountingCommandHandler : public CommandHandlerInterface
+{
+public:
+    void Run(const ParsedCommand&) override
+    {
+        num_of_runs_++;
+    }
+
+private:
+    unsigned int num_of_runs_ {0U};
+};
+
+/**
+ * @brief Runs one of a thousand commands, whose handler is added by the given function.
+ */
+template <typename AddHandler>
+static void DispatchCommand(benchmark::State &state, AddHandler add_handler)
+{
+    char* argv[] = {kProgramName, kCommand};
+    CommandLineInterface cli(2, argv);
+    std::ostringstream stream {};
+    OutputSink output(stream);
+
+    for (unsigned int i = 0U; i < 1000U; i++) {
+        cli.AddCommand("command_" + std::to_string(i), "Command");
+    }
+
+    add_handler(cli);
+
+    for (auto _ : state) {
+        cli.Run(output);
+    }
+}
+
+static void BM_DispatchHandlerObject(benchmark::State &state)
+{
+    DispatchCommand(state, [](CommandLineInterface &cli) { cli.AddCommandHandler("command_500", std::make_shared<CountingCommandHandler>()); });
+}
+
+static void BM_DispatchLambda(benchmark::State &state)
+{
+    unsigned int num_of_runs = 0U;
+
+    DispatchCommand(state, [&](CommandLineInterface &cli) { cli.AddCommandHandler("command_500", [&](const ParsedCommand&) { num_of_runs++; }); });
+    benchmark::DoNotOptimize(num_of_runs);
+}
+
+BENCHMARK(BM_DispatchHandlerObject);
+BENCHMARK(BM_DispatchLambda);
\ No newline at end of file
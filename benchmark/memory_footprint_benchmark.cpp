@@ -0,0 +1,69 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include "comlint/command_line_interface.hpp"
+
+using namespace comlint;
+
+static char kProgramName[] = "program";
+static char* kArgv[] = {kProgramName};
+
+/**
+ * @brief Declares synthetic interface with the given number of commands, each of which allows a few of the options and flags.
+ */
+static void AddSyntheticInterface(CommandLineInterface &cli, const unsigned int num_of_elements)
+{
+    for (unsigned int i = 0U; i < num_of_elements; ++i) {
+        const std::string index = std::to_string(i);
+        cli.AddOption("-option_" + index, "Description of the synthetic option number " + index, {"first_value_" + index, "second_value_" + index},
+                      "", "first_value_" + index);
+        cli.AddFlag("--flag_" + index, "Description of the synthetic flag number " + index);
+    }
+    for (unsigned int i = 0U; i < num_of_elements; ++i) {
+        const std::string index = std::to_string(i);
+        const std::string next_index = std::to_string((i + 1U) % num_of_elements);
+        cli.AddCommand("command_" + index, "Description of the synthetic command number " + index, {"-option_" + index, "-option_" + next_index},
+                       {"--flag_" + index, "--flag_" + next_index});
+    }
+}
+
+static void BM_DeclaredInterfaceFootprint(benchmark::State &state)
+{
+    const auto num_of_elements = static_cast<unsigned int>(state.range(0));
+    MemoryFootprint footprint {};
+
+    for (auto _ : state) {
+        CommandLineInterface cli(1, kArgv);
+        AddSyntheticInterface(cli, num_of_elements);
+        footprint = cli.GetMemoryFootprint();
+        benchmark::DoNotOptimize(footprint);
+    }
+
+    state.counters["bytes"] = static_cast<double>(footprint.GetTotal());
+    state.counters["bytes_per_element"] = static_cast<double>(footprint.GetTotal()) / (3.0 * num_of_elements);
+    state.counters["lookup_indexes"] = static_cast<double>(footprint.lookup_indexes);
+}
+
+static void BM_CompiledInterfaceFootprint(benchmark::State &state)
+{
+    const auto num_of_elements = static_cast<unsigned int>(state.range(0));
+    CommandLineInterface cli(1, kArgv);
+    MemoryFootprint footprint {};
+
+    AddSyntheticInterface(cli, num_of_elements);
+    cli.SetHelp("Synthetic help prompt");
+
+    for (auto _ : state) {
+        const CompiledInterface compiled_interface = cli.Compile();
+        footprint = compiled_interface.GetMemoryFootprint();
+        benchmark::DoNotOptimize(footprint);
+    }
+
+    state.counters["bytes"] = static_cast<double>(footprint.GetTotal());
+    state.counters["bytes_per_element"] = static_cast<double>(footprint.GetTotal()) / (3.0 * num_of_elements);
+    state.counters["lookup_indexes"] = static_cast<double>(footprint.lookup_indexes);
+}
+
+BENCHMARK(BM_DeclaredInterfaceFootprint)->RangeMultiplier(10)->Range(10, 10000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_CompiledInterfaceFootprint)->RangeMultiplier(10)->Range(10, 10000)->Unit(benchmark::kMillisecond);
\ No newline at end of file
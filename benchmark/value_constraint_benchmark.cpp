@@ -0,0 +1,76 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include "comlint/command_line_interface.hpp"
+
+using namespace comlint;
+
+static char kProgramName[] = "program";
+static char kCommand[] = "serve";
+static char kOption[] = "-port";
+
+static OptionValues GetAllPorts()
+{
+    OptionValues ports {};
+
+    for (unsigned int port = 1U; port <= 65535U; port++) {
+        ports.push_back(std::to_string(port));
+    }
+
+    return ports;
+}
+
+/**
+ * @brief Parses "serve -port <port>" with the given way of restricting the port. Ports near the end of the range are the worst case of
+ *        the enumeration, which is searched linearly.
+ */
+template <typename RestrictPort>
+static void ParsePort(benchmark::State &state, RestrictPort restrict_port)
+{
+    char port[] = "65000";
+    char* argv[] = {kProgramName, kCommand, kOption, port};
+    CommandLineInterface cli(4, argv);
+
+    cli.AddCommand("serve", "Start the server", {"-port"});
+    restrict_port(cli);
+
+    const CompiledInterface compiled_interface = cli.Compile();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(compiled_interface.Parse(4, argv));
+    }
+}
+
+static void BM_PortEnumeration(benchmark::State &state)
+{
+    ParsePort(state, [](CommandLineInterface &cli) { cli.AddOption("-port", "Port to listen on", GetAllPorts()); });
+}
+
+static void BM_PortRange(benchmark::State &state)
+{
+    ParsePort(state, [](CommandLineInterface &cli) {
+        cli.AddOption("-port", "Port to listen on");
+        cli.SetValueConstraint("-port", ValueConstraint::Range(1, 65535));
+    });
+}
+
+static void BM_PortPattern(benchmark::State &state)
+{
+    ParsePort(state, [](CommandLineInterface &cli) {
+        cli.AddOption("-port", "Port to listen on");
+        cli.SetValueConstraint("-port", ValueConstraint::Pattern("[1-9]\\d{0,4}"));
+    });
+}
+
+static void BM_PatternCompilation(benchmark::State &state)
+{
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ValueConstraint::Pattern("v?\\d{1,3}(\\.\\d{1,3}){2}(-(alpha|beta|rc)\\d*)?"));
+    }
+}
+
+BENCHMARK(BM_PortEnumeration);
+BENCHMARK(BM_PortRange);
+BENCHMARK(BM_PortPattern);
+BENCHMARK(BM_PatternCompilation);
\ No newline at end of file
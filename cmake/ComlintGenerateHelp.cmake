@@ -0,0 +1,31 @@
+# comlint_generate_help(<target> <schema>)
+#
+# Renders help prompt, man page and Markdown documentation from the interface schema (see comlint/interface_schema.hpp) at build time.
+# The help prompt is embedded into <target> as comlint::generated::<schema_name>::kHelp, defined in <schema_name>_help.hpp header, which
+# may be passed to CommandLineInterface::SetHelp. Parser specialized for the schema is defined as comlint::generated::<schema_name>::Parser
+# in <schema_name>_parser.hpp header (see comlint/generated_parser.hpp). Paths of the generated man page and Markdown documentation are
+# stored in COMLINT_MAN_PAGE and COMLINT_MARKDOWN properties of <target>, so they may be installed or packaged.
+function(comlint_generate_help TARGET SCHEMA)
+    get_filename_component(SCHEMA_PATH ${SCHEMA} ABSOLUTE)
+    get_filename_component(SCHEMA_NAME ${SCHEMA} NAME_WE)
+    set(OUTPUT_DIR ${CMAKE_CURRENT_BINARY_DIR}/comlint_generated/${TARGET})
+    set(HELP_HEADER ${OUTPUT_DIR}/${SCHEMA_NAME}_help.hpp)
+    set(MAN_PAGE ${OUTPUT_DIR}/${SCHEMA_NAME}.1)
+    set(MARKDOWN ${OUTPUT_DIR}/${SCHEMA_NAME}.md)
+    set(PARSER_HEADER ${OUTPUT_DIR}/${SCHEMA_NAME}_parser.hpp)
+
+    add_custom_command(
+        OUTPUT ${HELP_HEADER} ${MAN_PAGE} ${MARKDOWN} ${PARSER_HEADER}
+        COMMAND comlint_help_generator ${SCHEMA_PATH} ${OUTPUT_DIR} ${SCHEMA_NAME}
+        DEPENDS comlint_help_generator ${SCHEMA_PATH}
+        COMMENT "Generating help of ${TARGET} from ${SCHEMA_NAME} schema"
+        VERBATIM
+    )
+
+    target_sources(${TARGET} PRIVATE ${HELP_HEADER} ${MAN_PAGE} ${MARKDOWN} ${PARSER_HEADER})
+    target_include_directories(${TARGET} PRIVATE ${OUTPUT_DIR})
+    set_target_properties(${TARGET} PROPERTIES
+        COMLINT_MAN_PAGE ${MAN_PAGE}
+        COMLINT_MARKDOWN ${MARKDOWN}
+    )
+endfunction()
@@ -9,13 +9,19 @@ class AddCommandHandler : public CommandHandlerInterface
 public:
     void Run(const ParsedCommand &command) final
     {
-        std::cout << "Running add command for file " << command.values.front() << std::endl;
+        OutputSink output {};
+
+        Run(command, output);
+    }
+    void Run(const ParsedCommand &command, OutputSink &output) final
+    {
+        output << "Running add command for file " << command.values.front() << '\n';
 
         if (command.flags.at("--verbose")) {
-            std::cout << "Being verbose" << std::endl;
+            output << "Being verbose\n";
         }
         if (command.flags.at("--interactive")) {
-            std::cout << "Adding interactively" << std::endl;
+            output << "Adding interactively\n";
         }
     }
 };
@@ -25,19 +31,25 @@ class CommitCommandHandler : public CommandHandlerInterface
 public:
     void Run(const ParsedCommand &command) final
     {
-        std::cout << "Running commit command!" << std::endl;
+        OutputSink output {};
+
+        Run(command, output);
+    }
+    void Run(const ParsedCommand &command, OutputSink &output) final
+    {
+        output << "Running commit command!\n";
 
         if (command.IsOptionUsed("-m")) {
-            std::cout << "Adding message " << command.options.at("-m") << std::endl;
+            output << "Adding message " << command.options.at("-m") << '\n';
         }
         if (command.IsOptionUsed("-c")) {
-            std::cout << "Re-editting commit " << command.options.at("-c") << std::endl;
+            output << "Re-editting commit " << command.options.at("-c") << '\n';
         }
         if (command.flags.at("--amend")) {
-            std::cout << "Amending commit" << std::endl;
+            output << "Amending commit\n";
         }
         if (command.flags.at("--verbose")) {
-            std::cout << "Being verbose" << std::endl;
+            output << "Being verbose\n";
         }
     }
 };
@@ -47,11 +59,17 @@ class MergeCommandHandler : public CommandHandlerInterface
 public:
     void Run(const ParsedCommand &command) final
     {
-        std::cout << "Running merge command for branches " << command.values.at(0U) << " and " << command.values.at(1U) 
-              << " using strategy " << command.options.at("-s") << std::endl;
+        OutputSink output {};
+
+        Run(command, output);
+    }
+    void Run(const ParsedCommand &command, OutputSink &output) final
+    {
+        output << "Running merge command for branches " << command.values.at(0U) << " and " << command.values.at(1U) 
+               << " using strategy " << command.options.at("-s") << '\n';
 
         if (command.IsOptionUsed("-m")) {
-            std::cout << "Adding message " << command.options.at("-m") << std::endl;
+            output << "Adding message " << command.options.at("-m") << '\n';
         }
     }
 };
@@ -61,10 +79,16 @@ class SubmoduleCommandHandler : public CommandHandlerInterface
 public:
     void Run(const ParsedCommand &command) final
     {
-        std::cout << "Running submodule " << command.values.front() << " command!" << std::endl;
+        OutputSink output {};
+
+        Run(command, output);
+    }
+    void Run(const ParsedCommand &command, OutputSink &output) final
+    {
+        output << "Running submodule " << command.values.front() << " command!\n";
 
         if (command.flags.at("--verbose")) {
-            std::cout << "Being verbose" << std::endl;
+            output << "Being verbose\n";
         }
     }
 };
@@ -98,22 +122,21 @@ int main(int argc, char** argv)
         cli.AddFlag("--interactive", "Add files to commit interactively");
         cli.AddFlag("--amend", "Join to previous commit");
 
-        // add command handlers
-        CommandHandlerPtr add_handler = std::make_shared<AddCommandHandler>();
-        CommandHandlerPtr commit_handler = std::make_shared<CommitCommandHandler>();
-        CommandHandlerPtr merge_handler = std::make_shared<MergeCommandHandler>();
-        CommandHandlerPtr submodule_handler = std::make_shared<SubmoduleCommandHandler>();
-
-        cli.AddCommandHandler("add", add_handler);
-        cli.AddCommandHandler("commit", commit_handler);
-        cli.AddCommandHandler("merge", merge_handler);
-        cli.AddCommandHandler("submodule", submodule_handler);
+        // add command handler which is constructed right away
+        cli.AddCommandHandler("add", std::make_shared<AddCommandHandler>());
+        // add command handlers which are constructed only when their command is used
+        cli.AddCommandHandlerFactory("commit", []() { return std::make_shared<CommitCommandHandler>(); });
+        cli.AddCommandHandlerFactory("merge", []() { return std::make_shared<MergeCommandHandler>(); });
+        cli.AddCommandHandlerFactory("submodule", []() { return std::make_shared<SubmoduleCommandHandler>(); });
 
-        // run command provided by the user from the command line
+        // run command provided by the user from the command line, its output is written to standard output at once when the handler finishes
         cli.Run();
     }
     catch (const std::exception &e) {
-        std::cerr << e.what() << std::endl;
+        // errors go to the standard error, written at once when the sink is destroyed
+        OutputSink error_output(std::cerr);
+
+        error_output << e.what() << '\n';
     }
 
     return 0;
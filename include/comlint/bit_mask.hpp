@@ -0,0 +1,129 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+namespace comlint {
+
+/**
+ * @brief Set of dense indexes (e.g. IDs of options or flags) stored as a bit mask. The mask grows when a bit outside of its current size
+ *        is set. Compacted mask stores only the words between the lowest and the highest set bit.
+ */
+class BitMask
+{
+public:
+    using allocator_type = std::pmr::polymorphic_allocator<std::uint64_t>;
+
+    explicit BitMask(const std::size_t num_of_bits = 0U, const allocator_type &allocator = {})
+    : words_((num_of_bits + kBitsPerWord - 1U) / kBitsPerWord, 0U, allocator)
+    {}
+    explicit BitMask(const allocator_type &allocator)
+    : words_(allocator)
+    {}
+    BitMask(const BitMask &other) = default;
+    BitMask(BitMask &&other) = default;
+    BitMask(const BitMask &other, const allocator_type &allocator)
+    : first_word_(other.first_word_),
+      words_(other.words_, allocator)
+    {}
+    BitMask(BitMask &&other, const allocator_type &allocator)
+    : first_word_(other.first_word_),
+      words_(std::move(other.words_), allocator)
+    {}
+    BitMask& operator=(const BitMask &other) = default;
+    BitMask& operator=(BitMask &&other) = default;
+
+    void Set(const std::size_t index)
+    {
+        const std::size_t word = index / kBitsPerWord;
+
+        if (words_.empty()) {
+            first_word_ = word;
+        }
+        if (word < first_word_) {
+            words_.insert(words_.begin(), first_word_ - word, 0U);
+            first_word_ = word;
+        }
+        if (word - first_word_ >= words_.size()) {
+            words_.resize(word - first_word_ + 1U, 0U);
+        }
+
+        words_[word - first_word_] |= GetBit(index);
+    }
+
+    bool Test(const std::size_t index) const
+    {
+        return (GetWord(index / kBitsPerWord) & GetBit(index)) != 0U;
+    }
+
+    /**
+     * @brief Checks whether all the bits set in the other mask are also set in this mask.
+     */
+    bool Contains(const BitMask &other) const
+    {
+        for (std::size_t i=0U; i<other.words_.size(); i++) {
+            if ((other.words_[i] & ~GetWord(other.first_word_ + i)) != 0U) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Drops the zero words below the lowest and above the highest set bit and releases unused capacity.
+     */
+    void Compact()
+    {
+        std::size_t first = 0U;
+        std::size_t last = words_.size();
+
+        while (first < last && words_[first] == 0U) {
+            first++;
+        }
+        while (last > first && words_[last - 1U] == 0U) {
+            last--;
+        }
+
+        words_.erase(words_.begin() + static_cast<std::ptrdiff_t>(last), words_.end());
+        words_.erase(words_.begin(), words_.begin() + static_cast<std::ptrdiff_t>(first));
+        words_.shrink_to_fit();
+        first_word_ = words_.empty() ? 0U : first_word_ + first;
+    }
+
+    std::size_t GetHeapSize() const
+    {
+        return words_.capacity() * sizeof(std::uint64_t);
+    }
+
+    bool IsEmpty() const
+    {
+        for (const std::uint64_t word : words_) {
+            if (word != 0U) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+private:
+    static constexpr std::size_t kBitsPerWord {64U};
+
+    static std::uint64_t GetBit(const std::size_t index)
+    {
+        return std::uint64_t{1U} << (index % kBitsPerWord);
+    }
+
+    std::uint64_t GetWord(const std::size_t word) const
+    {
+        return word >= first_word_ && word - first_word_ < words_.size() ? words_[word - first_word_] : 0U;
+    }
+
+    std::size_t first_word_ {0U};
+    std::pmr::vector<std::uint64_t> words_;
+};
+
+} // comlint
\ No newline at end of file
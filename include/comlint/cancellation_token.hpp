@@ -0,0 +1,43 @@
+#pragma once
+
+#include <atomic>
+
+#include "comlint/exceptions/command_cancelled.hpp"
+
+namespace comlint {
+
+/**
+ * @brief Flag telling a running command handler that it should stop, e.g. because its command exceeded the timeout. Cancellation is
+ *        cooperative: handlers which may run for long should poll IsCancelled() (or call ThrowIfCancelled()) between units of their work.
+ *        Polling is a single relaxed load, so it may be done as often as needed.
+ */
+class CancellationToken
+{
+public:
+    CancellationToken() = default;
+    CancellationToken(const CancellationToken&) = delete;
+    CancellationToken& operator=(const CancellationToken&) = delete;
+
+    bool IsCancelled() const
+    {
+        return is_cancelled_.load(std::memory_order_relaxed);
+    }
+    /**
+     * @brief Throws CommandCancelled if the token is cancelled, so a handler may stop with a single call.
+     */
+    void ThrowIfCancelled() const
+    {
+        if (IsCancelled()) {
+            throw CommandCancelled("Command has been cancelled!");
+        }
+    }
+    void Cancel()
+    {
+        is_cancelled_.store(true, std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<bool> is_cancelled_ {false};
+};
+
+} // comlint
\ No newline at end of file
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <exception>
+#include <string>
+#include <utility>
+
+#include "comlint/command_handler_interface.hpp"
+#include "comlint/output_sink.hpp"
+#include "comlint/parsed_command.hpp"
+
+namespace comlint {
+
+/**
+ * @brief Settings of a command whose values are processed independently of each other, so its handler may be invoked concurrently for
+ *        separate parts of the values.
+ */
+struct FanOut
+{
+    // maximal number of handler invocations running at once, 0 means the number of hardware threads
+    std::size_t max_concurrency {0U};
+    // number of values passed to a single handler invocation
+    std::size_t chunk_size {1U};
+    // whether output of the invocations is merged in order of their values (otherwise in order in which the invocations start)
+    bool is_output_ordered {true};
+};
+
+class CommandFanOut
+{
+public:
+    /**
+     * @brief Splits values of the parsed command into chunks and invokes the handler once per chunk, running the invocations concurrently
+     *        on the shared thread pool. Every invocation gets a copy of the parsed command holding only its chunk of values and a child
+     *        of the given output sink. Invocations which are free take the next chunk, so the work stays balanced even if some values take
+     *        much longer than others. All the invocations are run even if some of them fail, and then CommandHandlerFailed listing all
+     *        the failures in order of the values is thrown. Handler must be safe to be invoked from multiple threads at once. Once the
+     *        token is cancelled, chunks which haven't been started yet are skipped.
+     */
+    static void Run(CommandHandlerInterface &command_handler, const ParsedCommand &parsed_command, const FanOut &fan_out, OutputSink &output,
+                    const CancellationToken &cancellation_token);
+
+private:
+    using ValuesRange = std::pair<CommandValues::const_iterator, CommandValues::const_iterator>;
+
+    static ValuesRange GetChunk(const CommandValues &values, const std::size_t chunk, const std::size_t chunk_size);
+    static std::string GetFailure(const ValuesRange &chunk_values, const std::exception_ptr &exception);
+};
+
+} // comlint
\ No newline at end of file
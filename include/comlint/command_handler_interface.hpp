@@ -2,6 +2,8 @@
 
 #include <memory>
 
+#include "comlint/cancellation_token.hpp"
+#include "comlint/output_sink.hpp"
 #include "comlint/parsed_command.hpp"
 
 namespace comlint {
@@ -12,6 +14,16 @@ public:
     virtual ~CommandHandlerInterface() = default;
 
     virtual void Run(const ParsedCommand &command) = 0;
+    /**
+     * @brief Runs the command, writing its output to the given sink, which belongs to this invocation only. By default calls Run(command),
+     *        so handlers which don't override this overload simply don't use the sink.
+     */
+    virtual void Run(const ParsedCommand &command, OutputSink&) { Run(command); }
+    /**
+     * @brief Runs the command, which should stop once the token is cancelled (e.g. when the command exceeds its timeout). Handlers of
+     *        commands which may run for long should override this overload and poll the token. By default calls Run(command, output).
+     */
+    virtual void Run(const ParsedCommand &command, OutputSink &output, const CancellationToken&) { Run(command, output); }
 };
 
 using CommandHandlerPtr = std::shared_ptr<CommandHandlerInterface>;
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <map>
+#include <memory_resource>
+#include <mutex>
+#include <string_view>
+
+#include "comlint/command_handler_interface.hpp"
+#include "comlint/memory_footprint.hpp"
+
+namespace comlint {
+
+/**
+ * @brief Registry of command handlers which may be replaced while other threads are dispatching commands. Reads never take a lock: reader
+ *        announces itself in one of two counters selected by the current epoch, copies the handler pointer and leaves. Writer publishes
+ *        the new handler and waits until both counters drain before the previous version is released, so no reader can observe a freed
+ *        handler. Handlers which are already running keep the previous version alive through their own copy of the pointer.
+ *        Commands must be added before the registry is used from multiple threads.
+ */
+class CommandHandlerRegistry
+{
+public:
+    using HandlerSlot = std::atomic<const CommandHandlerPtr*>;
+
+    // heap memory taken by slot of a single command (apart from its name) and by a single registered handler
+    static constexpr std::size_t kSlotSize {MemoryFootprint::GetMapNodeSize<std::pair<const std::pmr::string, HandlerSlot>>()};
+    static constexpr std::size_t kHandlerSize {sizeof(CommandHandlerPtr)};
+
+    explicit CommandHandlerRegistry(std::pmr::memory_resource *memory_resource = std::pmr::get_default_resource());
+    CommandHandlerRegistry(const CommandHandlerRegistry&) = delete;
+    CommandHandlerRegistry& operator=(const CommandHandlerRegistry&) = delete;
+    ~CommandHandlerRegistry();
+
+    void AddCommand(const std::string_view command_name);
+    bool ContainsCommand(const std::string_view command_name) const;
+    /**
+     * @brief Replaces handler of the given command. Blocks until no reader may still be reading the previous version. May be called
+     *        concurrently with GetHandler() and with itself.
+     */
+    void SetHandler(const std::string_view command_name, CommandHandlerPtr command_handler);
+    /**
+     * @brief Returns handler of the given command (or nullptr if none has been set) without taking any lock.
+     */
+    CommandHandlerPtr GetHandler(const std::string_view command_name) const;
+    /**
+     * @brief Returns slot of the given command. Slots never move, so they may be looked up once and then used with GetHandler(slot)
+     *        instead of looking the command up by its name on every dispatch.
+     */
+    const HandlerSlot& GetSlot(const std::string_view command_name) const;
+    CommandHandlerPtr GetHandler(const HandlerSlot &handler_slot) const;
+
+private:
+    static constexpr std::size_t kCacheLineSize {64U};
+
+    struct alignas(kCacheLineSize) ReadersCounter
+    {
+        std::atomic<unsigned int> num_of_readers {0U};
+    };
+
+    void WaitForReaders();
+
+    std::pmr::map<std::pmr::string, HandlerSlot, std::less<>> handlers_;
+    std::mutex update_mutex_;
+    alignas(kCacheLineSize) std::atomic<unsigned int> epoch_;
+    mutable std::array<ReadersCounter, 2U> readers_counters_;
+};
+
+} // comlint
\ No newline at end of file
@@ -1,8 +1,10 @@
 #pragma once
 
+#include <cstdint>
+
 namespace comlint {
 
-enum class CommandLineElementType
+enum class CommandLineElementType : std::uint8_t
 {
     kCommand,
     kOption,
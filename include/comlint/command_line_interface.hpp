@@ -30,13 +30,27 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <functional>
+#include <memory_resource>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <type_traits>
 
 #include "comlint/export_comlint_api.hpp"
 #include "comlint/interface_validator.hpp"
 #include "comlint/parsed_command.hpp"
-#include "comlint/command_line_element_type.hpp"
+#include "comlint/command_handler_registry.hpp"
+#include "comlint/compiled_interface.hpp"
+#include "comlint/function_command_handler.hpp"
 #include "comlint/interface_helper.hpp"
+#include "comlint/invocation_log.hpp"
+#include "comlint/lazy_command_handler.hpp"
+#include "comlint/memory_footprint.hpp"
+#include "comlint/metrics_collector.hpp"
+#include "comlint/tracer.hpp"
 
 namespace comlint {
 
@@ -51,8 +65,10 @@ public:
      * @description: Program description which should be displayed in help prompt.
      * @allow_no_arguments: Setting to true means that program may be ran without providing any command line arguments. Setting to false means that at least
      *                      one command line argument must be provided (otherwise, the help prompt will be displayed).
+     * @memory_resource: Memory resource from which all the declared commands, options and flags are allocated. By default the global heap is used.
      */
-    PUBLIC_COMLINT_API CommandLineInterface(const int argc, char** argv, const std::string &program_name = "", const std::string &description = "", const bool allow_no_arguments = true);
+    PUBLIC_COMLINT_API CommandLineInterface(const int argc, char** argv, const std::string &program_name = "", const std::string &description = "", const bool allow_no_arguments = true,
+                                            std::pmr::memory_resource *memory_resource = std::pmr::get_default_resource());
 
     /**
      * @brief Method allowing user to add a command which does not take any value.
@@ -88,45 +104,245 @@ public:
      * @option_name: Name of the option (must be prefixed with a single dash "-").
      * @description: Usage help for the option.
      * @allowed_values: Optional argument to specify list of allowed values for the option. By default (empty list) any values are allowed.
+     * @environment_variable: Optional name of the environment variable from which the option value is taken if the option is not provided in
+     *                        the command line. By default (empty name) the option is not bound to any environment variable.
+     * @default_value: Optional value which is used if the option is provided neither in the command line, nor in the environment variable, nor
+     *                 in the configuration file. It must be one of the allowed values. By default (empty value) the option has no default value.
      */
-    PUBLIC_COMLINT_API void AddOption(const OptionName &option_name, const std::string &description, const OptionValues &allowed_values = ANY);
+    PUBLIC_COMLINT_API void AddOption(const OptionName &option_name, const std::string &description, const OptionValues &allowed_values = ANY,
+                                      const std::string &environment_variable = "", const OptionValue &default_value = "");
     /**
      * @brief: Method allowing user to add a flag.
      * @flag_name: Name of the flag (must be prefixed with a double dash "--").
      * @description: Usage help for the flag.
      */
     PUBLIC_COMLINT_API void AddFlag(const FlagName &flag_name, const std::string &description);
+    /**
+     * @brief: Method allowing user to take allowed values of an already added command or option from an external file (one value per line,
+     *         sorted in ascending byte order). The file is mapped into memory and searched in place, so it may list millions of values.
+     *         Value is allowed if it's either in the dictionary or on the list of allowed values given when the element was added. Help
+     *         prompt shows only the number of values and the path of the file.
+     * @element_name: Name of the command or the option.
+     * @dictionary_path: Path to the dictionary file.
+     */
+    PUBLIC_COMLINT_API void SetAllowedValuesDictionary(const std::string &element_name, const std::string &dictionary_path);
+    /**
+     * @brief: Method allowing user to set a constraint (integer range or pattern) which every value of an already added command or option
+     *         must satisfy, in addition to being allowed by the list or the dictionary of allowed values. Constraint is shown in help prompt.
+     * @element_name: Name of the command or the option.
+     * @value_constraint: Constraint created with ValueConstraint::Range or ValueConstraint::Pattern.
+     */
+    PUBLIC_COMLINT_API void SetValueConstraint(const std::string &element_name, ValueConstraint value_constraint);
+    /**
+     * @brief: Method allowing user to declare that every value of an already added command or option is a path which must meet the given
+     *         requirements (e.g. PathRequirement::kFile | PathRequirement::kReadable). All the paths given in the command line are checked
+     *         concurrently after parsing, violations are reported together in one InvalidPath exception and metadata of the checked paths
+     *         is passed to the command handler in ParsedCommand::paths.
+     * @element_name: Name of the command or the option.
+     * @path_requirement: Requirements combined with operator|, PathRequirement::kNone turns the check off.
+     */
+    PUBLIC_COMLINT_API void SetPathRequirement(const std::string &element_name, const PathRequirement path_requirement);
+    /**
+     * @brief: Method allowing user to declare that values of an already added command or option may be glob patterns (e.g. "*.cpp"),
+     *         which are expanded by the library instead of the shell. Handler receives the patterns unchanged and gets the matching paths
+     *         streamed from ParsedCommand::ForEachPath, while the directories are walked concurrently. Path requirements are not checked for
+     *         the patterns.
+     * @element_name: Name of the command or the option.
+     * @glob_expansion: GlobExpansion::kOrdered to get the matches in the same order in every run, GlobExpansion::kDisabled turns it off.
+     */
+    PUBLIC_COMLINT_API void SetGlobExpansion(const std::string &element_name, const GlobExpansion glob_expansion = GlobExpansion::kUnordered);
+    /**
+     * @brief: Method allowing user to declare that values of an already added command are processed independently of each other, so Run()
+     *         may split them into chunks and invoke the command handler for every chunk concurrently (see CommandFanOut). Handler of such
+     *         command must be safe to be invoked from multiple threads at once.
+     * @command_name: Name of the command.
+     * @fan_out: Maximal number of concurrent invocations, number of values per invocation and ordering of their output.
+     */
+    PUBLIC_COMLINT_API void SetFanOut(const CommandName &command_name, const FanOut &fan_out = {});
+    /**
+     * @brief: Method allowing user to limit time for which the handler of an already added command may run. When the time passes, the
+     *         watchdog cancels the token given to the handler and, once the handler returns, Run() throws CommandTimedOut. Cancellation is
+     *         cooperative, so the handler should poll the token (see CancellationToken).
+     * @command_name: Name of the command.
+     * @timeout: Maximal time of a single run of the command.
+     */
+    PUBLIC_COMLINT_API void SetTimeout(const CommandName &command_name, const std::chrono::milliseconds timeout);
+    /**
+     * @brief: Method enabling collection of metrics of Run(): number of runs, number of errors by exception type and latency histogram
+     *         of every command (see MetricsCollector). Metrics are periodically written to the file given in the settings. It should be
+     *         called after all the AddCommand() calls and before Run() is called from multiple threads: commands added later are collected
+     *         as well, but the interface must not change while Run() runs, and calling this method again discards the metrics collected
+     *         so far.
+     * @settings: Path of the metrics file, period of writing it and whether it's replaced or appended to.
+     */
+    PUBLIC_COMLINT_API void EnableMetrics(const MetricsSettings &settings = {});
+    /**
+     * @brief: Returns metrics of all the commands collected so far (empty if metrics are not enabled).
+     */
+    PUBLIC_COMLINT_API std::vector<CommandMetrics> GetMetrics() const;
+    /**
+     * @brief: Method enabling recording of every Parse() and Run() into a binary invocation log (see InvocationLog), which may be replayed
+     *         with comlint_invocation_replayer. Recording is enabled as well when COMLINT_RECORD environment variable is set (to the path
+     *         of the log) at construction. Failure to write the log never fails the invocation.
+     * @log_path: Path of the log, records are appended to it. Empty path disables recording.
+     */
+    PUBLIC_COMLINT_API void EnableRecording(const std::string &log_path);
+    /**
+     * @brief: Method allowing user to set configuration file (in INI format) which provides values of the options not given in the command line.
+     *         Entries of a section named after the command are used for that command, entries placed before the first section are used when
+     *         no command is given. The file is mapped into memory during parsing and only the section of the used command is parsed.
+     *         If the file does not exist, it is ignored.
+     * @config_file_path: Path to the configuration file.
+     */
+    PUBLIC_COMLINT_API void SetConfigFile(const std::string &config_file_path);
+    /**
+     * @brief: Method allowing user to accept unique prefixes of command, option and flag names given in the command line (e.g. "comm" for
+     *         "commit" or "--verb" for "--verbose"). Exact name is always preferred, prefix shared by multiple names throws
+     *         AmbiguousAbbreviation. Names read from environment variables and configuration file are never abbreviated.
+     * @allow_abbreviations: Whether the abbreviations are accepted.
+     */
+    PUBLIC_COMLINT_API void AllowAbbreviations(const bool allow_abbreviations = true);
+    /**
+     * @brief: Method allowing user to replace the help prompt generated from the declared interface elements with a prerendered one
+     *         (e.g. generated at build time by comlint_generate_help CMake function). The text is not copied, so it must outlive the
+     *         interface and all the compiled interfaces created from it.
+     * @help: Complete text of the help prompt.
+     */
+    PUBLIC_COMLINT_API void SetHelp(const std::string_view help);
+    /**
+     * @brief: Method allowing user to limit heap memory used by the declared interface elements (commands, options, flags and references
+     *         to command handlers) together with the interface compiled for parsing. Adding an element which would exceed the budget throws
+     *         MemoryBudgetExceeded and leaves the interface unchanged, parsing throws it if the compiled interface doesn't fit into the budget.
+     * @memory_budget: Maximal number of bytes, 0 means no limit.
+     */
+    PUBLIC_COMLINT_API void SetMemoryBudget(const std::size_t memory_budget);
+    /**
+     * @brief: Returns heap memory used by the declared interface elements, split into names, descriptions, lists of allowed values,
+     *         lookup indexes and command handlers. The interface compiled for parsing is included once it's compiled (with its help prompt
+     *         once it's rendered), snapshots returned by Compile() are not.
+     */
+    PUBLIC_COMLINT_API MemoryFootprint GetMemoryFootprint() const;
     /**
      * @brief: Method parses command line input in context of the declared interface elements (commands, options and flags).
      * @return: Structure containing parsed command and its properties.
      */
     PUBLIC_COMLINT_API ParsedCommand Parse() const;
     /**
-     * @brief Method allowing user to register a command handler for the given command name.
+     * @brief: Same as Parse(), but the returned structure is allocated from the given memory resource.
+     * @memory_resource: Memory resource from which parsed command, its values, options and flags are allocated.
+     * @return: Structure containing parsed command and its properties.
+     */
+    PUBLIC_COMLINT_API pmr::ParsedCommand Parse(std::pmr::memory_resource *memory_resource) const;
+    /**
+     * @brief: Creates immutable snapshot of the declared interface elements (commands, options and flags), which may be used to parse
+     *         multiple command lines concurrently. Later changes of this object do not affect the returned snapshot. Command handlers
+     *         are not part of the snapshot.
+     * @return: Compiled interface allocated from the memory resource given in the constructor.
+     */
+    PUBLIC_COMLINT_API CompiledInterface Compile() const;
+    /**
+     * @brief Method allowing user to register a command handler for the given command name. Handler may be replaced at any time, also
+     *        while Run() is being executed in other threads. Handlers which are already running finish with the previous version.
      * @command_name: Name of the command.
      * @command_handler: Object containing implementation of all the logic which should be perfomred when specific command is used.
      */
     PUBLIC_COMLINT_API void AddCommandHandler(const CommandName &command_name, CommandHandlerPtr command_handler);
+    /**
+     * @brief Same as AddCommandHandler, but the handler is a lambda or a function object taking the parsed command (and optionally the
+     *        output sink). Function is stored inline in a final handler class, so its body may be inlined into the dispatch.
+     * @command_name: Name of the command.
+     * @function: Callable invoked with the parsed command whenever the command is run.
+     */
+    template <typename Function, typename = std::enable_if_t<kIsCommandHandlerFunction<std::decay_t<Function>>>>
+    void AddCommandHandler(const CommandName &command_name, Function &&function)
+    {
+        AddCommandHandler(command_name, CommandHandlerPtr(std::make_shared<FunctionCommandHandler<std::decay_t<Function>>>(std::forward<Function>(function))));
+    }
+    /**
+     * @brief Same as AddCommandHandler, but the handler is created by the given factory only when the command is run for the first time,
+     *        so handlers which are expensive to construct (e.g. opening databases) cost nothing unless their command is used.
+     * @command_name: Name of the command.
+     * @command_handler_factory: Callable returning the command handler.
+     */
+    PUBLIC_COMLINT_API void AddCommandHandlerFactory(const CommandName &command_name, CommandHandlerFactory command_handler_factory);
+    /**
+     * @brief Same as AddCommandHandlerFactory, but the handler is created by a function defined with COMLINT_EXPORT_COMMAND_HANDLER
+     *        in a shared library, which is loaded only when the command is run for the first time.
+     * @command_name: Name of the command.
+     * @library_path: Path of the shared library.
+     * @symbol_name: Name of the function creating the handler.
+     */
+    PUBLIC_COMLINT_API void AddCommandHandlerPlugin(const CommandName &command_name, const std::string &library_path, const std::string &symbol_name);
     /**
      * @brief Automatically runs command handler for the corresponding command which was provided by the user in the command line.
+     *        Once no more commands, options and flags are added, it may be called from multiple threads and it never takes a lock
+     *        (apart from the very first call, which compiles the interface).
      */
     PUBLIC_COMLINT_API void Run();
+    /**
+     * @brief Same as Run(), but the command handler and the help prompt write to a child of the given output sink. When Run() is called
+     *        concurrently with the same sink, output of every invocation is merged into the sink as a whole, in the order of the calls.
+     * @output: Output sink receiving output of the command handler, e.g. writing to a std::ostringstream to capture it.
+     */
+    PUBLIC_COMLINT_API void Run(OutputSink &output);
 
 private:
-    CommandLineElementType GetCommandLineElementType(const std::string &input, const unsigned int element_position_index) const;
-    CommandValues ParseCommand(const CommandName &command_name, const unsigned int command_index) const;
-    std::pair<OptionName, OptionValue> ParseOption(const CommandName &command_name, const OptionName &option_name,
-                                                   const unsigned int option_index) const;
-    FlagName ParseFlag(const CommandName &command_name, const FlagName &flag_name, const unsigned int flag_index) const;
+    struct CommandDispatch
+    {
+        const CommandHandlerRegistry::HandlerSlot *handler_slot;
+        const CommandProperties *command_properties;
+        // index of the command in the metrics collector, which keeps the commands in the order in which they were compiled first
+        std::uint32_t metrics_command;
+    };
+
+    void RunCommand(const std::uint32_t command, const ParsedCommand &parsed_command, OutputSink &output);
+    template <typename ParsedCommandType, typename ParseFunction>
+    ParsedCommandType RecordParsing(const ParseFunction &parse) const;
+    void RecordInvocation(const InvocationOutcome outcome, std::string result, const std::chrono::nanoseconds parse_time,
+                          const std::chrono::nanoseconds run_time) const;
+    static void RunHandler(CommandHandlerInterface &command_handler, const ParsedCommand &parsed_command, const CommandProperties &command_properties,
+                           OutputSink &output);
+    void ReserveMemory(const MemoryFootprint &footprint, const std::string &element_description);
+    // returns true if the element is an added option, false if it's an added command; throws if the element is not added at all
+    bool IsAddedOption(const std::string &element_name, const std::string &action) const;
+    template <typename ValueSourcePtr>
+    void ReplaceValueSource(ValueSourcePtr &value_source, ValueSourcePtr new_value_source, const std::string &element_description);
+    CompiledInterface Compile(CompiledInterface::HelpRenderer render_help) const;
+    const CompiledInterface& GetCompiledInterface() const;
+    void InvalidateCompiledInterface();
+    // starts tracing if it's requested and returns the time at which the construction started (Tracer::kNoTime if tracing is off)
+    static std::int64_t StartTracing(const int argc, char** argv);
 
+    // initialised before all the other members, so the span of the constructor covers their initialisation as well
+    const std::int64_t construction_start_time_;
     const unsigned int argc_;
     char** argv_;
-    std::string program_name_;
-    std::string description_;
+    std::pmr::string program_name_;
+    std::pmr::string description_;
     bool allow_no_arguments_;
+    bool allow_abbreviations_;
     Commands interface_commands_;
     Options interface_options_;
     Flags interface_flags_;
+    std::pmr::string config_file_path_;
+    std::string_view static_help_;
+    CommandHandlerRegistry command_handlers_;
+    std::size_t memory_budget_;
+    MemoryFootprint memory_footprint_;
+    // compiled on the first parsing and dropped whenever the interface changes
+    mutable std::mutex compilation_mutex_;
+    mutable std::optional<CompiledInterface> compiled_interface_;
+    mutable std::atomic<bool> is_compiled_;
+    // handler slots and properties of the commands indexed like commands of the compiled interface, rebuilt whenever it's compiled
+    mutable std::pmr::vector<CommandDispatch> dispatch_table_;
+    std::optional<MetricsSettings> metrics_settings_;
+    // created on the first compilation once metrics are enabled and kept when commands are added, so the counters are never lost
+    mutable std::unique_ptr<MetricsCollector> metrics_collector_;
+    // empty if recording is not enabled, schema hash is computed on compilation only while recording
+    std::string recording_path_;
+    mutable std::uint64_t schema_hash_;
+    // consecutive calls of the same Add* method, recorded as a single span when tracing is enabled
+    mutable TraceBatch trace_batch_;
 };
 
 } // comlint
\ No newline at end of file
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+#include <string_view>
+#include <vector>
+
+#include "comlint/command_line_element_type.hpp"
+
+namespace comlint {
+
+using CommandLineTokens = std::pmr::vector<CommandLineElementType>;
+
+/**
+ * @brief Classifies command line elements by their first bytes only, so neither the length of the element is computed nor any temporary
+ *        string is created. Command is a non-empty element without "-" prefix, option is an element with "-" prefix followed by at least
+ *        one other character, and flag is an element with "--" prefix followed by at least one other character.
+ */
+class CommandLineTokenizer
+{
+public:
+    /**
+     * @brief Classifies every element of argv in a single pass. Returned tokens are indexed in the same way as argv, so the first
+     *        token (program name) is always custom value. Only the element directly after program name may be classified as command.
+     */
+    static CommandLineTokens Tokenize(const unsigned int argc, char** argv,
+                                      std::pmr::memory_resource *memory_resource = std::pmr::get_default_resource());
+    static CommandLineElementType GetElementType(const std::string_view element, const bool is_command_position);
+
+private:
+    static CommandLineElementType GetElementType(const char *element, const std::size_t max_size, const bool is_command_position);
+};
+
+} // comlint
\ No newline at end of file
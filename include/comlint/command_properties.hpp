@@ -1,38 +1,88 @@
 #pragma once
 
+#include <chrono>
+#include <optional>
 #include <string>
 #include <vector>
 
+#include "comlint/command_fan_out.hpp"
+#include "comlint/glob_expander.hpp"
+#include "comlint/path_metadata.hpp"
 #include "comlint/types.hpp"
-#include "comlint/command_handler_interface.hpp"
+#include "comlint/value_constraint.hpp"
+#include "comlint/value_dictionary.hpp"
 
 namespace comlint {
 
 /**
- * @brief Structure representing all properties of a single command.
+ * @brief Structure representing all properties of a single command. All the strings and lists are allocated from the memory resource
+ *        of the allocator given in the constructor (or of the container in which the structure is stored).
  */
 struct CommandProperties
 {
+    using allocator_type = std::pmr::polymorphic_allocator<char>;
+
     CommandProperties(const CommandValues &allowed_values, const OptionNames &allowed_options, const FlagNames &allowed_flags,
-                      const std::string &description, const unsigned int num_of_required_values, const OptionNames &required_options ={})
-    : allowed_values{allowed_values},
-      allowed_options{allowed_options},
-      allowed_flags{allowed_flags},
-      description{description},
+                      const std::string &description, const unsigned int num_of_required_values, const OptionNames &required_options ={},
+                      const allocator_type &allocator = {})
+    : allowed_values(allowed_values.begin(), allowed_values.end(), allocator),
+      allowed_options(allowed_options.begin(), allowed_options.end(), allocator),
+      allowed_flags(allowed_flags.begin(), allowed_flags.end(), allocator),
+      description(description, allocator),
       num_of_required_values{num_of_required_values},
-      required_options{required_options},
-      command_handler{nullptr}
+      required_options(required_options.begin(), required_options.end(), allocator)
+    {}
+    CommandProperties(const CommandProperties &other) = default;
+    CommandProperties(CommandProperties &&other) = default;
+    CommandProperties(const CommandProperties &other, const allocator_type &allocator)
+    : allowed_values(other.allowed_values, allocator),
+      allowed_options(other.allowed_options, allocator),
+      allowed_flags(other.allowed_flags, allocator),
+      description(other.description, allocator),
+      num_of_required_values{other.num_of_required_values},
+      required_options(other.required_options, allocator),
+      allowed_values_dictionary(other.allowed_values_dictionary),
+      value_constraint(other.value_constraint),
+      path_requirement(other.path_requirement),
+      glob_expansion(other.glob_expansion),
+      fan_out(other.fan_out),
+      timeout(other.timeout)
+    {}
+    CommandProperties(CommandProperties &&other, const allocator_type &allocator)
+    : allowed_values(std::move(other.allowed_values), allocator),
+      allowed_options(std::move(other.allowed_options), allocator),
+      allowed_flags(std::move(other.allowed_flags), allocator),
+      description(std::move(other.description), allocator),
+      num_of_required_values{other.num_of_required_values},
+      required_options(std::move(other.required_options), allocator),
+      allowed_values_dictionary(std::move(other.allowed_values_dictionary)),
+      value_constraint(std::move(other.value_constraint)),
+      path_requirement(other.path_requirement),
+      glob_expansion(other.glob_expansion),
+      fan_out(other.fan_out),
+      timeout(other.timeout)
     {}
 
     bool RequiresValue() const { return num_of_required_values > 0U; }
 
-    CommandValues allowed_values;
-    OptionNames allowed_options;
-    FlagNames allowed_flags;
-    std::string description;
+    pmr::CommandValues allowed_values;
+    pmr::OptionNames allowed_options;
+    pmr::FlagNames allowed_flags;
+    std::pmr::string description;
     unsigned int num_of_required_values;
-    OptionNames required_options;
-    CommandHandlerPtr command_handler;
+    pmr::OptionNames required_options;
+    // external dictionary of allowed values, checked in addition to allowed_values
+    ValueDictionaryPtr allowed_values_dictionary;
+    // constraint which every value must satisfy, regardless of the lists of allowed values
+    ValueConstraintPtr value_constraint;
+    // requirements which every value must meet as a path, checked for all the values at once after parsing
+    PathRequirement path_requirement {PathRequirement::kNone};
+    // whether values are glob patterns expanded by ParsedCommand::ForEachPath
+    GlobExpansion glob_expansion {GlobExpansion::kDisabled};
+    // settings of concurrent handler invocations for separate parts of the values, handler is invoked once if not set
+    std::optional<FanOut> fan_out {};
+    // time after which the running handler is cancelled, handler may run for as long as it needs if not set
+    std::optional<std::chrono::milliseconds> timeout {};
 };
 
 } // comlint
\ No newline at end of file
@@ -0,0 +1,170 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+#include "comlint/export_comlint_api.hpp"
+#include "comlint/bit_mask.hpp"
+#include "comlint/command_line_tokenizer.hpp"
+#include "comlint/interface_helper.hpp"
+#include "comlint/memory_footprint.hpp"
+#include "comlint/output_sink.hpp"
+#include "comlint/parsed_command.hpp"
+#include "comlint/path_metadata.hpp"
+#include "comlint/value_constraint.hpp"
+#include "comlint/value_dictionary.hpp"
+
+namespace comlint {
+
+class CommandLineInterface;
+
+/**
+ * @brief Immutable snapshot of the interface created by CommandLineInterface::Compile(). Names of commands, options and flags are kept in
+ *        sorted arrays and all the cross-references between them are resolved to indexes of those arrays, so validation of the command
+ *        line needs only binary search of the given names followed by bit tests. The same search resolves unique prefixes of the names when
+ *        abbreviations are allowed, as all the names starting with a prefix are adjacent in a sorted array. Descriptions are used only by the help prompt, which is
+ *        rendered when it's requested for the first time and kept apart from the validation data. The snapshot holds no argc/argv and is never modified
+ *        after construction, so Parse() may be called concurrently from multiple threads without any locking.
+ */
+class CompiledInterface
+{
+public:
+    /**
+     * @brief: Method parses the given command line input in context of the compiled interface.
+     * @argc: argc from main function (or any other argument count).
+     * @argv: argv from main function (or any other argument vector, with program name as the first element).
+     * @return: Structure containing parsed command and its properties.
+     */
+    PUBLIC_COMLINT_API ParsedCommand Parse(const int argc, char** argv) const;
+    /**
+     * @brief: Same as Parse(argc, argv), but the returned structure is allocated from the given memory resource.
+     * @memory_resource: Memory resource from which parsed command, its values, options and flags are allocated.
+     * @return: Structure containing parsed command and its properties.
+     */
+    PUBLIC_COMLINT_API pmr::ParsedCommand Parse(const int argc, char** argv, std::pmr::memory_resource *memory_resource) const;
+    /**
+     * @brief: Same as Parse(argc, argv), but help prompt (if requested) is written to the given output sink instead of standard output.
+     * @output: Output sink receiving the help prompt.
+     * @return: Structure containing parsed command and its properties.
+     */
+    PUBLIC_COMLINT_API ParsedCommand Parse(const int argc, char** argv, OutputSink &output) const;
+    /**
+     * @brief: Returns heap memory used by the compiled interface. Rendered help prompt is reported as descriptions.
+     */
+    PUBLIC_COMLINT_API MemoryFootprint GetMemoryFootprint() const;
+
+private:
+    friend class CommandLineInterface;
+
+    static constexpr std::uint32_t kNoIndex {UINT32_MAX};
+
+    struct StringRange
+    {
+        bool IsEmpty() const { return begin == end; }
+
+        std::uint32_t begin;
+        std::uint32_t end;
+    };
+    struct CompiledCommand
+    {
+        unsigned int num_of_required_values;
+        StringRange allowed_values;
+        StringRange required_options;
+        BitMask allowed_options_mask;
+        BitMask allowed_flags_mask;
+        BitMask required_options_mask;
+        bool has_undeclared_required_options;
+        ValueDictionaryPtr allowed_values_dictionary;
+        ValueConstraintPtr value_constraint;
+        PathRequirement path_requirement;
+        GlobExpansion glob_expansion;
+    };
+    struct CompiledOption
+    {
+        StringRange allowed_values;
+        std::uint32_t default_value;
+        std::uint32_t environment_variable;
+        ValueDictionaryPtr allowed_values_dictionary;
+        ValueConstraintPtr value_constraint;
+        PathRequirement path_requirement;
+        GlobExpansion glob_expansion;
+    };
+    using HelpRenderer = std::function<std::string()>;
+    // shared by copies of the snapshot, so the help is rendered at most once for all of them
+    struct LazyHelp
+    {
+        explicit LazyHelp(std::pmr::memory_resource *memory_resource) : rendering_flag{}, is_rendered{false}, help(memory_resource) {}
+
+        std::once_flag rendering_flag;
+        std::atomic<bool> is_rendered;
+        std::pmr::string help;
+    };
+
+    CompiledInterface(const bool allow_no_arguments, const bool allow_abbreviations, const Commands &commands, const Options &options,
+                      const Flags &flags, const std::string_view config_file_path, const std::string_view static_help, HelpRenderer render_help,
+                      std::pmr::memory_resource *memory_resource);
+
+    /**
+     * @brief Same as Parse(argc, argv, output), but returns index of the parsed command (kNoIndex if help is requested or if no command
+     *        is given), which CommandLineInterface uses to dispatch the command without looking its name up again.
+     */
+    std::uint32_t Parse(const int argc, char** argv, ParsedCommand &parsed_command, OutputSink &output) const;
+    template <typename ParsedCommandType>
+    std::uint32_t ParseInto(const unsigned int argc, char** argv, ParsedCommandType &parsed_command, OutputSink &output) const;
+    template <typename CommandValuesType>
+    std::uint32_t ParseCommand(const unsigned int argc, char** argv, const CommandLineTokens &tokens, const unsigned int command_index,
+                               CommandValuesType &values) const;
+    std::pair<std::uint32_t, std::string_view> ParseOption(const unsigned int argc, char** argv, const std::uint32_t command,
+                                                           const unsigned int option_index) const;
+    std::uint32_t ParseFlag(char** argv, const std::uint32_t command, const unsigned int flag_index) const;
+    template <typename OptionsMapType>
+    void ParseEnvironmentOptions(const std::uint32_t command, OptionsMapType &options, BitMask &used_options) const;
+    template <typename OptionsMapType>
+    void ParseConfigFileOptions(const std::string_view command_name, const std::uint32_t command, OptionsMapType &options, BitMask &used_options) const;
+    template <typename OptionsMapType>
+    void ParseDefaultOptions(const std::uint32_t command, OptionsMapType &options, BitMask &used_options) const;
+    template <typename ParsedCommandType>
+    void CollectGlobPatterns(const std::uint32_t command, ParsedCommandType &parsed_command) const;
+    template <typename ParsedCommandType>
+    void ValidatePaths(const std::uint32_t command, ParsedCommandType &parsed_command, std::pmr::memory_resource *memory_resource) const;
+    bool IsOptionAllowed(const std::uint32_t command, const std::uint32_t option) const;
+    bool IsFlagAllowed(const std::uint32_t command, const std::uint32_t flag) const;
+    bool IsValueAllowed(const StringRange &allowed_values, const ValueDictionaryPtr &allowed_values_dictionary, const std::string_view value) const;
+    std::string GetSimilarValues(const StringRange &allowed_values, const ValueDictionaryPtr &allowed_values_dictionary,
+                                 const std::string_view value) const;
+    void ValidateOptionValue(const std::uint32_t option, const std::string_view value, const std::string &value_origin) const;
+    StringRange AddStrings(const std::pmr::vector<std::pmr::string> &strings);
+    std::uint32_t AddString(const std::string_view string);
+
+    std::uint32_t ResolveName(const std::pmr::vector<std::pmr::string> &names, const std::string_view name, const std::string_view element_kind) const;
+
+    static std::uint32_t FindName(const std::pmr::vector<std::pmr::string> &names, const std::string_view name);
+    std::string_view GetHelp() const;
+
+    // hot data used for validation of every command line
+    bool allow_no_arguments_;
+    bool allow_abbreviations_;
+    std::pmr::vector<std::pmr::string> command_names_;
+    std::pmr::vector<CompiledCommand> commands_;
+    std::pmr::vector<std::pmr::string> option_names_;
+    std::pmr::vector<CompiledOption> options_;
+    std::pmr::vector<std::pmr::string> flag_names_;
+    std::pmr::vector<std::pmr::string> strings_;
+    bool has_environment_options_;
+    bool has_default_options_;
+    bool has_path_requirements_;
+    bool has_glob_expansions_;
+    std::pmr::string config_file_path_;
+    // cold data used only when help is requested, help is rendered only if no static help prompt is given
+    std::string_view static_help_;
+    HelpRenderer render_help_;
+    std::shared_ptr<LazyHelp> lazy_help_;
+};
+
+} // comlint
\ No newline at end of file
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <memory_resource>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace comlint {
+
+using ConfigEntry = std::pair<std::string_view, std::string_view>;
+using ConfigEntries = std::pmr::vector<ConfigEntry>;
+using ConfigSection = std::pair<std::string_view, ConfigEntries>;
+using ConfigSections = std::pmr::vector<ConfigSection>;
+
+/**
+ * @brief Parser of configuration files in INI format. Entries placed before the first section header belong to the section with empty
+ *        name. Lines starting with "#" or ";" are comments.
+ *        Example:
+ *                  [commit]
+ *                  -m = default commit message
+ *                  [merge]
+ *                  -s = recursive
+ */
+class ConfigFile
+{
+public:
+    /**
+     * @brief Returns key=value entries of the given section in order of their appearance in the content. Lines of other sections are
+     *        only checked for being a section header, so they are neither parsed nor validated. Returned keys and values are views
+     *        into the given content.
+     */
+    static ConfigEntries GetSectionEntries(const std::string_view content, const std::string_view section_name,
+                                           std::pmr::memory_resource *memory_resource = std::pmr::get_default_resource());
+    /**
+     * @brief Returns all the sections with their entries in a single pass over the content: the section with empty name first (even if it
+     *        has no entries), then the others in order of their first appearance. Entries of a repeated section are merged, so they are the
+     *        same as returned by GetSectionEntries(). Unlike GetSectionEntries(), all the lines of the content are validated.
+     */
+    static ConfigSections GetSections(const std::string_view content, std::pmr::memory_resource *memory_resource = std::pmr::get_default_resource());
+
+private:
+    static std::string_view Trim(const std::string_view text);
+    static ConfigEntry ParseEntry(const std::string_view line, const unsigned int line_number);
+};
+
+} // comlint
\ No newline at end of file
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <memory_resource>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
+
+namespace comlint {
+
+/**
+ * @brief Index of the environment variables built with a single scan of the environment block. Names and values are views into the
+ *        environment block, so no string is copied.
+ */
+class EnvironmentVariables
+{
+public:
+    explicit EnvironmentVariables(char** environment, std::pmr::memory_resource *memory_resource = std::pmr::get_default_resource());
+
+    static char** GetProcessEnvironment();
+
+    std::optional<std::string_view> Get(const std::string_view name) const;
+
+private:
+    std::pmr::unordered_map<std::string_view, std::string_view> variables_;
+};
+
+} // comlint
\ No newline at end of file
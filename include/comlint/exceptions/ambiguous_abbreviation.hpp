@@ -0,0 +1,17 @@
+#pragma once
+
+#include <iostream>
+
+#include "comlint_exception.hpp"
+
+namespace comlint {
+
+class AmbiguousAbbreviation : public ComlintException
+{
+public:
+    AmbiguousAbbreviation(const std::string &message)
+    : ComlintException("AmbiguousAbbreviation", message)
+    {}
+};
+
+} // comlint
\ No newline at end of file
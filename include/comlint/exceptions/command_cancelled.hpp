@@ -0,0 +1,17 @@
+#pragma once
+
+#include <iostream>
+
+#include "comlint_exception.hpp"
+
+namespace comlint {
+
+class CommandCancelled : public ComlintException
+{
+public:
+    CommandCancelled(const std::string &message)
+    : ComlintException("CommandCancelled", message)
+    {}
+};
+
+} // comlint
\ No newline at end of file
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <iostream>
+
+#include "comlint_exception.hpp"
+
+namespace comlint {
+
+class CommandHandlerFailed : public ComlintException
+{
+public:
+    CommandHandlerFailed(const std::string &message)
+    : ComlintException("CommandHandlerFailed", message)
+    {}
+};
+
+} // comlint
\ No newline at end of file
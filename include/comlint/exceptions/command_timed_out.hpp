@@ -0,0 +1,35 @@
+#pragma once
+
+#include <chrono>
+#include <iostream>
+
+#include "comlint_exception.hpp"
+
+namespace comlint {
+
+/**
+ * @brief Thrown by Run() when the command handler doesn't finish before the timeout of its command. Apart from the message, it carries
+ *        the command and the times, so batch jobs may report the miss without parsing the message.
+ */
+class CommandTimedOut : public ComlintException
+{
+public:
+    CommandTimedOut(const std::string &command_name, const std::chrono::milliseconds timeout, const std::chrono::milliseconds elapsed_time)
+    : ComlintException("CommandTimedOut", "Command " + command_name + " exceeded its timeout of " + std::to_string(timeout.count()) +
+                                          " ms! It has been cancelled after " + std::to_string(elapsed_time.count()) + " ms."),
+      command_name_{command_name},
+      timeout_{timeout},
+      elapsed_time_{elapsed_time}
+    {}
+
+    const std::string& GetCommandName() const { return command_name_; }
+    std::chrono::milliseconds GetTimeout() const { return timeout_; }
+    std::chrono::milliseconds GetElapsedTime() const { return elapsed_time_; }
+
+private:
+    const std::string command_name_;
+    const std::chrono::milliseconds timeout_;
+    const std::chrono::milliseconds elapsed_time_;
+};
+
+} // comlint
\ No newline at end of file
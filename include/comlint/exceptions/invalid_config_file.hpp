@@ -0,0 +1,17 @@
+#pragma once
+
+#include <iostream>
+
+#include "comlint_exception.hpp"
+
+namespace comlint {
+
+class InvalidConfigFile : public ComlintException
+{
+public:
+    InvalidConfigFile(const std::string &message)
+    : ComlintException("InvalidConfigFile", message)
+    {}
+};
+
+} // comlint
\ No newline at end of file
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <iostream>
+
+#include "comlint_exception.hpp"
+
+namespace comlint {
+
+class InvalidDefaultOptionValue : public ComlintException
+{
+public:
+    InvalidDefaultOptionValue(const std::string &message)
+    : ComlintException("InvalidDefaultOptionValue", message)
+    {}
+};
+
+} // comlint
\ No newline at end of file
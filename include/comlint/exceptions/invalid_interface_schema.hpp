@@ -0,0 +1,17 @@
+#pragma once
+
+#include <iostream>
+
+#include "comlint_exception.hpp"
+
+namespace comlint {
+
+class InvalidInterfaceSchema : public ComlintException
+{
+public:
+    InvalidInterfaceSchema(const std::string &message)
+    : ComlintException("InvalidInterfaceSchema", message)
+    {}
+};
+
+} // comlint
\ No newline at end of file
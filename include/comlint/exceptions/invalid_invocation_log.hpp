@@ -0,0 +1,17 @@
+#pragma once
+
+#include <iostream>
+
+#include "comlint_exception.hpp"
+
+namespace comlint {
+
+class InvalidInvocationLog : public ComlintException
+{
+public:
+    InvalidInvocationLog(const std::string &message)
+    : ComlintException("InvalidInvocationLog", message)
+    {}
+};
+
+} // comlint
\ No newline at end of file
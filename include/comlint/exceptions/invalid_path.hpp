@@ -0,0 +1,17 @@
+#pragma once
+
+#include <iostream>
+
+#include "comlint_exception.hpp"
+
+namespace comlint {
+
+class InvalidPath : public ComlintException
+{
+public:
+    InvalidPath(const std::string &message)
+    : ComlintException("InvalidPath", message)
+    {}
+};
+
+} // comlint
\ No newline at end of file
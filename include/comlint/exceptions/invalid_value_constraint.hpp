@@ -0,0 +1,17 @@
+#pragma once
+
+#include <iostream>
+
+#include "comlint_exception.hpp"
+
+namespace comlint {
+
+class InvalidValueConstraint : public ComlintException
+{
+public:
+    InvalidValueConstraint(const std::string &message)
+    : ComlintException("InvalidValueConstraint", message)
+    {}
+};
+
+} // comlint
\ No newline at end of file
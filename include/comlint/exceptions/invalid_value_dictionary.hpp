@@ -0,0 +1,17 @@
+#pragma once
+
+#include <iostream>
+
+#include "comlint_exception.hpp"
+
+namespace comlint {
+
+class InvalidValueDictionary : public ComlintException
+{
+public:
+    InvalidValueDictionary(const std::string &message)
+    : ComlintException("InvalidValueDictionary", message)
+    {}
+};
+
+} // comlint
\ No newline at end of file
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <iostream>
+
+#include "comlint_exception.hpp"
+
+namespace comlint {
+
+class MemoryBudgetExceeded : public ComlintException
+{
+public:
+    MemoryBudgetExceeded(const std::string &message)
+    : ComlintException("MemoryBudgetExceeded", message)
+    {}
+};
+
+} // comlint
\ No newline at end of file
@@ -8,11 +8,21 @@ namespace comlint {
 
 struct FlagProperties
 {
-    FlagProperties(const std::string &description)
-    : description{description}
+    using allocator_type = std::pmr::polymorphic_allocator<char>;
+
+    FlagProperties(const std::string &description, const allocator_type &allocator = {})
+    : description(description, allocator)
+    {}
+    FlagProperties(const FlagProperties &other) = default;
+    FlagProperties(FlagProperties &&other) = default;
+    FlagProperties(const FlagProperties &other, const allocator_type &allocator)
+    : description(other.description, allocator)
+    {}
+    FlagProperties(FlagProperties &&other, const allocator_type &allocator)
+    : description(std::move(other.description), allocator)
     {}
 
-    std::string description;
+    std::pmr::string description;
 };
 
 } // comlint
\ No newline at end of file
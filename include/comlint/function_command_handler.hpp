@@ -0,0 +1,71 @@
+#pragma once
+
+#include <type_traits>
+#include <utility>
+
+#include "comlint/command_handler_interface.hpp"
+
+namespace comlint {
+
+/**
+ * @brief Command handler running the given lambda or function object, which is stored inline in the handler (so registering it costs a
+ *        single allocation shared with the reference counter). Class is final and the function is called directly, so the compiler may
+ *        inline its body into Run(). Function may take the parsed command alone, the parsed command and the output sink, or all of
+ *        them and the cancellation token.
+ */
+template <typename Function>
+class FunctionCommandHandler final : public CommandHandlerInterface
+{
+public:
+    static constexpr bool kTakesToken {std::is_invocable_v<Function&, const ParsedCommand&, OutputSink&, const CancellationToken&>};
+    static constexpr bool kTakesOutput {kTakesToken || std::is_invocable_v<Function&, const ParsedCommand&, OutputSink&>};
+
+    explicit FunctionCommandHandler(Function function)
+    : function_{std::move(function)}
+    {}
+
+    void Run(const ParsedCommand &command) override
+    {
+        if constexpr (kTakesOutput) {
+            OutputSink output {};
+
+            Run(command, output);
+        } else {
+            function_(command);
+        }
+    }
+    void Run(const ParsedCommand &command, OutputSink &output) override
+    {
+        if constexpr (kTakesToken) {
+            const CancellationToken cancellation_token {};
+
+            function_(command, output, cancellation_token);
+        } else if constexpr (kTakesOutput) {
+            function_(command, output);
+        } else {
+            function_(command);
+        }
+    }
+    void Run(const ParsedCommand &command, OutputSink &output, const CancellationToken &cancellation_token) override
+    {
+        if constexpr (kTakesToken) {
+            function_(command, output, cancellation_token);
+        } else {
+            Run(command, output);
+        }
+    }
+
+private:
+    Function function_;
+};
+
+/**
+ * @brief True for the types which may be registered as a command handler function (and are not command handler pointers themselves).
+ */
+template <typename Function>
+inline constexpr bool kIsCommandHandlerFunction {!std::is_convertible_v<Function, CommandHandlerPtr> &&
+                                                 (std::is_invocable_v<Function&, const ParsedCommand&, OutputSink&, const CancellationToken&> ||
+                                                  std::is_invocable_v<Function&, const ParsedCommand&, OutputSink&> ||
+                                                  std::is_invocable_v<Function&, const ParsedCommand&>)};
+
+} // comlint
\ No newline at end of file
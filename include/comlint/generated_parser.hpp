@@ -0,0 +1,328 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+
+#include "comlint/command_handler_interface.hpp"
+#include "comlint/command_line_tokenizer.hpp"
+#include "comlint/interface_helper.hpp"
+#include "comlint/output_sink.hpp"
+#include "comlint/parsed_command.hpp"
+#include "comlint/tracer.hpp"
+#include "comlint/utils.hpp"
+#include "comlint/exceptions/forbidden_flag.hpp"
+#include "comlint/exceptions/forbidden_option.hpp"
+#include "comlint/exceptions/forbidden_option_value.hpp"
+#include "comlint/exceptions/invalid_command_position.hpp"
+#include "comlint/exceptions/missing_command_handler.hpp"
+#include "comlint/exceptions/missing_command_value.hpp"
+#include "comlint/exceptions/missing_option_value.hpp"
+#include "comlint/exceptions/missing_required_option.hpp"
+#include "comlint/exceptions/unsupported_command.hpp"
+#include "comlint/exceptions/unsupported_command_value.hpp"
+#include "comlint/exceptions/unsupported_flag.hpp"
+#include "comlint/exceptions/unsupported_option.hpp"
+
+namespace comlint {
+
+/**
+ * @brief Range of indexes of Interface::kStrings.
+ */
+struct GeneratedRange
+{
+    std::uint32_t begin;
+    std::uint32_t end;
+};
+
+/**
+ * @brief Parser of an interface generated at build time from its schema (see comlint_generate_help CMake function). Names are resolved
+ *        by the generated switch statements and all the properties of the elements are constant tables, so there is no registration
+ *        phase and no map is searched while parsing. Parsed command and all the errors are the same as the ones of
+ *        CommandLineInterface::Parse() for the interface declared with the same elements.
+ *        Interface is the generated structure providing:
+ *          - kNumOfCommands, kNumOfOptions and kNumOfFlags,
+ *          - kCommandNames, kOptionNames and kFlagNames, sorted in the same way as the names in CommandLineInterface,
+ *          - FindCommand, FindOption and FindFlag, returning index of the name or kNoIndex,
+ *          - kNumOfRequiredValues, kCommandAllowedValues, kRequiredOptions, kAllowedOptions and kAllowedFlags of every command,
+ *          - kOptionAllowedValues, kDefaultValues and kEnvironmentVariables of every option,
+ *          - kStrings, referenced by all the ranges, and kHelp.
+ */
+template <typename Interface>
+class GeneratedParser
+{
+public:
+    using Command = typename Interface::Command;
+    using CommandHandlers = std::array<CommandHandlerPtr, Interface::kNumOfCommands>;
+
+    static constexpr std::uint32_t kNoIndex {Interface::kNoIndex};
+
+    static ParsedCommand Parse(const int argc, char** argv)
+    {
+        OutputSink output {};
+
+        return Parse(argc, argv, output);
+    }
+    /**
+     * @brief: Same as Parse(argc, argv), but help prompt (if requested) is written to the given output sink instead of standard output.
+     */
+    static ParsedCommand Parse(const int argc, char** argv, OutputSink &output);
+    /**
+     * @brief: Returns enumerator of the parsed command, or Command::kNone if no command has been given.
+     */
+    static Command GetCommand(const ParsedCommand &parsed_command)
+    {
+        return static_cast<Command>(Interface::FindCommand(parsed_command.name));
+    }
+    /**
+     * @brief: Parses the command line and runs handler of the parsed command, found by its enumerator in the given array.
+     */
+    static void Run(const int argc, char** argv, const CommandHandlers &command_handlers, OutputSink &output);
+
+private:
+    static std::uint32_t ParseCommand(const unsigned int argc, char** argv, const unsigned int command_index, CommandValues &values);
+    static std::uint32_t ParseOption(const unsigned int argc, char** argv, const std::uint32_t command, const unsigned int option_index);
+    static std::uint32_t ParseFlag(char** argv, const std::uint32_t command, const unsigned int flag_index);
+    static bool IsValueAllowed(const GeneratedRange &allowed_values, const std::string_view value);
+    static std::string GetSimilarValues(const GeneratedRange &allowed_values, const std::string_view value);
+    static void ValidateOptionValue(const std::uint32_t option, const std::string_view value, const std::string &value_origin);
+};
+
+template <typename Interface>
+ParsedCommand GeneratedParser<Interface>::Parse(const int argc, char** argv, OutputSink &output)
+{
+    const unsigned int num_of_arguments = static_cast<unsigned int>(argc);
+    ParsedCommand parsed_command {};
+    std::array<bool, Interface::kNumOfOptions> used_options {};
+    std::array<bool, Interface::kNumOfFlags> used_flags {};
+    std::uint32_t command = kNoIndex;
+
+    // schema can't forbid running without arguments, which is allowed by default also in CommandLineInterface
+    if (InterfaceHelper::IsHelpRequired(num_of_arguments, argv, true)) {
+        output.Write(Interface::kHelp);
+        parsed_command.name = "help";
+        return parsed_command;
+    }
+
+    for (unsigned int i=1U; i<num_of_arguments; i++) {
+        const CommandLineElementType element_type = CommandLineTokenizer::GetElementType(argv[i], i == 1U);
+
+        if (element_type == CommandLineElementType::kCommand) {
+            command = ParseCommand(num_of_arguments, argv, i, parsed_command.values);
+            parsed_command.name = Interface::kCommandNames[command];
+        }
+        if (element_type == CommandLineElementType::kOption) {
+            const std::uint32_t option = ParseOption(num_of_arguments, argv, command, i);
+
+            if (!used_options[option]) {
+                parsed_command.options.emplace(Interface::kOptionNames[option], argv[i + 1U]);
+                used_options[option] = true;
+            }
+        }
+        if (element_type == CommandLineElementType::kFlag) {
+            const std::uint32_t flag = ParseFlag(argv, command, i);
+
+            if (flag != kNoIndex && !used_flags[flag]) {
+                parsed_command.flags.emplace(Interface::kFlagNames[flag], true);
+                used_flags[flag] = true;
+            }
+        }
+    }
+
+    for (std::uint32_t option=0U; option<Interface::kNumOfOptions; option++) {
+        const char *environment_variable = Interface::kEnvironmentVariables[option];
+
+        if (environment_variable == nullptr || used_options[option] || (command != kNoIndex && !Interface::kAllowedOptions[command][option])) {
+            continue;
+        }
+
+        const char *value = std::getenv(environment_variable);
+
+        if (value == nullptr) {
+            continue;
+        }
+
+        ValidateOptionValue(option, value, " (taken from environment variable " + std::string(environment_variable) + ")");
+        parsed_command.options.emplace(Interface::kOptionNames[option], value);
+        used_options[option] = true;
+    }
+    for (std::uint32_t option=0U; option<Interface::kNumOfOptions; option++) {
+        const std::string_view default_value = Interface::kDefaultValues[option];
+
+        if (default_value.empty() || used_options[option] || (command != kNoIndex && !Interface::kAllowedOptions[command][option])) {
+            continue;
+        }
+
+        parsed_command.options.emplace(Interface::kOptionNames[option], default_value);
+        used_options[option] = true;
+    }
+
+    if (command != kNoIndex) {
+        const GeneratedRange &required_options = Interface::kRequiredOptions[command];
+
+        for (std::uint32_t i=required_options.begin; i<required_options.end; i++) {
+            if (!utils::MapContainsKey(parsed_command.options, std::string(Interface::kStrings[i]))) {
+                throw MissingRequiredOption("Command " + parsed_command.name + " requires option " + std::string(Interface::kStrings[i]) +
+                                            ", but such option has not been provided!");
+            }
+        }
+    }
+
+    for (std::uint32_t flag=0U; flag<Interface::kNumOfFlags; flag++) {
+        if (!used_flags[flag]) {
+            parsed_command.flags.emplace_hint(parsed_command.flags.end(), Interface::kFlagNames[flag], false);
+        }
+    }
+
+    return parsed_command;
+}
+
+template <typename Interface>
+void GeneratedParser<Interface>::Run(const int argc, char** argv, const CommandHandlers &command_handlers, OutputSink &output)
+{
+    const std::unique_ptr<OutputSink> command_output = output.CreateChild();
+    const ParsedCommand parsed_command = Parse(argc, argv, *command_output);
+
+    if (parsed_command.name == "help") {
+        return;
+    }
+
+    const std::uint32_t command = Interface::FindCommand(parsed_command.name);
+
+    // handlers are indexed by the enumerators of the commands, so dispatch needs no lookup of the name
+    if (command == kNoIndex || !command_handlers[command]) {
+        throw MissingCommandHandler("Unable to run command handler for " + parsed_command.name + " command! No command handler has been added for this command.");
+    }
+
+    const TraceSpan trace_span(parsed_command.name, "handler");
+
+    command_handlers[command]->Run(parsed_command, *command_output);
+}
+
+template <typename Interface>
+std::uint32_t GeneratedParser<Interface>::ParseCommand(const unsigned int argc, char** argv, const unsigned int command_index, CommandValues &values)
+{
+    const std::string_view command_name = argv[command_index];
+    const std::uint32_t command = Interface::FindCommand(command_name);
+
+    if (command == kNoIndex) {
+        const std::string similar_commands = utils::GetSimilarValues(Interface::kCommandNames.begin(), Interface::kCommandNames.end(), command_name, "\n");
+
+        throw UnsupportedCommand("Command " + std::string(command_name) + " is not supported!" + InterfaceHelper::GetHint(similar_commands));
+    }
+    if (command_index != 1U) {
+        throw InvalidCommandPosition("Detected command " + std::string(command_name) + " is not directly after program name!");
+    }
+
+    const unsigned int num_of_required_values = Interface::kNumOfRequiredValues[command];
+
+    if (num_of_required_values == 0U) {
+        return command;
+    }
+
+    const CommandLineElementType next_element_type = command_index + 1U < argc ? CommandLineTokenizer::GetElementType(argv[command_index + 1U], false)
+                                                                               : CommandLineElementType::kCustomValue;
+
+    if (command_index + num_of_required_values >= argc || next_element_type == CommandLineElementType::kOption ||
+        next_element_type == CommandLineElementType::kFlag) {
+        throw MissingCommandValue("Command " + std::string(command_name) + " requires " + std::to_string(num_of_required_values) +
+                                  " value(s), but they were not provided!");
+    }
+
+    values.reserve(num_of_required_values);
+
+    for (unsigned int i=0U; i<num_of_required_values; i++) {
+        const std::string_view command_value = argv[command_index + i + 1U];
+
+        if (!IsValueAllowed(Interface::kCommandAllowedValues[command], command_value)) {
+            throw UnsupportedCommandValue("Unsupported value " + std::string(command_value) + " for " + std::string(command_name) + " command!" +
+                                          InterfaceHelper::GetHint(GetSimilarValues(Interface::kCommandAllowedValues[command], command_value)));
+        }
+
+        values.emplace_back(command_value);
+    }
+
+    return command;
+}
+
+template <typename Interface>
+std::uint32_t GeneratedParser<Interface>::ParseOption(const unsigned int argc, char** argv, const std::uint32_t command,
+                                                      const unsigned int option_index)
+{
+    const std::string_view option_name = argv[option_index];
+    const std::uint32_t option = Interface::FindOption(option_name);
+
+    if (option == kNoIndex) {
+        const std::string similar_options = utils::GetSimilarValues(Interface::kOptionNames.begin(), Interface::kOptionNames.end(), option_name, "\n");
+
+        throw UnsupportedOption("Option " + std::string(option_name) + " is not supported!" + InterfaceHelper::GetHint(similar_options));
+    }
+    if (option_index + 1U >= argc) {
+        throw MissingOptionValue("Option " + std::string(option_name) + " requires value, but no value has been provided!");
+    }
+    if (command != kNoIndex && !Interface::kAllowedOptions[command][option]) {
+        throw ForbiddenOption("Option " + std::string(option_name) + " is not allowed for " + std::string(Interface::kCommandNames[command]) +
+                              " command!");
+    }
+
+    ValidateOptionValue(option, argv[option_index + 1U], "");
+
+    return option;
+}
+
+template <typename Interface>
+std::uint32_t GeneratedParser<Interface>::ParseFlag(char** argv, const std::uint32_t command, const unsigned int flag_index)
+{
+    const std::string_view flag_name = argv[flag_index];
+    const std::uint32_t flag = Interface::FindFlag(flag_name);
+
+    // reserved flag is only skipped, tracing is started by Tracer::StartIfRequested
+    if (flag == kNoIndex && flag_name == Tracer::kTraceFlag) {
+        return kNoIndex;
+    }
+    if (flag == kNoIndex) {
+        const std::string similar_flags = utils::GetSimilarValues(Interface::kFlagNames.begin(), Interface::kFlagNames.end(), flag_name, "\n");
+
+        throw UnsupportedFlag("Flag " + std::string(flag_name) + " is not supported!" + InterfaceHelper::GetHint(similar_flags));
+    }
+    if (command != kNoIndex && !Interface::kAllowedFlags[command][flag]) {
+        throw ForbiddenFlag("Flag " + std::string(flag_name) + " is not allowed for " + std::string(Interface::kCommandNames[command]) + " command!");
+    }
+
+    return flag;
+}
+
+template <typename Interface>
+bool GeneratedParser<Interface>::IsValueAllowed(const GeneratedRange &allowed_values, const std::string_view value)
+{
+    if (allowed_values.begin == allowed_values.end) {
+        return true;
+    }
+
+    for (std::uint32_t i=allowed_values.begin; i<allowed_values.end; i++) {
+        if (Interface::kStrings[i] == value) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+template <typename Interface>
+std::string GeneratedParser<Interface>::GetSimilarValues(const GeneratedRange &allowed_values, const std::string_view value)
+{
+    return utils::GetSimilarValues(Interface::kStrings.begin() + allowed_values.begin, Interface::kStrings.begin() + allowed_values.end, value, "\n");
+}
+
+template <typename Interface>
+void GeneratedParser<Interface>::ValidateOptionValue(const std::uint32_t option, const std::string_view value, const std::string &value_origin)
+{
+    if (!IsValueAllowed(Interface::kOptionAllowedValues[option], value)) {
+        throw ForbiddenOptionValue("Given value " + std::string(value) + value_origin + " for option " + std::string(Interface::kOptionNames[option]) +
+                                   " is not allowed!" + InterfaceHelper::GetHint(GetSimilarValues(Interface::kOptionAllowedValues[option], value)));
+    }
+}
+
+} // comlint
\ No newline at end of file
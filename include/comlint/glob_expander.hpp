@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace comlint {
+
+/**
+ * @brief Whether values of a command or an option are glob patterns expanded by the library, and in which order their matches are given.
+ */
+enum class GlobExpansion : std::uint8_t
+{
+    kDisabled,
+    // matches are given as soon as they are found, so their order depends on the scheduling of the directory walk
+    kUnordered,
+    // matches are given in the same order in every run (by depth, then by path), which costs holding the matches of one depth level at once
+    kOrdered
+};
+
+using GlobMatchCallback = std::function<void(const std::string &path)>;
+// values recognised as glob patterns, mapped to the requested expansion
+using GlobPatterns = std::map<std::string, GlobExpansion>;
+
+namespace pmr {
+
+using GlobPatterns = std::pmr::map<std::pmr::string, GlobExpansion, std::less<>>;
+
+} // pmr
+
+/**
+ * @brief Expands glob patterns ("*", "?", "[...]" within a path segment and "**" matching any number of directories) without a shell.
+ *        Directories are walked level by level on the shared thread pool, one task per directory, and matches are streamed to the callback
+ *        instead of being collected, so memory usage depends on the width of the walked tree rather than on the number of matches. Path
+ *        segments are separated by "/" on every platform. As in shells, wildcards don't match names starting with ".", unless the segment
+ *        itself starts with ".".
+ */
+class GlobExpander
+{
+public:
+    /**
+     * @brief Returns true if the value contains an unescaped wildcard, i.e. if it needs to be expanded.
+     */
+    static bool IsPattern(const std::string_view value);
+    /**
+     * @brief Returns true if the name matches a single segment of a pattern (which contains no "/").
+     */
+    static bool MatchesSegment(const std::string_view segment, const std::string_view name);
+    /**
+     * @brief Calls callback for every existing path matching the pattern. Value which is not a pattern is given to the callback with its
+     *        escapes removed ("file\*.txt" gives "file*.txt").
+     *        With GlobExpansion::kUnordered the callback may be called from multiple threads, but never concurrently.
+     */
+    static void Expand(const std::string &pattern, const GlobExpansion glob_expansion, const GlobMatchCallback &callback);
+
+private:
+    // directory still to be walked and indices of the pattern segments its entries are matched against
+    struct PendingDirectory
+    {
+        std::string path;
+        std::vector<std::size_t> segments;
+    };
+    struct DirectoryEntry
+    {
+        std::string name;
+        bool is_directory;
+        bool is_symlink;
+    };
+    struct DirectoryMatches
+    {
+        std::vector<std::string> matches;
+        std::vector<PendingDirectory> subdirectories;
+    };
+
+    static void MatchEntry(const std::vector<std::string> &segments, const std::string &directory, const std::size_t segment,
+                           const DirectoryEntry &entry, DirectoryMatches &directory_matches);
+    static std::string JoinPath(const std::string &directory, const std::string &name);
+    static std::string Unescape(const std::string_view value);
+};
+
+} // comlint
\ No newline at end of file
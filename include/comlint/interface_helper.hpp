@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <map>
 
 #include "comlint/types.hpp"
@@ -10,23 +11,30 @@
 
 namespace comlint {
 
-using Commands = std::map<CommandName, CommandProperties>;
-using Options = std::map<OptionName, OptionProperties>;
-using Flags = std::map<FlagName, FlagProperties>;
+using Commands = std::pmr::map<pmr::CommandName, CommandProperties, std::less<>>;
+using Options = std::pmr::map<pmr::OptionName, OptionProperties, std::less<>>;
+using Flags = std::pmr::map<pmr::FlagName, FlagProperties, std::less<>>;
 
 class InterfaceHelper
 {
 public:
     static bool IsHelpRequired(const unsigned int argc, char** argv, const bool allow_no_args);
-    static std::string GetHelp(const std::string &program_name, const std::string &program_description, const Commands &commands,
+    static std::string GetHelp(const std::string_view program_name, const std::string_view program_description, const Commands &commands,
                                const Options &options, const Flags &flags);
     static std::string GetHint(const std::string &similar_values);
+    static std::string GetManPage(const std::string_view program_name, const std::string_view program_description, const Commands &commands,
+                                  const Options &options, const Flags &flags);
+    static std::string GetMarkdown(const std::string_view program_name, const std::string_view program_description, const Commands &commands,
+                                   const Options &options, const Flags &flags);
 
 private:
-    static std::string GetHelpHeader(const std::string &program_name, const std::string &program_description);
+    static std::string GetHelpHeader(const std::string_view program_name, const std::string_view program_description);
     static std::string GetCommandsHelp(const Commands &commands);
     static std::string GetOptionsHelp(const Options &options);
     static std::string GetFlagsHelp(const Flags &flags);
+    static std::string EscapeManText(const std::string_view text);
+    static std::string GetDictionarySummary(const ValueDictionary &dictionary);
+    static std::string GetGlobExpansionSummary(const GlobExpansion glob_expansion);
 };
 
 } // comlint
\ No newline at end of file
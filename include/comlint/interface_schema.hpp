@@ -0,0 +1,47 @@
+#pragma once
+
+#include <memory_resource>
+#include <string_view>
+
+#include "comlint/interface_helper.hpp"
+
+namespace comlint {
+
+/**
+ * @brief Declaration of the whole interface read from a schema file in INI format. It is used by build-time generators, which must know
+ *        the interface without running the program. Lists are separated with commas.
+ *        Example:
+ *                  [program]
+ *                  name = git
+ *                  description = Version control system
+ *                  [command:add]
+ *                  description = Add file contents to the index
+ *                  num_of_values = 1
+ *                  allowed_flags = --force
+ *                  [option:-m]
+ *                  description = Commit message
+ *                  allowed_values =
+ *                  default_value =
+ *                  environment_variable =
+ *                  [flag:--force]
+ *                  description = Allow adding otherwise ignored files
+ */
+struct InterfaceSchema
+{
+    using allocator_type = std::pmr::polymorphic_allocator<char>;
+
+    explicit InterfaceSchema(const allocator_type &allocator = {});
+
+    /**
+     * @brief Parses the schema, validating names of all the declared elements and all the keys used in the sections.
+     */
+    static InterfaceSchema Parse(const std::string_view content, std::pmr::memory_resource *memory_resource = std::pmr::get_default_resource());
+
+    std::pmr::string program_name;
+    std::pmr::string description;
+    Commands commands;
+    Options options;
+    Flags flags;
+};
+
+} // comlint
\ No newline at end of file
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "comlint/interface_helper.hpp"
+
+namespace comlint {
+
+enum class InvocationOutcome : std::uint8_t
+{
+    kParsed,
+    kHelp,
+    kFailed
+};
+
+/**
+ * @brief Single invocation of the program: its command line, the interface it was parsed with, what parsing resulted in and how long it
+ *        took. Run time is zero if the command handler was not run (Parse() was called, or parsing failed).
+ */
+struct InvocationRecord
+{
+    // hash of the declared interface (see InvocationLog::GetSchemaHash)
+    std::uint64_t schema_hash;
+    // command line without the program name
+    std::vector<std::string> arguments;
+    InvocationOutcome outcome;
+    // parsed command (see InvocationLog::GetResult) or message of the exception thrown by parsing
+    std::string result;
+    std::chrono::nanoseconds parse_time;
+    std::chrono::nanoseconds run_time;
+};
+
+bool operator==(const InvocationRecord &lhs, const InvocationRecord &rhs);
+
+/**
+ * @brief Binary log of invocations, used as a corpus of real command lines for benchmarks (see comlint_invocation_replayer). Every record
+ *        is appended with a single write, so concurrently running processes may record into the same file. Record layout (integers are
+ *        LEB128 varints, unless stated otherwise):
+ *                  marker byte 0xC1, size of the rest of the record,
+ *                  schema hash (8 bytes, little endian), outcome (1 byte), parse time [ns], run time [ns],
+ *                  number of arguments, then size and bytes of every argument, size and bytes of the result
+ */
+class InvocationLog
+{
+public:
+    static constexpr std::string_view kEnvironmentVariable {"COMLINT_RECORD"};
+    static constexpr std::uint8_t kRecordMarker {0xC1U};
+
+    static std::string Serialize(const InvocationRecord &record);
+    /**
+     * @brief Appends the record to the log file (created if it doesn't exist).
+     * @return: False if the record could not be written.
+     */
+    static bool Append(const std::string &log_path, const InvocationRecord &record);
+    /**
+     * @brief Reads all the records of the log. Throws InvalidInvocationLog if the content is not a sequence of complete records.
+     */
+    static std::vector<InvocationRecord> Read(const std::string_view content);
+    /**
+     * @brief Hash (64-bit FNV-1a) of everything which affects parsing: names of commands, options and flags, numbers of values, allowed and
+     *        required elements, default values, environment variables, checks of the values (dictionary paths, constraints, path
+     *        requirements, glob expansion), whether running without arguments and abbreviations are allowed and path of the configuration
+     *        file. Descriptions are not included, so rewording help doesn't make the recorded invocations incomparable, and neither are
+     *        contents of the dictionaries and of the configuration file.
+     */
+    static std::uint64_t GetSchemaHash(const Commands &commands, const Options &options, const Flags &flags, const bool allow_no_arguments,
+                                       const bool allow_abbreviations, const std::string_view config_file_path);
+    /**
+     * @brief Describes the parsed command in a single line: name, values, options with their values and the set flags.
+     */
+    template <typename ParsedCommandType>
+    static std::string GetResult(const ParsedCommandType &parsed_command);
+};
+
+template <typename ParsedCommandType>
+std::string InvocationLog::GetResult(const ParsedCommandType &parsed_command)
+{
+    std::string result(parsed_command.name);
+
+    for (const auto &value : parsed_command.values) {
+        result.append(" ").append(value);
+    }
+    for (const auto &[option_name, option_value] : parsed_command.options) {
+        result.append(" ").append(option_name).append("=").append(option_value);
+    }
+    for (const auto &[flag_name, is_set] : parsed_command.flags) {
+        if (is_set) {
+            result.append(" ").append(flag_name);
+        }
+    }
+
+    return result;
+}
+
+} // comlint
\ No newline at end of file
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+
+#include "comlint/command_handler_interface.hpp"
+
+namespace comlint {
+
+using CommandHandlerFactory = std::function<CommandHandlerPtr()>;
+
+/**
+ * @brief Command handler which creates the actual handler with the given factory when it's run for the first time, so handlers of the
+ *        commands which are not used are never constructed. If the factory throws, the exception is propagated and the next run tries
+ *        again. Factory returning nullptr makes the run throw InvalidCommandHandler.
+ */
+class LazyCommandHandler : public CommandHandlerInterface
+{
+public:
+    explicit LazyCommandHandler(CommandHandlerFactory command_handler_factory);
+
+    void Run(const ParsedCommand &command) final;
+    void Run(const ParsedCommand &command, OutputSink &output) final;
+    void Run(const ParsedCommand &command, OutputSink &output, const CancellationToken &cancellation_token) final;
+
+    bool IsCreated() const;
+
+private:
+    CommandHandlerInterface& GetHandler(const ParsedCommand &command);
+
+    CommandHandlerFactory command_handler_factory_;
+    std::once_flag creation_flag_;
+    CommandHandlerPtr command_handler_;
+    // set after the handler is created, so IsCreated() may be called concurrently with the first run
+    std::atomic<bool> is_created_;
+};
+
+} // comlint
\ No newline at end of file
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace comlint {
+
+/**
+ * @brief Read-only memory mapping of the whole file. Pages of the file are loaded by the operating system only when they are accessed.
+ *        If the file can't be opened or mapped, the mapping is empty and IsMapped() returns false.
+ */
+class MappedFile
+{
+public:
+    explicit MappedFile(const std::string &path);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool IsMapped() const;
+    std::string_view GetContent() const;
+
+private:
+    void Unmap();
+
+    bool is_mapped_;
+    const char* data_;
+    std::size_t size_;
+#ifdef _WIN32
+    void* file_handle_;
+    void* mapping_handle_;
+#else
+    int file_descriptor_;
+#endif
+};
+
+} // comlint
\ No newline at end of file
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+#include "comlint/command_properties.hpp"
+#include "comlint/option_properties.hpp"
+#include "comlint/flag_properties.hpp"
+
+namespace comlint {
+
+/**
+ * @brief Breakdown of the heap memory used by the interface, in bytes. Sizes are computed from capacities of the containers, so they
+ *        include unused capacity, but not bookkeeping of the memory resource. Strings short enough to be stored inline take no heap.
+ */
+struct MemoryFootprint
+{
+    std::size_t GetTotal() const;
+    MemoryFootprint& operator+=(const MemoryFootprint &other);
+
+    static MemoryFootprint GetCommandFootprint(const std::pmr::string &command_name, const CommandProperties &command_properties);
+    static MemoryFootprint GetOptionFootprint(const std::pmr::string &option_name, const OptionProperties &option_properties);
+    static MemoryFootprint GetFlagFootprint(const std::pmr::string &flag_name, const FlagProperties &flag_properties);
+    static std::size_t GetHeapSize(const std::pmr::string &string);
+    static std::size_t GetHeapSize(const std::pmr::vector<std::pmr::string> &strings);
+    /**
+     * @brief Returns size of the dictionary object with its path. Mapped content of the dictionary file is not on the heap, so it's not counted.
+     */
+    static std::size_t GetHeapSize(const ValueDictionaryPtr &dictionary);
+    static std::size_t GetHeapSize(const ValueConstraintPtr &constraint);
+    /**
+     * @brief Returns size of a single node of the map storing the given value type (red-black tree node holds three pointers and color).
+     */
+    template <typename ValueType>
+    static constexpr std::size_t GetMapNodeSize() { return sizeof(ValueType) + 4U * sizeof(void*); }
+
+    // names of the commands, options and flags (and the program name)
+    std::size_t names {0U};
+    // descriptions of the program, commands, options and flags
+    std::size_t descriptions {0U};
+    // lists of allowed values, options and flags, required options, default values and environment variable names
+    std::size_t allowed_values {0U};
+    // nodes of the maps and arrays used to find the elements
+    std::size_t lookup_indexes {0U};
+    // slots and references of command handlers (handler objects themselves are owned by the user)
+    std::size_t handlers {0U};
+};
+
+MemoryFootprint operator+(MemoryFootprint lhs, const MemoryFootprint &rhs);
+
+} // comlint
\ No newline at end of file
@@ -0,0 +1,170 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <typeinfo>
+#include <vector>
+
+namespace comlint {
+
+/**
+ * @brief Where and how often the metrics are written.
+ */
+struct MetricsSettings
+{
+    // file receiving the metrics in Prometheus text format (e.g. in the directory of node exporter's textfile collector), metrics are
+    // only kept in memory if it's empty
+    std::string path {};
+    // period of writing the metrics, they are written only when the collector is destroyed if it's zero
+    std::chrono::milliseconds write_interval {std::chrono::seconds(10)};
+    // whether every write appends a snapshot to the file (otherwise the file is atomically replaced with the current totals)
+    bool is_appending {false};
+};
+
+/**
+ * @brief Log-linear buckets of handler latencies in nanoseconds (in the manner of HDR histograms): every power of two is split into
+ *        kNumOfSubBuckets buckets, so a latency is known with a relative error below 1 / kNumOfSubBuckets whatever its magnitude.
+ *        Latencies of 2^kMaxExponent ns (about 73 minutes) and more fall into the last bucket.
+ */
+class LatencyHistogram
+{
+public:
+    static constexpr std::size_t kSubBucketBits {2U};
+    static constexpr std::size_t kNumOfSubBuckets {std::size_t{1U} << kSubBucketBits};
+    static constexpr std::size_t kMaxExponent {42U};
+    static constexpr std::size_t kNumOfBuckets {(kMaxExponent - kSubBucketBits + 1U) * kNumOfSubBuckets + 1U};
+
+    static std::size_t GetBucket(const std::uint64_t nanoseconds);
+    /**
+     * @brief Returns the smallest latency which doesn't fall into the bucket anymore (UINT64_MAX for the last bucket).
+     */
+    static std::uint64_t GetUpperBound(const std::size_t bucket);
+
+private:
+    static std::size_t GetExponent(const std::uint64_t value);
+};
+
+/**
+ * @brief Metrics of a single command gathered from all the threads.
+ */
+struct CommandMetrics
+{
+    /**
+     * @brief Returns the latency below which the given fraction (0.0 - 1.0) of the runs finished, rounded up to the bound of its bucket.
+     */
+    std::chrono::nanoseconds GetQuantile(const double fraction) const;
+
+    std::string name;
+    std::uint64_t num_of_runs;
+    // number of runs which have thrown, by demangled type of the exception
+    std::map<std::string, std::uint64_t> num_of_errors;
+    std::chrono::nanoseconds total_latency;
+    std::array<std::uint64_t, LatencyHistogram::kNumOfBuckets> latency_buckets;
+};
+
+/**
+ * @brief Collects number of runs, number of errors by exception type and latency histogram of every command. Every thread records into
+ *        its own shard of counters, which no other thread writes to, so recording is a few relaxed atomic loads and stores without any
+ *        lock or read-modify-write operation. Counters of a command are allocated by a thread only when it runs that command for the first
+ *        time. Commands may be added while the collector is in use, counters of the others are kept. Snapshot sums the shards of all the
+ *        threads (also of the threads which have already ended).
+ *        If the path of the metrics file is set, a background thread writes the metrics periodically and once more when the collector is
+ *        destroyed. Metrics of a process are its own totals, so counters start from zero in every process (Prometheus treats it as a
+ *        counter reset).
+ */
+class MetricsCollector
+{
+public:
+    // number of distinct exception types counted separately for a command in a single thread, the others are counted together
+    static constexpr std::size_t kMaxNumOfErrorTypes {8U};
+
+    MetricsCollector(const std::string &program_name, const std::vector<std::string> &command_names, const MetricsSettings &settings);
+    ~MetricsCollector();
+
+    MetricsCollector(const MetricsCollector&) = delete;
+    MetricsCollector& operator=(const MetricsCollector&) = delete;
+
+    /**
+     * @brief Records a single run of the command with the given index.
+     * @error_type: Type of the exception thrown by the handler, nullptr if it succeeded (typeid(void) for exceptions which don't derive
+     *             from std::exception).
+     */
+    void RecordRun(const std::uint32_t command, const std::chrono::nanoseconds latency, const std::type_info *error_type = nullptr);
+    std::vector<CommandMetrics> GetSnapshot() const;
+    /**
+     * @brief Returns metrics of all the commands which have been run, in Prometheus text exposition format.
+     */
+    std::string GetPrometheusText() const;
+    /**
+     * @brief Writes the metrics to the file given in the settings (does nothing if there is none).
+     */
+    void Write() const;
+    /**
+     * @brief Returns index of the command with the given name, adding it to the collected commands if it's not there yet. Commands are
+     *        never removed, so their indexes stay valid for the whole life of the collector.
+     */
+    std::uint32_t AddCommand(const std::string &command_name);
+
+private:
+    struct ErrorCounter
+    {
+        std::atomic<const std::type_info*> type {nullptr};
+        std::atomic<std::uint64_t> count {0U};
+    };
+    struct CommandCounters
+    {
+        std::atomic<std::uint64_t> num_of_runs {0U};
+        std::atomic<std::uint64_t> total_latency {0U};
+        std::array<std::atomic<std::uint64_t>, LatencyHistogram::kNumOfBuckets> latency_buckets {};
+        std::array<ErrorCounter, kMaxNumOfErrorTypes> errors {};
+        std::atomic<std::uint64_t> num_of_other_errors {0U};
+    };
+    struct CounterTable
+    {
+        explicit CounterTable(const std::size_t size);
+
+        std::size_t size;
+        std::unique_ptr<std::atomic<CommandCounters*>[]> commands;
+    };
+    struct Shard
+    {
+        explicit Shard(const std::size_t num_of_commands);
+
+        // replaced by a bigger table when the thread runs a command added after the table was created
+        std::atomic<CounterTable*> table;
+        // all the tables of the shard, replaced ones are kept as a snapshot may still be reading them
+        std::vector<std::unique_ptr<CounterTable>> tables;
+    };
+
+    Shard& GetShard();
+    static CounterTable& GrowTable(Shard &shard, const std::size_t min_size);
+    void RunWriter();
+
+    static std::string GetTypeName(const std::type_info &type);
+    // counters are written by a single thread only, so there is no need for an atomic increment
+    static void Increment(std::atomic<std::uint64_t> &counter, const std::uint64_t value = 1U);
+
+    const std::uint64_t id_;
+    const std::string program_name_;
+    std::vector<std::string> command_names_;
+    const MetricsSettings settings_;
+    // shards of all the threads which have recorded anything, guarded by the mutex only when a thread records for the first time, and
+    // names of the commands
+    mutable std::mutex shards_mutex_;
+    std::map<std::thread::id, std::unique_ptr<Shard>> shards_;
+    mutable std::mutex write_mutex_;
+    std::mutex writer_mutex_;
+    std::condition_variable writer_stopped_;
+    bool is_writer_stopping_;
+    std::thread writer_;
+};
+
+} // comlint
\ No newline at end of file
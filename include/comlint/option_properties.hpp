@@ -2,21 +2,60 @@
 
 #include <string>
 
+#include "comlint/glob_expander.hpp"
+#include "comlint/path_metadata.hpp"
 #include "comlint/types.hpp"
+#include "comlint/value_constraint.hpp"
+#include "comlint/value_dictionary.hpp"
 
 namespace comlint {
 
 struct OptionProperties
 {
-    OptionProperties(const std::string &description, const OptionValues &allowed_values, const OptionValue &default_value)
-    : description{description},
-      allowed_values{allowed_values},
-      default_value{default_value}
+    using allocator_type = std::pmr::polymorphic_allocator<char>;
+
+    OptionProperties(const std::string &description, const OptionValues &allowed_values, const OptionValue &default_value,
+                     const std::string &environment_variable = "", const allocator_type &allocator = {})
+    : description(description, allocator),
+      allowed_values(allowed_values.begin(), allowed_values.end(), allocator),
+      default_value(default_value, allocator),
+      environment_variable(environment_variable, allocator)
+    {}
+    OptionProperties(const OptionProperties &other) = default;
+    OptionProperties(OptionProperties &&other) = default;
+    OptionProperties(const OptionProperties &other, const allocator_type &allocator)
+    : description(other.description, allocator),
+      allowed_values(other.allowed_values, allocator),
+      default_value(other.default_value, allocator),
+      environment_variable(other.environment_variable, allocator),
+      allowed_values_dictionary(other.allowed_values_dictionary),
+      value_constraint(other.value_constraint),
+      path_requirement(other.path_requirement),
+      glob_expansion(other.glob_expansion)
+    {}
+    OptionProperties(OptionProperties &&other, const allocator_type &allocator)
+    : description(std::move(other.description), allocator),
+      allowed_values(std::move(other.allowed_values), allocator),
+      default_value(std::move(other.default_value), allocator),
+      environment_variable(std::move(other.environment_variable), allocator),
+      allowed_values_dictionary(std::move(other.allowed_values_dictionary)),
+      value_constraint(std::move(other.value_constraint)),
+      path_requirement(other.path_requirement),
+      glob_expansion(other.glob_expansion)
     {}
 
-    std::string description;
-    OptionValues allowed_values;
-    OptionValue default_value;
+    std::pmr::string description;
+    pmr::OptionValues allowed_values;
+    pmr::OptionValue default_value;
+    std::pmr::string environment_variable;
+    // external dictionary of allowed values, checked in addition to allowed_values
+    ValueDictionaryPtr allowed_values_dictionary;
+    // constraint which every value must satisfy, regardless of the lists of allowed values
+    ValueConstraintPtr value_constraint;
+    // requirements which every value must meet as a path, checked for all the values at once after parsing
+    PathRequirement path_requirement {PathRequirement::kNone};
+    // whether values are glob patterns expanded by ParsedCommand::ForEachPath
+    GlobExpansion glob_expansion {GlobExpansion::kDisabled};
 };
 
 } // comlint
\ No newline at end of file
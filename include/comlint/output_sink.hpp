@@ -0,0 +1,99 @@
+#pragma once
+
+#include <charconv>
+#include <cstddef>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace comlint {
+
+/**
+ * @brief Buffered destination of the output of command handlers and of the library itself (help prompt). Text is collected in a large
+ *        buffer and written to the stream only when the buffer is full, when Flush() is called or when the sink is destroyed, so a handler
+ *        printing many lines doesn't make a system call per line. Output of child sinks (one per handler invocation) is merged into the
+ *        parent in the order in which the children were created, so output of handlers running concurrently is never interleaved: the
+ *        eldest child which is not closed yet passes its output to the parent whenever it's flushed or its buffer is full, while the
+ *        younger ones keep their output until it's their turn. Writing to a std::ostringstream captures the output instead of printing it.
+ */
+class OutputSink
+{
+public:
+    static constexpr std::size_t kDefaultBufferSize {64U * 1024U};
+
+    /**
+     * @brief Creates sink writing to the given stream. Buffer is allocated on the first write, so an unused sink costs no allocation.
+     */
+    explicit OutputSink(std::ostream &stream = std::cout, const std::size_t buffer_size = kDefaultBufferSize);
+    /**
+     * @brief Closes child sink or flushes root sink. Children have to be destroyed before their parent.
+     */
+    ~OutputSink();
+
+    OutputSink(const OutputSink&) = delete;
+    OutputSink& operator=(const OutputSink&) = delete;
+
+    void Write(const std::string_view text);
+    /**
+     * @brief Writes buffered text to the stream and flushes the stream. Child sink passes its text to the parent and flushes it only if
+     *        all the children created before it are already closed, otherwise it keeps the text until it's its turn.
+     */
+    void Flush();
+    /**
+     * @brief Creates child sink whose output is merged into this one after all the children created before it are closed.
+     */
+    std::unique_ptr<OutputSink> CreateChild();
+    /**
+     * @brief Hands output of the child sink over to its parent. Further writes to the closed sink are ignored.
+     */
+    void Close();
+
+    OutputSink& operator<<(const std::string_view text)
+    {
+        Write(text);
+        return *this;
+    }
+    OutputSink& operator<<(const char character)
+    {
+        Write(std::string_view(&character, 1U));
+        return *this;
+    }
+    template <typename Number, typename = std::enable_if_t<std::is_arithmetic_v<Number> && !std::is_same_v<Number, char> &&
+                                                           !std::is_same_v<Number, bool>>>
+    OutputSink& operator<<(const Number number)
+    {
+        char text[64U] {};
+        const auto result = std::to_chars(text, text + sizeof(text), number);
+
+        Write(std::string_view(text, static_cast<std::size_t>(result.ptr - text)));
+        return *this;
+    }
+
+private:
+    OutputSink(OutputSink &parent, const std::size_t sequence_number);
+
+    void Append(const std::string_view text);
+    void FlushBuffer();
+    void FlushStream();
+    void PassToParent(const bool flush);
+    bool AppendFromChild(const std::size_t sequence_number, const std::string_view text, const bool flush);
+    void MergeChild(const std::size_t sequence_number, std::string &&text);
+
+    std::mutex mutex_;
+    std::ostream *stream_;
+    OutputSink *parent_;
+    std::size_t sequence_number_;
+    std::size_t buffer_size_;
+    std::string buffer_;
+    bool is_closed_;
+    std::size_t next_child_sequence_number_;
+    std::size_t next_merged_sequence_number_;
+    // output of children closed before some of their elder siblings, waiting for their turn to be merged
+    std::map<std::size_t, std::string> closed_children_;
+};
+
+} // comlint
\ No newline at end of file
@@ -1,7 +1,10 @@
 #pragma once
 
 #include <map>
+#include <string_view>
 
+#include "comlint/glob_expander.hpp"
+#include "comlint/path_metadata.hpp"
 #include "comlint/types.hpp"
 
 namespace comlint {
@@ -12,13 +15,53 @@ struct ParsedCommand
     ParsedCommand(const CommandName &name, const CommandValues &values, const OptionsMap &options, const FlagsMap &flags);
 
     bool IsOptionUsed(const OptionName &option_name) const;
+    /**
+     * @brief Calls callback with the value itself or, if the value is a glob pattern of an element with glob expansion, with every path
+     *        matching the pattern. Matches are streamed while the directories are walked, so they are never all held in memory.
+     */
+    void ForEachPath(const std::string_view value, const GlobMatchCallback &callback) const;
 
     CommandName name;
     CommandValues values;
     OptionsMap options;
     FlagsMap flags;
+    // metadata of the values which have path requirements, gathered while checking them (not compared by operator==)
+    PathsMetadata paths;
+    // values which are glob patterns to be expanded with ForEachPath (not compared by operator==)
+    GlobPatterns globs;
 };
 
 bool operator==(const ParsedCommand &lhs, const ParsedCommand &rhs);
 
+namespace pmr {
+
+/**
+ * @brief Counterpart of comlint::ParsedCommand which allocates its name, values, options and flags from a std::pmr::memory_resource.
+ *        Releasing the memory resource releases the whole parsed command at once.
+ */
+struct ParsedCommand
+{
+    using allocator_type = std::pmr::polymorphic_allocator<char>;
+
+    explicit ParsedCommand(const allocator_type &allocator = {});
+    ParsedCommand(const ParsedCommand &other) = default;
+    ParsedCommand(ParsedCommand &&other) = default;
+    ParsedCommand(const ParsedCommand &other, const allocator_type &allocator);
+    ParsedCommand(ParsedCommand &&other, const allocator_type &allocator);
+
+    allocator_type get_allocator() const;
+    bool IsOptionUsed(const std::string_view option_name) const;
+    void ForEachPath(const std::string_view value, const GlobMatchCallback &callback) const;
+
+    CommandName name;
+    CommandValues values;
+    OptionsMap options;
+    FlagsMap flags;
+    PathsMetadata paths;
+    GlobPatterns globs;
+};
+
+bool operator==(const ParsedCommand &lhs, const ParsedCommand &rhs);
+
+} // pmr
 } // comlint
\ No newline at end of file
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "comlint/interface_schema.hpp"
+
+namespace comlint {
+
+/**
+ * @brief Generator of C++ sources from an interface schema, used by comlint_help_generator. Generated parser header defines
+ *        comlint::generated::[name]::Interface with constant tables of all the declared elements and switch statements resolving their
+ *        names, and comlint::generated::[name]::Parser (see comlint/generated_parser.hpp). It includes [name]_help.hpp generated next
+ *        to it, so the help prompt is rendered only once.
+ */
+class ParserGenerator
+{
+public:
+    static std::string GetParserHeader(const InterfaceSchema &schema, const std::string_view name, const std::string_view schema_file_name);
+    /**
+     * @brief Returns valid C++ identifier made of the name, with all the other characters replaced with "_".
+     */
+    static std::string GetIdentifier(const std::string_view name);
+    /**
+     * @brief Returns C++ string literal of the text, split into one literal per line.
+     */
+    static std::string GetStringLiteral(const std::string_view text);
+
+private:
+    /**
+     * @brief Returns enumerator name of the element, e.g. "kCommitAll" for "commit-all". Enumerators which would repeat get index of the
+     *        element appended.
+     */
+    static std::vector<std::string> GetEnumerators(const std::vector<std::string_view> &names);
+    /**
+     * @brief Returns body of a function finding index of the name: switch over the length of the name, and inside of it a switch over the
+     *        character which differs the most between the names of that length, so only names which can still match are compared.
+     */
+    static std::string GetLookup(const std::vector<std::string_view> &names);
+    static std::string GetCharacterLiteral(const char character);
+};
+
+} // comlint
\ No newline at end of file
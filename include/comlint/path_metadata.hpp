@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory_resource>
+#include <string>
+
+namespace comlint {
+
+enum class PathType : std::uint8_t
+{
+    kNotFound,
+    kFile,
+    kDirectory,
+    kOther
+};
+
+/**
+ * @brief Requirements which values of a command or an option must meet as paths. Requirements may be combined with "|".
+ */
+enum class PathRequirement : std::uint8_t
+{
+    kNone = 0U,
+    kExists = 1U << 0U,
+    kFile = 1U << 1U,
+    kDirectory = 1U << 2U,
+    kReadable = 1U << 3U
+};
+
+constexpr PathRequirement operator|(const PathRequirement lhs, const PathRequirement rhs)
+{
+    return static_cast<PathRequirement>(static_cast<std::uint8_t>(lhs) | static_cast<std::uint8_t>(rhs));
+}
+
+constexpr bool HasRequirement(const PathRequirement requirements, const PathRequirement requirement)
+{
+    return (static_cast<std::uint8_t>(requirements) & static_cast<std::uint8_t>(requirement)) != 0U;
+}
+
+/**
+ * @brief Information about a path, gathered while its requirements were checked, so that command handlers don't need to query the file
+ *        system again.
+ */
+struct PathMetadata
+{
+    PathType type {PathType::kNotFound};
+    bool is_readable {false};
+    std::uint64_t size {0U};
+    // seconds since Unix epoch
+    std::int64_t modification_time {0};
+};
+
+using PathsMetadata = std::map<std::string, PathMetadata>;
+
+namespace pmr {
+
+using PathsMetadata = std::pmr::map<std::pmr::string, PathMetadata, std::less<>>;
+
+} // pmr
+} // comlint
\ No newline at end of file
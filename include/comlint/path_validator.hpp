@@ -0,0 +1,49 @@
+#pragma once
+
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "comlint/path_metadata.hpp"
+
+namespace comlint {
+
+/**
+ * @brief Single path to be checked, together with the element (command or option) whose value it is.
+ */
+struct PathCheck
+{
+    std::string_view path;
+    PathRequirement requirement;
+    std::string_view element_name;
+    bool is_option_value;
+};
+
+using PathChecks = std::pmr::vector<PathCheck>;
+using CheckedPaths = std::pmr::vector<std::pair<std::string_view, PathMetadata>>;
+
+class PathValidator
+{
+public:
+    /**
+     * @brief Queries the file system about every distinct path once, running the queries concurrently on the shared thread pool, and then
+     *        checks all the requirements. If any of them is not met, throws InvalidPath listing all the failed checks. Otherwise returns
+     *        metadata of the distinct paths, sorted by path.
+     */
+    static CheckedPaths Validate(const PathChecks &path_checks, std::pmr::memory_resource *memory_resource = std::pmr::get_default_resource());
+    /**
+     * @brief Returns metadata of a single path. Readability is checked only if it's requested, as it needs another system call.
+     */
+    static PathMetadata GetMetadata(const std::string &path, const bool check_readability);
+    /**
+     * @brief Returns human readable description of the requirement, e.g. "existing readable file".
+     */
+    static std::string GetDescription(const PathRequirement requirement);
+
+private:
+    static std::string GetViolation(const PathCheck &path_check, const PathMetadata &path_metadata);
+};
+
+} // comlint
\ No newline at end of file
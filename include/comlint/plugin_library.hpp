@@ -0,0 +1,35 @@
+#pragma once
+
+#include <string>
+
+#include "comlint/lazy_command_handler.hpp"
+
+#ifdef _WIN32
+#define COMLINT_PLUGIN_EXPORT extern "C" __declspec(dllexport)
+#else
+#define COMLINT_PLUGIN_EXPORT extern "C" __attribute__((visibility("default")))
+#endif
+
+/**
+ * @brief Defines function with the given name which creates the given command handler, to be loaded from a shared library with
+ *        CommandLineInterface::AddCommandHandlerPlugin (e.g. COMLINT_EXPORT_COMMAND_HANDLER(create_commit_handler, CommitCommandHandler)).
+ */
+#define COMLINT_EXPORT_COMMAND_HANDLER(symbol_name, CommandHandlerType) \
+    COMLINT_PLUGIN_EXPORT comlint::CommandHandlerInterface* symbol_name() { return new CommandHandlerType(); }
+
+namespace comlint {
+
+using PluginCommandHandlerCreator = CommandHandlerInterface* (*)();
+
+class PluginLibrary
+{
+public:
+    /**
+     * @brief Returns factory which loads the shared library, finds the given function (defined with COMLINT_EXPORT_COMMAND_HANDLER) and
+     *        calls it. Nothing is loaded until the factory is called. The library stays loaded as long as the created handler exists.
+     *        If the library can't be loaded or it has no such function, the factory throws InvalidCommandHandler.
+     */
+    static CommandHandlerFactory GetHandlerFactory(const std::string &library_path, const std::string &symbol_name);
+};
+
+} // comlint
\ No newline at end of file
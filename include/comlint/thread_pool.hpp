@@ -0,0 +1,64 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace comlint {
+
+/**
+ * @brief Fixed set of worker threads executing batches of independent tasks. The thread which submits a batch also executes its tasks,
+ *        so a batch completes even if all the workers are busy with other batches.
+ */
+class ThreadPool
+{
+public:
+    explicit ThreadPool(const std::size_t num_of_threads);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief Returns pool shared by the whole library, created when it is used for the first time. As it's meant for tasks which mostly
+     *        wait for the operating system (e.g. file system queries), it has twice as many threads as there are hardware threads.
+     */
+    static ThreadPool& GetShared();
+
+    /**
+     * @brief Calls task(i) for every i in [0, num_of_tasks) and waits until all the calls finish. If any of the calls throws, the first
+     *        exception is rethrown after the remaining tasks finish.
+     */
+    void ParallelFor(const std::size_t num_of_tasks, const std::function<void(std::size_t)> &task);
+
+    std::size_t GetNumOfThreads() const;
+
+private:
+    struct Batch
+    {
+        const std::function<void(std::size_t)> *task;
+        std::size_t num_of_tasks;
+        std::size_t next_task;
+        std::size_t num_of_finished_tasks;
+        std::exception_ptr exception;
+        std::condition_variable finished;
+    };
+
+    void RunWorker();
+    // executes tasks of the batch until there are no more of them to take, must be called with the lock held
+    void RunTasks(Batch &batch, std::unique_lock<std::mutex> &lock);
+
+    std::mutex mutex_;
+    std::condition_variable has_batches_;
+    std::deque<Batch*> batches_;
+    bool is_stopping_;
+    std::vector<std::thread> threads_;
+};
+
+} // comlint
\ No newline at end of file
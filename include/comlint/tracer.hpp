@@ -0,0 +1,120 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace comlint {
+
+/**
+ * @brief Records timeline of the process in Chrome Trace Event format (viewable in chrome://tracing or Perfetto). Recording is started
+ *        when CommandLineInterface is constructed with COMLINT_TRACE environment variable set (to the path of the trace file) or with the
+ *        reserved --comlint-trace flag on the command line (trace written to comlint_trace.json), or explicitly with Start(). Parsers
+ *        only skip the reserved flag, so parsing has no side effects. Trace is written when Stop() is called or when the process exits. When recording is off, spans only
+ *        check a single flag and never allocate.
+ */
+class Tracer
+{
+public:
+    static constexpr std::string_view kEnvironmentVariable {"COMLINT_TRACE"};
+    static constexpr std::string_view kTraceFlag {"--comlint-trace"};
+    static constexpr std::string_view kDefaultTracePath {"comlint_trace.json"};
+    static constexpr std::int64_t kNoTime {-1};
+
+    /**
+     * @brief Starts recording (or changes path of the trace file if it's already started).
+     */
+    static void Start(const std::string &trace_path);
+    /**
+     * @brief Stops recording and writes all the recorded events to the trace file. Does nothing if recording is not started.
+     */
+    static void Stop();
+    static bool IsEnabled();
+    /**
+     * @brief Starts recording if it's requested by the environment variable or by the reserved flag among the arguments.
+     */
+    static void StartIfRequested(const int argc, char** argv);
+    /**
+     * @brief Returns nanoseconds elapsed since the tracer has been used for the first time.
+     */
+    static std::int64_t GetTime();
+    static void RecordSpan(const std::string_view name, const std::string_view category, const std::int64_t begin, const std::int64_t end);
+};
+
+/**
+ * @brief Records time spent in the enclosing scope as a single span. Name and category are not copied until the span ends, so they must
+ *        outlive it. May be used in command handlers to add their own spans to the timeline.
+ */
+class TraceSpan
+{
+public:
+    explicit TraceSpan(const std::string_view name, const std::string_view category = "user")
+    : name_{name},
+      category_{category},
+      begin_{Tracer::IsEnabled() ? Tracer::GetTime() : Tracer::kNoTime}
+    {}
+    ~TraceSpan()
+    {
+        if (begin_ != Tracer::kNoTime) {
+            Tracer::RecordSpan(name_, category_, begin_, Tracer::GetTime());
+        }
+    }
+
+    TraceSpan(const TraceSpan&) = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+
+private:
+    std::string_view name_;
+    std::string_view category_;
+    std::int64_t begin_;
+};
+
+/**
+ * @brief Joins consecutive calls of the same kind (e.g. a run of AddOption calls) into a single span, recorded when a call of another kind
+ *        is made or when the batch is closed.
+ */
+class TraceBatch
+{
+public:
+    ~TraceBatch()
+    {
+        Close();
+    }
+
+    void Extend(const std::string_view name, const std::int64_t begin);
+    void Close();
+
+private:
+    std::string_view name_ {};
+    std::int64_t begin_ {Tracer::kNoTime};
+    std::int64_t end_ {Tracer::kNoTime};
+};
+
+/**
+ * @brief Extends the batch with the time spent in the enclosing scope.
+ */
+class TraceBatchScope
+{
+public:
+    TraceBatchScope(TraceBatch &batch, const std::string_view name)
+    : batch_{batch},
+      name_{name},
+      begin_{Tracer::IsEnabled() ? Tracer::GetTime() : Tracer::kNoTime}
+    {}
+    ~TraceBatchScope()
+    {
+        if (begin_ != Tracer::kNoTime) {
+            batch_.Extend(name_, begin_);
+        }
+    }
+
+    TraceBatchScope(const TraceBatchScope&) = delete;
+    TraceBatchScope& operator=(const TraceBatchScope&) = delete;
+
+private:
+    TraceBatch &batch_;
+    std::string_view name_;
+    std::int64_t begin_;
+};
+
+} // comlint
\ No newline at end of file
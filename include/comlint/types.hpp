@@ -2,6 +2,8 @@
 
 #include <string>
 #include <vector>
+#include <map>
+#include <memory_resource>
 
 namespace comlint {
 
@@ -22,4 +24,25 @@ using FlagsMap = std::map<FlagName, bool>;
 static const std::vector<std::string> ANY {};
 static const std::vector<std::string> NONE {};
 
+/**
+ * Variants of the above types which allocate from a user provided std::pmr::memory_resource. Maps use transparent comparator, so
+ * they may be searched with std::string_view without constructing a temporary key.
+ */
+namespace pmr {
+
+using CommandName = std::pmr::string;
+using OptionName = std::pmr::string;
+using FlagName = std::pmr::string;
+
+using OptionNames = std::pmr::vector<OptionName>;
+using FlagNames = std::pmr::vector<FlagName>;
+
+using CommandValue = std::pmr::string;
+using CommandValues = std::pmr::vector<CommandValue>;
+using OptionValue = std::pmr::string;
+using OptionValues = std::pmr::vector<OptionValue>;
+using OptionsMap = std::pmr::map<OptionName, OptionValue, std::less<>>;
+using FlagsMap = std::pmr::map<FlagName, bool, std::less<>>;
+
+} // pmr
 } // comlint
\ No newline at end of file
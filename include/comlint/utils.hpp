@@ -1,15 +1,40 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <map>
+#include <memory_resource>
 #include <algorithm>
+#include <type_traits>
 
 namespace comlint {
 namespace utils {
 
 std::string VectorToString(const std::vector<std::string> &vector, const std::string &delimiter = "", const std::string &opening_string = "", const std::string &closing_string = "");
-std::string GetSimilarValues(const std::vector<std::string> &vector, const std::string &value, const std::string &delimiter = "");
+std::string VectorToString(const std::pmr::vector<std::pmr::string> &vector, const std::string &delimiter = "", const std::string &opening_string = "", const std::string &closing_string = "");
+std::string GetSimilarValues(const std::vector<std::string> &vector, const std::string_view value, const std::string &delimiter = "");
+std::string GetSimilarValues(const std::pmr::vector<std::pmr::string> &vector, const std::string_view value, const std::string &delimiter = "");
+
+template <typename IteratorType>
+std::string GetSimilarValues(IteratorType first, IteratorType last, const std::string_view value, const std::string &delimiter = "")
+{
+    std::string similar_values {};
+
+    for (auto element = first; element != last; element++) {
+        if (element->find(value) != std::string::npos || value.find(*element) != std::string::npos) {
+            similar_values.append(*element).append(delimiter);
+        }
+    }
+
+    return similar_values.empty() ? similar_values : similar_values.substr(0U, similar_values.size() - delimiter.size());
+}
+
+template <typename CompareType, typename = void>
+struct IsTransparentCompare : std::false_type {};
+
+template <typename CompareType>
+struct IsTransparentCompare<CompareType, std::void_t<typename CompareType::is_transparent>> : std::true_type {};
 
 template <typename MapType>
 bool AreMapsEqual(const MapType &lhs, const MapType &rhs)
@@ -27,40 +52,48 @@ bool AreMapsEqual(const MapType &lhs, const MapType &rhs)
     return true;
 }
 
-template <typename MapType>
-bool MapContainsKey(const MapType &map, const typename MapType::key_type &key)
+template <typename MapType, typename KeyType = typename MapType::key_type>
+bool MapContainsKey(const MapType &map, const KeyType &key)
 {
-    return map.find(key) != map.end();
+    if constexpr (IsTransparentCompare<typename MapType::key_compare>::value) {
+        return map.find(std::string_view(key)) != map.end();
+    }
+    else if constexpr (std::is_convertible_v<const KeyType&, const typename MapType::key_type&>) {
+        return map.find(key) != map.end();
+    }
+    else {
+        return map.find(typename MapType::key_type(key)) != map.end();
+    }
 }
 
-template <typename ValueType>
-std::string MapKeysToString(const std::map<std::string, ValueType> &map, const std::string &delimiter = "")
+template <typename MapType>
+std::string MapKeysToString(const MapType &map, const std::string &delimiter = "")
 {
     std::string keys {};
 
     for (const auto &[key, value] : map) {
-        keys += key + delimiter;
+        keys.append(key).append(delimiter);
     }
 
     return keys.substr(0U, keys.size() - delimiter.size());
 }
 
-template <typename ValueType>
-std::string GetSimilarKeys(const std::map<std::string, ValueType> &map, const std::string &value, const std::string &delimiter = "")
+template <typename MapType>
+std::string GetSimilarKeys(const MapType &map, const std::string_view value, const std::string &delimiter = "")
 {
     std::string similar_values {};
 
     for (const auto &[key, map_value] : map) {
         if (key.find(value) != std::string::npos || value.find(key) != std::string::npos) {
-            similar_values += key + delimiter;
+            similar_values.append(key).append(delimiter);
         }
     }
 
     return similar_values.empty() ? similar_values : similar_values.substr(0U, similar_values.size() - delimiter.size());
 }
 
-template <typename VectorType>
-bool VectorContainsElement(const VectorType &vector, const typename VectorType::value_type &element)
+template <typename VectorType, typename ElementType = typename VectorType::value_type>
+bool VectorContainsElement(const VectorType &vector, const ElementType &element)
 {
     return std::find(vector.begin(), vector.end(), element) != vector.end();
 }
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace comlint {
+
+/**
+ * @brief Constraint which the value of a command or an option must satisfy. Constraints are compiled when they are created, so checking
+ *        a value takes time proportional to its length, never backtracks and never allocates memory:
+ *        - integer range is checked by parsing the value as a decimal integer (optionally preceded by "-"),
+ *        - pattern (regular expression matching the whole value) is compiled into a deterministic finite automaton, whose input bytes are
+ *          grouped into classes of bytes which are never distinguished by the pattern.
+ *        Supported pattern syntax: literal characters, ".", character classes ("[a-z_]", "[^0-9]"), escapes ("\d", "\w", "\s", their
+ *        negations and escaped special characters), groups "(...)", alternation "|" and quantifiers "*", "+", "?", "{n}", "{n,}", "{n,m}".
+ *        Anchors "^" and "$" are rejected, as patterns always match the whole value; "\^" and "\$" match the characters themselves.
+ */
+class ValueConstraint
+{
+public:
+    /**
+     * @brief Creates constraint accepting decimal integers from the given range (inclusive). Throws InvalidValueConstraint if min > max.
+     */
+    static ValueConstraint Range(const std::int64_t min, const std::int64_t max);
+    /**
+     * @brief Creates constraint accepting values fully matching the given pattern. Throws InvalidValueConstraint if the pattern is invalid
+     *        (including unescaped "^" or "$" outside of a character class) or its automaton would be too big.
+     */
+    static ValueConstraint Pattern(const std::string &pattern);
+
+    bool IsSatisfied(const std::string_view value) const;
+    /**
+     * @brief Returns human readable description of the constraint, e.g. "integer in range [1, 65535]".
+     */
+    const std::string& GetDescription() const;
+    std::size_t GetHeapSize() const;
+
+private:
+    enum class Type : std::uint8_t
+    {
+        kRange,
+        kPattern
+    };
+
+    ValueConstraint(const Type type, const std::string &description);
+
+    bool IsInRange(const std::string_view value) const;
+    bool MatchesPattern(const std::string_view value) const;
+
+    // state 0 of the automaton rejects every input, state 1 is the initial one
+    static constexpr std::uint32_t kRejectingState {0U};
+    static constexpr std::uint32_t kInitialState {1U};
+
+    Type type_;
+    std::string description_;
+    std::int64_t min_;
+    std::int64_t max_;
+    std::array<std::uint8_t, 256U> byte_classes_;
+    std::uint32_t num_of_byte_classes_;
+    std::vector<std::uint32_t> transitions_;
+    std::vector<std::uint8_t> accepting_states_;
+};
+
+using ValueConstraintPtr = std::shared_ptr<const ValueConstraint>;
+
+} // comlint
\ No newline at end of file
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "comlint/mapped_file.hpp"
+
+namespace comlint {
+
+/**
+ * @brief Set of allowed values stored in an external file, one value per line, sorted in ascending byte order. The file is mapped into
+ *        memory and searched in place with binary search, so checking a value touches only a few pages of the file, however big it is.
+ *        Empty lines and carriage returns at the end of the lines are ignored.
+ */
+class ValueDictionary
+{
+public:
+    /**
+     * @brief Maps the given file. Throws InvalidValueDictionary if the file can't be opened.
+     */
+    explicit ValueDictionary(const std::string &path);
+
+    ValueDictionary(const ValueDictionary&) = delete;
+    ValueDictionary& operator=(const ValueDictionary&) = delete;
+
+    const std::string& GetPath() const;
+    /**
+     * @brief Returns number of the values. Values are counted (reading the whole file) only when this method is called for the first time.
+     */
+    std::size_t GetSize() const;
+    bool Contains(const std::string_view value) const;
+    /**
+     * @brief Returns up to max_num_of_values values placed around the position at which the given value would be stored in the file.
+     *        Returned values are views into the mapped file.
+     */
+    std::pmr::vector<std::string_view> GetNeighbours(const std::string_view value, const std::size_t max_num_of_values,
+                                                     std::pmr::memory_resource *memory_resource = std::pmr::get_default_resource()) const;
+
+private:
+    std::size_t FindLineBegin(const std::size_t position) const;
+    std::size_t FindLineEnd(const std::size_t position) const;
+    std::string_view GetLine(const std::size_t line_begin) const;
+    std::size_t LowerBound(const std::string_view value) const;
+
+    std::string path_;
+    MappedFile file_;
+    std::string_view content_;
+    mutable std::once_flag size_flag_;
+    mutable std::size_t size_;
+};
+
+using ValueDictionaryPtr = std::shared_ptr<const ValueDictionary>;
+
+} // comlint
\ No newline at end of file
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "comlint/cancellation_token.hpp"
+
+namespace comlint {
+
+/**
+ * @brief Single thread enforcing deadlines of all the command handlers running concurrently. It sleeps until the earliest deadline and
+ *        cancels the token watched with it, so a handler which doesn't finish in time is asked to stop. The thread is started only when
+ *        the first deadline is watched, so programs without timeouts never start it.
+ */
+class Watchdog
+{
+public:
+    using Clock = std::chrono::steady_clock;
+    using WatchId = std::pair<Clock::time_point, std::uint64_t>;
+
+    Watchdog();
+    ~Watchdog();
+
+    Watchdog(const Watchdog&) = delete;
+    Watchdog& operator=(const Watchdog&) = delete;
+
+    /**
+     * @brief Returns watchdog shared by the whole library.
+     */
+    static Watchdog& GetShared();
+
+    /**
+     * @brief Cancels the token when the deadline passes, unless it's unwatched before. Token must outlive the watch.
+     */
+    WatchId Watch(CancellationToken &token, const Clock::time_point deadline);
+    /**
+     * @brief Stops watching the deadline. Once it returns, the watchdog never touches the token again.
+     */
+    void Unwatch(const WatchId &watch_id);
+
+private:
+    void RunThread();
+
+    std::mutex mutex_;
+    std::condition_variable deadlines_changed_;
+    // watched tokens ordered by their deadlines, the earliest first
+    std::map<WatchId, CancellationToken*> deadlines_;
+    std::uint64_t next_watch_number_;
+    bool is_stopping_;
+    std::thread thread_;
+};
+
+/**
+ * @brief Watches the deadline of the token for as long as the enclosing scope lasts.
+ */
+class WatchdogScope
+{
+public:
+    WatchdogScope(CancellationToken &token, const Watchdog::Clock::time_point deadline)
+    : watch_id_{Watchdog::GetShared().Watch(token, deadline)}
+    {}
+    ~WatchdogScope()
+    {
+        Watchdog::GetShared().Unwatch(watch_id_);
+    }
+
+    WatchdogScope(const WatchdogScope&) = delete;
+    WatchdogScope& operator=(const WatchdogScope&) = delete;
+
+private:
+    Watchdog::WatchId watch_id_;
+};
+
+} // comlint
\ No newline at end of file
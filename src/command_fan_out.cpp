@@ -0,0 +1,109 @@
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "comlint/command_fan_out.hpp"
+#include "comlint/thread_pool.hpp"
+#include "comlint/tracer.hpp"
+#include "comlint/exceptions/command_handler_failed.hpp"
+
+namespace comlint {
+
+void CommandFanOut::Run(CommandHandlerInterface &command_handler, const ParsedCommand &parsed_command, const FanOut &fan_out, OutputSink &output,
+                        const CancellationToken &cancellation_token)
+{
+    const std::size_t chunk_size = std::max<std::size_t>(1U, fan_out.chunk_size);
+    const std::size_t num_of_chunks = std::max<std::size_t>(1U, (parsed_command.values.size() + chunk_size - 1U) / chunk_size);
+    const std::size_t max_concurrency = fan_out.max_concurrency > 0U ? fan_out.max_concurrency
+                                                                     : std::max<std::size_t>(1U, std::thread::hardware_concurrency());
+    std::vector<std::unique_ptr<OutputSink>> chunk_outputs(num_of_chunks);
+    std::vector<std::exception_ptr> exceptions(num_of_chunks);
+    std::atomic<std::size_t> next_chunk {0U};
+
+    // children are merged in order of their creation, so creating them upfront orders the output by values
+    if (fan_out.is_output_ordered) {
+        for (auto &chunk_output : chunk_outputs) {
+            chunk_output = output.CreateChild();
+        }
+    }
+
+    // every task is a lane taking chunks one by one until none is left, so the number of tasks limits the concurrency
+    ThreadPool::GetShared().ParallelFor(std::min(num_of_chunks, max_concurrency), [&](const std::size_t) {
+        for (std::size_t chunk = next_chunk++; chunk < num_of_chunks && !cancellation_token.IsCancelled(); chunk = next_chunk++) {
+            const auto [values_begin, values_end] = GetChunk(parsed_command.values, chunk, chunk_size);
+            ParsedCommand chunk_command {};
+
+            chunk_command.name = parsed_command.name;
+            chunk_command.values.assign(values_begin, values_end);
+            chunk_command.options = parsed_command.options;
+            chunk_command.flags = parsed_command.flags;
+            chunk_command.paths = parsed_command.paths;
+            chunk_command.globs = parsed_command.globs;
+
+            if (!chunk_outputs[chunk]) {
+                chunk_outputs[chunk] = output.CreateChild();
+            }
+
+            try {
+                const TraceSpan trace_span(parsed_command.name, "handler");
+
+                command_handler.Run(chunk_command, *chunk_outputs[chunk], cancellation_token);
+            }
+            catch (...) {
+                exceptions[chunk] = std::current_exception();
+            }
+
+            // output is handed over as soon as the invocation ends, so it doesn't wait in memory until all the others end
+            chunk_outputs[chunk].reset();
+        }
+    });
+
+    std::string failures {};
+    std::size_t num_of_failures = 0U;
+
+    for (std::size_t chunk = 0U; chunk < num_of_chunks; chunk++) {
+        if (exceptions[chunk]) {
+            failures.append("\n").append(GetFailure(GetChunk(parsed_command.values, chunk, chunk_size), exceptions[chunk]));
+            num_of_failures++;
+        }
+    }
+
+    if (num_of_failures > 0U) {
+        throw CommandHandlerFailed("Command " + parsed_command.name + " failed in " + std::to_string(num_of_failures) + " of " +
+                                   std::to_string(num_of_chunks) + " invocation(s):" + failures);
+    }
+}
+
+CommandFanOut::ValuesRange CommandFanOut::GetChunk(const CommandValues &values, const std::size_t chunk, const std::size_t chunk_size)
+{
+    const std::size_t begin = std::min(chunk * chunk_size, values.size());
+    const std::size_t end = std::min(begin + chunk_size, values.size());
+
+    return {values.begin() + static_cast<std::ptrdiff_t>(begin), values.begin() + static_cast<std::ptrdiff_t>(end)};
+}
+
+std::string CommandFanOut::GetFailure(const ValuesRange &chunk_values, const std::exception_ptr &exception)
+{
+    std::string failure {};
+
+    for (auto value = chunk_values.first; value != chunk_values.second; value++) {
+        failure.append(failure.empty() ? "" : " ").append(*value);
+    }
+
+    try {
+        std::rethrow_exception(exception);
+    }
+    catch (const std::exception &error) {
+        failure.append(": ").append(error.what());
+    }
+    catch (...) {
+        failure.append(": unknown error");
+    }
+
+    return failure;
+}
+
+} // comlint
\ No newline at end of file
@@ -0,0 +1,90 @@
+#include <thread>
+
+#include "comlint/command_handler_registry.hpp"
+
+namespace comlint {
+
+CommandHandlerRegistry::CommandHandlerRegistry(std::pmr::memory_resource *memory_resource)
+: handlers_{memory_resource},
+  update_mutex_{},
+  epoch_{0U},
+  readers_counters_{}
+{}
+
+CommandHandlerRegistry::~CommandHandlerRegistry()
+{
+    for (auto &[command_name, handler_slot] : handlers_) {
+        delete handler_slot.load();
+    }
+}
+
+void CommandHandlerRegistry::AddCommand(const std::string_view command_name)
+{
+    handlers_.emplace(std::piecewise_construct, std::forward_as_tuple(command_name), std::forward_as_tuple(nullptr));
+}
+
+bool CommandHandlerRegistry::ContainsCommand(const std::string_view command_name) const
+{
+    return handlers_.find(command_name) != handlers_.end();
+}
+
+void CommandHandlerRegistry::SetHandler(const std::string_view command_name, CommandHandlerPtr command_handler)
+{
+    HandlerSlot &handler_slot = handlers_.find(command_name)->second;
+    const CommandHandlerPtr *new_handler = new CommandHandlerPtr(std::move(command_handler));
+    const std::lock_guard<std::mutex> lock(update_mutex_);
+    const CommandHandlerPtr *previous_handler = handler_slot.exchange(new_handler);
+
+    WaitForReaders();
+    delete previous_handler;
+}
+
+CommandHandlerPtr CommandHandlerRegistry::GetHandler(const std::string_view command_name) const
+{
+    return GetHandler(GetSlot(command_name));
+}
+
+const CommandHandlerRegistry::HandlerSlot& CommandHandlerRegistry::GetSlot(const std::string_view command_name) const
+{
+    return handlers_.find(command_name)->second;
+}
+
+CommandHandlerPtr CommandHandlerRegistry::GetHandler(const HandlerSlot &handler_slot) const
+{
+    unsigned int epoch = epoch_.load();
+
+    // epoch may change between reading it and announcing the reader, in which case the writer could miss this reader
+    while (true) {
+        readers_counters_[epoch % 2U].num_of_readers.fetch_add(1U);
+
+        const unsigned int current_epoch = epoch_.load();
+
+        if (current_epoch == epoch) {
+            break;
+        }
+
+        readers_counters_[epoch % 2U].num_of_readers.fetch_sub(1U);
+        epoch = current_epoch;
+    }
+
+    const CommandHandlerPtr *command_handler = handler_slot.load();
+    CommandHandlerPtr command_handler_copy = command_handler ? *command_handler : nullptr;
+
+    readers_counters_[epoch % 2U].num_of_readers.fetch_sub(1U);
+
+    return command_handler_copy;
+}
+
+void CommandHandlerRegistry::WaitForReaders()
+{
+    // new readers always join the counter of the current epoch, so each counter is drained while no new reader can join it
+    for (unsigned int i=0U; i<2U; i++) {
+        const unsigned int epoch = epoch_.fetch_add(1U);
+
+        while (readers_counters_[epoch % 2U].num_of_readers.load() != 0U) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+} // comlint
\ No newline at end of file
@@ -1,17 +1,11 @@
-#include <iostream>
+#include <cstdlib>
 
 #include "comlint/command_line_interface.hpp"
+#include "comlint/plugin_library.hpp"
+#include "comlint/watchdog.hpp"
+#include "comlint/exceptions/command_timed_out.hpp"
 #include "comlint/exceptions/unsupported_command.hpp"
-#include "comlint/exceptions/invalid_command_position.hpp"
-#include "comlint/exceptions/missing_command_value.hpp"
-#include "comlint/exceptions/unsupported_command_value.hpp"
 #include "comlint/exceptions/unsupported_option.hpp"
-#include "comlint/exceptions/missing_option_value.hpp"
-#include "comlint/exceptions/forbidden_option_value.hpp"
-#include "comlint/exceptions/forbidden_option.hpp"
-#include "comlint/exceptions/unsupported_flag.hpp"
-#include "comlint/exceptions/forbidden_flag.hpp"
-#include "comlint/exceptions/missing_required_option.hpp"
 #include "comlint/exceptions/invalid_command_handler.hpp"
 #include "comlint/exceptions/missing_command_handler.hpp"
 #include "comlint/exceptions/invalid_command_name.hpp"
@@ -20,23 +14,68 @@
 #include "comlint/exceptions/duplicated_option.hpp"
 #include "comlint/exceptions/invalid_flag_name.hpp"
 #include "comlint/exceptions/duplicated_flag.hpp"
+#include "comlint/exceptions/invalid_default_option_value.hpp"
+#include "comlint/exceptions/memory_budget_exceeded.hpp"
 #include "comlint/utils.hpp"
 
 namespace comlint {
 
-static const std::string kDefaultOptionValue {""};
+namespace {
+
+// copy of the declaration, from which help of the snapshot returned by Compile() is rendered when it's requested
+struct InterfaceDeclaration
+{
+    std::string program_name;
+    std::string description;
+    Commands commands;
+    Options options;
+    Flags flags;
+};
+
+}
+
 static const std::string kHelpCommandIndicator {"help"};
 
-CommandLineInterface::CommandLineInterface(const int argc, char** argv, const std::string &program_name, const std::string &description, const bool allow_no_arguments)
-: argc_{static_cast<unsigned int>(argc)},
+CommandLineInterface::CommandLineInterface(const int argc, char** argv, const std::string &program_name, const std::string &description, const bool allow_no_arguments,
+                                           std::pmr::memory_resource *memory_resource)
+: construction_start_time_{StartTracing(argc, argv)},
+  argc_{static_cast<unsigned int>(argc)},
   argv_{argv},
-  program_name_{program_name.empty() ? argv[0] : program_name},
-  description_{description},
+  program_name_{program_name.empty() ? std::string_view(argv[0]) : std::string_view(program_name), memory_resource},
+  description_{description, memory_resource},
   allow_no_arguments_{allow_no_arguments},
-  interface_commands_{},
-  interface_options_{},
-  interface_flags_{}
-{}
+  allow_abbreviations_{false},
+  interface_commands_{memory_resource},
+  interface_options_{memory_resource},
+  interface_flags_{memory_resource},
+  config_file_path_{memory_resource},
+  static_help_{},
+  command_handlers_{memory_resource},
+  memory_budget_{0U},
+  memory_footprint_{},
+  compilation_mutex_{},
+  compiled_interface_{},
+  is_compiled_{false},
+  dispatch_table_{memory_resource},
+  metrics_settings_{},
+  metrics_collector_{},
+  recording_path_{},
+  schema_hash_{0U},
+  trace_batch_{}
+{
+    const char *recording_path = std::getenv(std::string(InvocationLog::kEnvironmentVariable).c_str());
+
+    if (recording_path != nullptr) {
+        recording_path_ = recording_path;
+    }
+
+    memory_footprint_.names = MemoryFootprint::GetHeapSize(program_name_);
+    memory_footprint_.descriptions = MemoryFootprint::GetHeapSize(description_);
+
+    if (construction_start_time_ != Tracer::kNoTime) {
+        Tracer::RecordSpan("CommandLineInterface", "interface", construction_start_time_, Tracer::GetTime());
+    }
+}
 
 void CommandLineInterface::AddCommand(const std::string &command_name, const std::string &description, const OptionNames &allowed_options,
                                       const FlagNames &allowed_flags, const OptionNames &required_options)
@@ -48,6 +87,8 @@ void CommandLineInterface::AddCommand(const std::string &command_name, const std
                                       const CommandValues &allowed_values, const OptionNames &allowed_options, const FlagNames &allowed_flags,
                                       const OptionNames &required_options)
 {
+    const TraceBatchScope trace_scope(trace_batch_, "AddCommand");
+
     if (!InterfaceValidator::IsCommandNameValid(command_name)) {
         throw InvalidCommandName("Unable to add " + command_name + " command! Name of the command is invalid.");
     }
@@ -55,12 +96,26 @@ void CommandLineInterface::AddCommand(const std::string &command_name, const std
         throw DuplicatedCommand("Unable to add " + command_name + " command! Command with the same name is already added.");
     }
 
-    interface_commands_.insert({command_name, CommandProperties(allowed_values, allowed_options, allowed_flags, description,
-                                num_of_required_values, required_options)});
+    std::pmr::memory_resource *memory_resource = interface_commands_.get_allocator().resource();
+    std::pmr::string name {command_name, memory_resource};
+    CommandProperties command_properties {allowed_values, allowed_options, allowed_flags, description, num_of_required_values,
+                                          required_options, memory_resource};
+    MemoryFootprint footprint = MemoryFootprint::GetCommandFootprint(name, command_properties);
+    footprint.handlers = CommandHandlerRegistry::kSlotSize + MemoryFootprint::GetHeapSize(name);
+
+    ReserveMemory(footprint, command_name + " command");
+
+    interface_commands_.emplace(std::move(name), std::move(command_properties));
+    command_handlers_.AddCommand(command_name);
+    memory_footprint_ += footprint;
+    InvalidateCompiledInterface();
 }
 
-void CommandLineInterface::AddOption(const OptionName &option_name, const std::string &description, const OptionValues &allowed_values)
+void CommandLineInterface::AddOption(const OptionName &option_name, const std::string &description, const OptionValues &allowed_values,
+                                     const std::string &environment_variable, const OptionValue &default_value)
 {
+    const TraceBatchScope trace_scope(trace_batch_, "AddOption");
+
     if (!InterfaceValidator::IsOptionNameValid(option_name)) {
         throw InvalidOptionName("Unable to add " + option_name + " option! Name of the option is invalid.");
     }
@@ -68,12 +123,26 @@ void CommandLineInterface::AddOption(const OptionName &option_name, const std::s
         throw DuplicatedOption("Unable to add " + option_name + " option! Option with the same name is already added.");
     }
 
-    // TODO: implement handling of user defined default option value
-    interface_options_.insert({option_name, OptionProperties(description, allowed_values, kDefaultOptionValue)});
+    if (!default_value.empty() && !allowed_values.empty() && !utils::VectorContainsElement(allowed_values, default_value)) {
+        throw InvalidDefaultOptionValue("Unable to add " + option_name + " option! Default value " + default_value + " is not one of the allowed values.");
+    }
+
+    std::pmr::memory_resource *memory_resource = interface_options_.get_allocator().resource();
+    std::pmr::string name {option_name, memory_resource};
+    OptionProperties option_properties {description, allowed_values, default_value, environment_variable, memory_resource};
+    const MemoryFootprint footprint = MemoryFootprint::GetOptionFootprint(name, option_properties);
+
+    ReserveMemory(footprint, option_name + " option");
+
+    interface_options_.emplace(std::move(name), std::move(option_properties));
+    memory_footprint_ += footprint;
+    InvalidateCompiledInterface();
 }
 
 void CommandLineInterface::AddFlag(const FlagName &flag_name, const std::string &description)
 {
+    const TraceBatchScope trace_scope(trace_batch_, "AddFlag");
+
     if (!InterfaceValidator::IsFlagNameValid(flag_name)) {
         throw InvalidFlagName("Unable to add " + flag_name + " flag! Name of the flag is invalid.");
     }
@@ -81,177 +150,497 @@ void CommandLineInterface::AddFlag(const FlagName &flag_name, const std::string
         throw DuplicatedFlag("Unable to add " + flag_name + " flag! Flag with the same name is already added.");
     }
 
-    interface_flags_.insert({flag_name, FlagProperties(description)});
+    std::pmr::memory_resource *memory_resource = interface_flags_.get_allocator().resource();
+    std::pmr::string name {flag_name, memory_resource};
+    FlagProperties flag_properties {description, memory_resource};
+    const MemoryFootprint footprint = MemoryFootprint::GetFlagFootprint(name, flag_properties);
+
+    ReserveMemory(footprint, flag_name + " flag");
+
+    interface_flags_.emplace(std::move(name), std::move(flag_properties));
+    memory_footprint_ += footprint;
+    InvalidateCompiledInterface();
 }
 
-ParsedCommand CommandLineInterface::Parse() const
+void CommandLineInterface::SetAllowedValuesDictionary(const std::string &element_name, const std::string &dictionary_path)
 {
-    if (InterfaceHelper::IsHelpRequired(argc_, argv_, allow_no_arguments_)) {
-        std::cout << InterfaceHelper::GetHelp(program_name_, description_, interface_commands_, interface_options_, interface_flags_);
-        return ParsedCommand(kHelpCommandIndicator, {}, {}, {});
+    const bool is_option = IsAddedOption(element_name, "set dictionary of allowed values");
+    ValueDictionaryPtr dictionary = std::make_shared<const ValueDictionary>(dictionary_path);
+
+    if (!is_option) {
+        ReplaceValueSource(interface_commands_.find(std::string_view(element_name))->second.allowed_values_dictionary, std::move(dictionary),
+                           "dictionary of allowed values for " + element_name);
+        return;
     }
 
-    CommandName command_name {};
-    CommandValues command_values {};
-    OptionsMap options {};
-    FlagsMap flags {};
+    OptionProperties &option_properties = interface_options_.find(std::string_view(element_name))->second;
 
-    for (unsigned int i=1U; i<argc_; i++) {
-        const std::string element = argv_[i];
-        const CommandLineElementType element_type = GetCommandLineElementType(element, i);
+    if (!option_properties.default_value.empty() && !utils::VectorContainsElement(option_properties.allowed_values, option_properties.default_value) &&
+        !dictionary->Contains(option_properties.default_value)) {
+        throw InvalidDefaultOptionValue("Unable to set dictionary of allowed values for " + element_name + " option! Default value " +
+                                        std::string(option_properties.default_value) + " is not one of the allowed values.");
+    }
 
-        if (element_type == CommandLineElementType::kCommand) {
-            command_name = element;
-            command_values = ParseCommand(command_name, i);
-        }
-        if (element_type == CommandLineElementType::kOption) {
-            const std::pair<OptionName, OptionValue> option = ParseOption(command_name, element, i);
-            options.insert(option);
-        }
-        if (element_type == CommandLineElementType::kFlag) {
-            const FlagName flag = ParseFlag(command_name, element, i);
-            flags.insert({flag, true});
-        }
+    ReplaceValueSource(option_properties.allowed_values_dictionary, std::move(dictionary), "dictionary of allowed values for " + element_name);
+}
+
+void CommandLineInterface::SetValueConstraint(const std::string &element_name, ValueConstraint value_constraint)
+{
+    const bool is_option = IsAddedOption(element_name, "set value constraint");
+    ValueConstraintPtr constraint = std::make_shared<const ValueConstraint>(std::move(value_constraint));
+
+    if (!is_option) {
+        ReplaceValueSource(interface_commands_.find(std::string_view(element_name))->second.value_constraint, std::move(constraint),
+                           "value constraint for " + element_name);
+        return;
     }
 
-    if (!command_name.empty() && utils::MapContainsKey(interface_commands_, command_name)) {
-        for (const auto &required_option : interface_commands_.at(command_name).required_options) {
-            if (!utils::MapContainsKey(options, required_option)) {
-                throw MissingRequiredOption("Command " + command_name + " requires option " + required_option + ", but such option has not been provided!");
-            }
-        }
+    OptionProperties &option_properties = interface_options_.find(std::string_view(element_name))->second;
+
+    if (!option_properties.default_value.empty() && !constraint->IsSatisfied(option_properties.default_value)) {
+        throw InvalidDefaultOptionValue("Unable to set value constraint for " + element_name + " option! Default value " +
+                                        std::string(option_properties.default_value) + " is not " + constraint->GetDescription() + ".");
     }
 
-    for (const auto &[flag_name, flag_properties] : interface_flags_) {
-        if (!utils::MapContainsKey(flags, flag_name)) {
-            flags.insert({flag_name, false});
-        }
+    ReplaceValueSource(option_properties.value_constraint, std::move(constraint), "value constraint for " + element_name);
+}
+
+void CommandLineInterface::SetPathRequirement(const std::string &element_name, const PathRequirement path_requirement)
+{
+    if (IsAddedOption(element_name, "set path requirement")) {
+        interface_options_.find(std::string_view(element_name))->second.path_requirement = path_requirement;
+    } else {
+        interface_commands_.find(std::string_view(element_name))->second.path_requirement = path_requirement;
+    }
+
+    InvalidateCompiledInterface();
+}
+
+void CommandLineInterface::SetGlobExpansion(const std::string &element_name, const GlobExpansion glob_expansion)
+{
+    if (IsAddedOption(element_name, "set glob expansion")) {
+        interface_options_.find(std::string_view(element_name))->second.glob_expansion = glob_expansion;
+    } else {
+        interface_commands_.find(std::string_view(element_name))->second.glob_expansion = glob_expansion;
     }
 
-    return ParsedCommand(command_name, command_values, options, flags);
+    InvalidateCompiledInterface();
+}
+
+void CommandLineInterface::SetFanOut(const CommandName &command_name, const FanOut &fan_out)
+{
+    const auto command = interface_commands_.find(std::string_view(command_name));
+
+    if (command == interface_commands_.end()) {
+        throw UnsupportedCommand("Unable to set fan-out! Command " + command_name + " is not added to command line interface definition.");
+    }
+
+    command->second.fan_out = fan_out;
+}
+
+void CommandLineInterface::SetTimeout(const CommandName &command_name, const std::chrono::milliseconds timeout)
+{
+    const auto command = interface_commands_.find(std::string_view(command_name));
+
+    if (command == interface_commands_.end()) {
+        throw UnsupportedCommand("Unable to set timeout! Command " + command_name + " is not added to command line interface definition.");
+    }
+
+    command->second.timeout = timeout;
+}
+
+void CommandLineInterface::EnableMetrics(const MetricsSettings &settings)
+{
+    metrics_settings_ = settings;
+    metrics_collector_.reset();
+    InvalidateCompiledInterface();
+}
+
+std::vector<CommandMetrics> CommandLineInterface::GetMetrics() const
+{
+    GetCompiledInterface();
+
+    return metrics_collector_ ? metrics_collector_->GetSnapshot() : std::vector<CommandMetrics>{};
+}
+
+void CommandLineInterface::EnableRecording(const std::string &log_path)
+{
+    recording_path_ = log_path;
+    InvalidateCompiledInterface();
+}
+
+void CommandLineInterface::SetConfigFile(const std::string &config_file_path)
+{
+    config_file_path_ = config_file_path;
+    InvalidateCompiledInterface();
+}
+
+void CommandLineInterface::AllowAbbreviations(const bool allow_abbreviations)
+{
+    allow_abbreviations_ = allow_abbreviations;
+    InvalidateCompiledInterface();
+}
+
+void CommandLineInterface::SetHelp(const std::string_view help)
+{
+    static_help_ = help;
+    InvalidateCompiledInterface();
+}
+
+void CommandLineInterface::SetMemoryBudget(const std::size_t memory_budget)
+{
+    const std::size_t used_memory = GetMemoryFootprint().GetTotal();
+
+    if (memory_budget > 0U && used_memory > memory_budget) {
+        throw MemoryBudgetExceeded("Unable to set memory budget of " + std::to_string(memory_budget) + " bytes! Interface already uses " +
+                                   std::to_string(used_memory) + " bytes.");
+    }
+
+    memory_budget_ = memory_budget;
+}
+
+MemoryFootprint CommandLineInterface::GetMemoryFootprint() const
+{
+    // interface compiled for parsing is owned by this object, unlike the snapshots returned by Compile()
+    return is_compiled_.load(std::memory_order_acquire) ? memory_footprint_ + compiled_interface_->GetMemoryFootprint() : memory_footprint_;
+}
+
+ParsedCommand CommandLineInterface::Parse() const
+{
+    const CompiledInterface &compiled_interface = GetCompiledInterface();
+    const auto parse = [&]() { return compiled_interface.Parse(static_cast<int>(argc_), argv_); };
+
+    return recording_path_.empty() ? parse() : RecordParsing<ParsedCommand>(parse);
+}
+
+pmr::ParsedCommand CommandLineInterface::Parse(std::pmr::memory_resource *memory_resource) const
+{
+    const CompiledInterface &compiled_interface = GetCompiledInterface();
+    const auto parse = [&]() { return compiled_interface.Parse(static_cast<int>(argc_), argv_, memory_resource); };
+
+    return recording_path_.empty() ? parse() : RecordParsing<pmr::ParsedCommand>(parse);
+}
+
+CompiledInterface CommandLineInterface::Compile() const
+{
+    // returned snapshot may outlive later changes of this object, so its help is rendered from its own copy of the declaration
+    const auto declaration = std::make_shared<const InterfaceDeclaration>(InterfaceDeclaration{std::string(program_name_), std::string(description_),
+                                                                                               interface_commands_, interface_options_, interface_flags_});
+
+    return Compile([declaration]() {
+        return InterfaceHelper::GetHelp(declaration->program_name, declaration->description, declaration->commands, declaration->options,
+                                        declaration->flags);
+    });
+}
+
+CompiledInterface CommandLineInterface::Compile(CompiledInterface::HelpRenderer render_help) const
+{
+    const TraceSpan trace_span("Compile", "interface");
+
+    return CompiledInterface(allow_no_arguments_, allow_abbreviations_, interface_commands_, interface_options_, interface_flags_, config_file_path_,
+                             static_help_, std::move(render_help), interface_commands_.get_allocator().resource());
 }
 
 void CommandLineInterface::AddCommandHandler(const CommandName &command_name, CommandHandlerPtr command_handler)
 {
-    if (!utils::MapContainsKey(interface_commands_, command_name)) {
+    const TraceBatchScope trace_scope(trace_batch_, "AddCommandHandler");
+
+    if (!command_handlers_.ContainsCommand(command_name)) {
         throw UnsupportedCommand("Unable to add command handler! Command " + command_name + " is not added to command line interface definition.");
     }
     if (!command_handler) {
         throw InvalidCommandHandler("Provided command handler for " + command_name + " command is a nullptr!");
     }
 
-    interface_commands_.at(command_name).command_handler = command_handler;
+    if (command_handlers_.GetHandler(command_name)) {
+        command_handlers_.SetHandler(command_name, std::move(command_handler));
+        return;
+    }
+
+    MemoryFootprint footprint {};
+    footprint.handlers = CommandHandlerRegistry::kHandlerSize;
+
+    ReserveMemory(footprint, command_name + " command handler");
+
+    command_handlers_.SetHandler(command_name, std::move(command_handler));
+    memory_footprint_ += footprint;
+}
+
+void CommandLineInterface::AddCommandHandlerFactory(const CommandName &command_name, CommandHandlerFactory command_handler_factory)
+{
+    if (!command_handler_factory) {
+        throw InvalidCommandHandler("Provided command handler factory for " + command_name + " command is empty!");
+    }
+
+    AddCommandHandler(command_name, std::make_shared<LazyCommandHandler>(std::move(command_handler_factory)));
+}
+
+void CommandLineInterface::AddCommandHandlerPlugin(const CommandName &command_name, const std::string &library_path, const std::string &symbol_name)
+{
+    AddCommandHandlerFactory(command_name, PluginLibrary::GetHandlerFactory(library_path, symbol_name));
 }
 
 void CommandLineInterface::Run()
 {
-    const ParsedCommand parsed_command = Parse();
-    
+    OutputSink output {};
+
+    Run(output);
+}
+
+void CommandLineInterface::Run(OutputSink &output)
+{
+    const std::unique_ptr<OutputSink> command_output = output.CreateChild();
+    const CompiledInterface &compiled_interface = GetCompiledInterface();
+    ParsedCommand parsed_command {};
+
+    if (recording_path_.empty()) {
+        const std::uint32_t command = compiled_interface.Parse(static_cast<int>(argc_), argv_, parsed_command, *command_output);
+
+        if (parsed_command.name != kHelpCommandIndicator) {
+            RunCommand(command, parsed_command, *command_output);
+        }
+
+        return;
+    }
+
+    std::uint32_t command = CompiledInterface::kNoIndex;
+    const std::chrono::steady_clock::time_point parse_start_time = std::chrono::steady_clock::now();
+
+    try {
+        command = compiled_interface.Parse(static_cast<int>(argc_), argv_, parsed_command, *command_output);
+    }
+    catch (const std::exception &exception) {
+        RecordInvocation(InvocationOutcome::kFailed, exception.what(), std::chrono::steady_clock::now() - parse_start_time, {});
+        throw;
+    }
+
+    const std::chrono::steady_clock::time_point run_start_time = std::chrono::steady_clock::now();
+
     if (parsed_command.name == kHelpCommandIndicator) {
+        RecordInvocation(InvocationOutcome::kHelp, {}, run_start_time - parse_start_time, {});
         return;
     }
-    if (!interface_commands_.at(parsed_command.name).command_handler) {
-        throw MissingCommandHandler("Unable to run command handler for " + parsed_command.name + " command! No command handler has been added for this command.");
+
+    // invocation is recorded even if the handler fails, the log describes parsing, not the handler
+    try {
+        RunCommand(command, parsed_command, *command_output);
+    }
+    catch (...) {
+        RecordInvocation(InvocationOutcome::kParsed, InvocationLog::GetResult(parsed_command), run_start_time - parse_start_time,
+                         std::chrono::steady_clock::now() - run_start_time);
+        throw;
     }
 
-    interface_commands_.at(parsed_command.name).command_handler->Run(parsed_command);
+    RecordInvocation(InvocationOutcome::kParsed, InvocationLog::GetResult(parsed_command), run_start_time - parse_start_time,
+                     std::chrono::steady_clock::now() - run_start_time);
 }
 
-CommandLineElementType CommandLineInterface::GetCommandLineElementType(const std::string &input, const unsigned int element_position_index) const
+void CommandLineInterface::RunCommand(const std::uint32_t command, const ParsedCommand &parsed_command, OutputSink &output)
 {
-    if (InterfaceValidator::IsCommandNameValid(input) && element_position_index == 1U) {
-        return CommandLineElementType::kCommand;
+    if (command == CompiledInterface::kNoIndex) {
+        throw MissingCommandHandler("Unable to run command handler! No command has been provided.");
+    }
+
+    const CommandDispatch &command_dispatch = dispatch_table_[command];
+    const CommandHandlerPtr command_handler = command_handlers_.GetHandler(*command_dispatch.handler_slot);
+
+    if (!command_handler) {
+        throw MissingCommandHandler("Unable to run command handler for " + parsed_command.name + " command! No command handler has been added for this command.");
+    }
+
+    if (!metrics_collector_) {
+        RunHandler(*command_handler, parsed_command, *command_dispatch.command_properties, output);
+        return;
+    }
+
+    const std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+    const auto get_latency = [&start_time]() { return std::chrono::steady_clock::now() - start_time; };
+
+    try {
+        RunHandler(*command_handler, parsed_command, *command_dispatch.command_properties, output);
     }
-    if (InterfaceValidator::IsOptionNameValid(input)) {
-        return CommandLineElementType::kOption;
+    catch (const std::exception &exception) {
+        metrics_collector_->RecordRun(command_dispatch.metrics_command, get_latency(), &typeid(exception));
+        throw;
     }
-    if (InterfaceValidator::IsFlagNameValid(input)) {
-        return CommandLineElementType::kFlag;
+    catch (...) {
+        metrics_collector_->RecordRun(command_dispatch.metrics_command, get_latency(), &typeid(void));
+        throw;
     }
 
-    return CommandLineElementType::kCustomValue;
+    metrics_collector_->RecordRun(command_dispatch.metrics_command, get_latency());
 }
 
-CommandValues CommandLineInterface::ParseCommand(const CommandName &command_name, const unsigned int command_index) const
+template <typename ParsedCommandType, typename ParseFunction>
+ParsedCommandType CommandLineInterface::RecordParsing(const ParseFunction &parse) const
 {
-    if (!utils::MapContainsKey(interface_commands_, command_name)) {
-        const std::string similar_commands = utils::GetSimilarKeys(interface_commands_, command_name, "\n");
+    const std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+
+    try {
+        ParsedCommandType parsed_command = parse();
+        const std::chrono::nanoseconds parse_time = std::chrono::steady_clock::now() - start_time;
 
-        throw UnsupportedCommand("Command " + command_name + " is not supported!" + InterfaceHelper::GetHint(similar_commands));
+        if (std::string_view(parsed_command.name) == kHelpCommandIndicator) {
+            RecordInvocation(InvocationOutcome::kHelp, {}, parse_time, {});
+        } else {
+            RecordInvocation(InvocationOutcome::kParsed, InvocationLog::GetResult(parsed_command), parse_time, {});
+        }
+
+        return parsed_command;
     }
-    if (command_index != 1U) {
-        throw InvalidCommandPosition("Detected command " + command_name + " is not directly after program name!");
+    catch (const std::exception &exception) {
+        RecordInvocation(InvocationOutcome::kFailed, exception.what(), std::chrono::steady_clock::now() - start_time, {});
+        throw;
     }
+}
 
-    if (!interface_commands_.at(command_name).RequiresValue()) {
-        return {};
-    }
-    else if (command_index + interface_commands_.at(command_name).num_of_required_values >= argc_ ||
-             GetCommandLineElementType(argv_[command_index + 1U], command_index + 1U) == CommandLineElementType::kOption ||
-             GetCommandLineElementType(argv_[command_index + 1U], command_index + 1U) == CommandLineElementType::kFlag) {
-        throw MissingCommandValue("Command " + command_name + " requires " + std::to_string(interface_commands_.at(command_name).num_of_required_values) +
-                                  " value(s), but they were not provided!");
+void CommandLineInterface::RecordInvocation(const InvocationOutcome outcome, std::string result, const std::chrono::nanoseconds parse_time,
+                                            const std::chrono::nanoseconds run_time) const
+{
+    InvocationRecord record {schema_hash_, {}, outcome, std::move(result), parse_time, run_time};
+
+    for (unsigned int i = 1U; i < argc_; i++) {
+        record.arguments.emplace_back(argv_[i]);
     }
 
-    CommandValues values {};
+    // recording is best effort, an unwritable log must not fail the invocation
+    InvocationLog::Append(recording_path_, record);
+}
 
-    for (unsigned int i=0U; i<interface_commands_.at(command_name).num_of_required_values; i++) {
-        const CommandValue command_value = argv_[command_index + i + 1U];
+void CommandLineInterface::RunHandler(CommandHandlerInterface &command_handler, const ParsedCommand &parsed_command,
+                                      const CommandProperties &command_properties, OutputSink &output)
+{
+    CancellationToken cancellation_token {};
+    const Watchdog::Clock::time_point start_time = command_properties.timeout ? Watchdog::Clock::now() : Watchdog::Clock::time_point{};
 
-        if (!interface_commands_.at(command_name).allowed_values.empty() &&
-            !utils::VectorContainsElement<CommandValues>(interface_commands_.at(command_name).allowed_values, command_value)) {
-            const std::string similar_values = utils::GetSimilarValues(interface_commands_.at(command_name).allowed_values, command_value, "\n");
+    try {
+        std::optional<WatchdogScope> watchdog_scope {};
 
-            throw UnsupportedCommandValue("Unsupported value " + command_value + " for " + command_name + " command!" + InterfaceHelper::GetHint(similar_values));
+        if (command_properties.timeout) {
+            watchdog_scope.emplace(cancellation_token, start_time + *command_properties.timeout);
         }
+        if (command_properties.fan_out) {
+            CommandFanOut::Run(command_handler, parsed_command, *command_properties.fan_out, output, cancellation_token);
+        } else {
+            const TraceSpan trace_span(parsed_command.name, "handler");
 
-        values.push_back(argv_[command_index + i + 1U]);
+            command_handler.Run(parsed_command, output, cancellation_token);
+        }
+    }
+    catch (...) {
+        // failure of the cancelled handler (e.g. CommandCancelled) is only a consequence of the missed deadline
+        if (!cancellation_token.IsCancelled()) {
+            throw;
+        }
     }
 
-    return values;
+    if (cancellation_token.IsCancelled()) {
+        throw CommandTimedOut(parsed_command.name, *command_properties.timeout,
+                              std::chrono::duration_cast<std::chrono::milliseconds>(Watchdog::Clock::now() - start_time));
+    }
 }
 
-std::pair<OptionName, OptionValue> CommandLineInterface::ParseOption(const CommandName &command_name, const OptionName &option_name,
-                                                                     const unsigned int option_index) const
+void CommandLineInterface::ReserveMemory(const MemoryFootprint &footprint, const std::string &element_description)
 {
-    if (!utils::MapContainsKey(interface_options_, option_name)) {
-        const std::string similar_options = utils::GetSimilarKeys(interface_options_, option_name, "\n");
+    const std::size_t used_memory = GetMemoryFootprint().GetTotal();
 
-        throw UnsupportedOption("Option " + option_name + " is not supported!" + InterfaceHelper::GetHint(similar_options));
+    if (memory_budget_ > 0U && used_memory + footprint.GetTotal() > memory_budget_) {
+        throw MemoryBudgetExceeded("Unable to add " + element_description + "! It requires " + std::to_string(footprint.GetTotal()) +
+                                   " bytes, which exceeds memory budget of " + std::to_string(memory_budget_) + " bytes (" +
+                                   std::to_string(used_memory) + " bytes already used).");
     }
-    if (option_index + 1U >= argc_) {
-        throw MissingOptionValue("Option " + option_name + " requires value, but no value has been provided!");
+}
+
+bool CommandLineInterface::IsAddedOption(const std::string &element_name, const std::string &action) const
+{
+    const bool is_option = InterfaceValidator::IsOptionNameValid(element_name);
+
+    if (is_option && !utils::MapContainsKey(interface_options_, element_name)) {
+        throw UnsupportedOption("Unable to " + action + "! Option " + element_name + " is not added to command line interface definition.");
     }
-    if (utils::MapContainsKey(interface_commands_, command_name) &&
-        !utils::VectorContainsElement<CommandValues>(interface_commands_.at(command_name).allowed_options, option_name)) {
-        throw ForbiddenOption("Option " + option_name + " is not allowed for " + command_name + " command!");
+    if (!is_option && !utils::MapContainsKey(interface_commands_, element_name)) {
+        throw UnsupportedCommand("Unable to " + action + "! Command " + element_name + " is not added to command line interface definition.");
     }
 
-    const OptionValue value = argv_[option_index + 1U];
+    return is_option;
+}
+
+template <typename ValueSourcePtr>
+void CommandLineInterface::ReplaceValueSource(ValueSourcePtr &value_source, ValueSourcePtr new_value_source, const std::string &element_description)
+{
+    const std::size_t previous_heap_size = MemoryFootprint::GetHeapSize(value_source);
+    const std::size_t heap_size = MemoryFootprint::GetHeapSize(new_value_source);
 
-    if (!interface_options_.at(option_name).allowed_values.empty() &&
-        !utils::VectorContainsElement<CommandValues>(interface_options_.at(option_name).allowed_values, value)) {
-        const std::string similar_values = utils::GetSimilarValues(interface_options_.at(option_name).allowed_values, value, "\n");
+    if (heap_size > previous_heap_size) {
+        MemoryFootprint footprint {};
+        footprint.allowed_values = heap_size - previous_heap_size;
 
-        throw ForbiddenOptionValue("Given value " + value + " for option " + option_name + " is not allowed!" + InterfaceHelper::GetHint(similar_values));
+        ReserveMemory(footprint, element_description);
     }
 
-    return std::make_pair(option_name, value);
+    value_source = std::move(new_value_source);
+    memory_footprint_.allowed_values = memory_footprint_.allowed_values - previous_heap_size + heap_size;
+    InvalidateCompiledInterface();
 }
 
-FlagName CommandLineInterface::ParseFlag(const CommandName &command_name, const FlagName &flag_name, const unsigned int flag_index) const
+const CompiledInterface& CommandLineInterface::GetCompiledInterface() const
 {
-    if (!utils::MapContainsKey(interface_flags_, flag_name)) {
-        const std::string similar_flags = utils::GetSimilarKeys(interface_flags_, flag_name, "\n");
+    // interface is compiled only once after it changes, so concurrent calls lock only until the first of them compiles it
+    if (!is_compiled_.load(std::memory_order_acquire)) {
+        const std::lock_guard<std::mutex> lock(compilation_mutex_);
+
+        if (!compiled_interface_) {
+            trace_batch_.Close();
+            // compiled interface is reset on every change of the declaration, so its help is rendered from the declaration itself
+            compiled_interface_.emplace(Compile([this]() {
+                return InterfaceHelper::GetHelp(program_name_, description_, interface_commands_, interface_options_, interface_flags_);
+            }));
+            const std::size_t compiled_memory = compiled_interface_->GetMemoryFootprint().GetTotal();
+
+            if (memory_budget_ > 0U && memory_footprint_.GetTotal() + compiled_memory > memory_budget_) {
+                compiled_interface_.reset();
+                throw MemoryBudgetExceeded("Unable to compile interface! It requires " + std::to_string(compiled_memory) +
+                                           " bytes, which exceeds memory budget of " + std::to_string(memory_budget_) + " bytes (" +
+                                           std::to_string(memory_footprint_.GetTotal()) + " bytes already used).");
+            }
 
-        throw UnsupportedFlag("Flag " + flag_name + " is not supported!" + InterfaceHelper::GetHint(similar_flags));
-    }
-    if (utils::MapContainsKey(interface_commands_, command_name) &&
-        !utils::VectorContainsElement<CommandValues>(interface_commands_.at(command_name).allowed_flags, flag_name)) {
-        throw ForbiddenFlag("Flag " + flag_name + " is not allowed for " + command_name + " command!");
+            dispatch_table_.clear();
+
+            // collector is kept when commands are added, so their counters survive recompilation
+            if (metrics_settings_ && !metrics_collector_) {
+                metrics_collector_ = std::make_unique<MetricsCollector>(std::string(program_name_), std::vector<std::string>{}, *metrics_settings_);
+            }
+
+            // commands of the compiled interface are sorted by name, just like the declared ones
+            for (const auto &[command_name, command_properties] : interface_commands_) {
+                const std::uint32_t metrics_command = metrics_collector_ ? metrics_collector_->AddCommand(std::string(command_name)) : 0U;
+
+                dispatch_table_.push_back({&command_handlers_.GetSlot(command_name), &command_properties, metrics_command});
+            }
+
+            if (!recording_path_.empty()) {
+                schema_hash_ = InvocationLog::GetSchemaHash(interface_commands_, interface_options_, interface_flags_, allow_no_arguments_,
+                                                            allow_abbreviations_, config_file_path_);
+            }
+
+            is_compiled_.store(true, std::memory_order_release);
+        }
     }
 
-    return argv_[flag_index];
+    return *compiled_interface_;
+}
+
+void CommandLineInterface::InvalidateCompiledInterface()
+{
+    compiled_interface_.reset();
+    is_compiled_.store(false, std::memory_order_release);
+}
+
+std::int64_t CommandLineInterface::StartTracing(const int argc, char** argv)
+{
+    Tracer::StartIfRequested(argc, argv);
+
+    return Tracer::IsEnabled() ? Tracer::GetTime() : Tracer::kNoTime;
 }
 
 } // comlint
\ No newline at end of file
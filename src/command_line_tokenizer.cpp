@@ -0,0 +1,87 @@
+#include <array>
+#include <limits>
+
+#include "comlint/command_line_tokenizer.hpp"
+#include "comlint/tracer.hpp"
+
+namespace comlint {
+
+namespace {
+
+enum ByteClass : std::uint8_t
+{
+    kEnd,
+    kDash,
+    kOther,
+    kNumOfByteClasses
+};
+
+// flag needs one more character after "--" prefix, so such elements are resolved by looking at the third byte
+static constexpr CommandLineElementType kPendingFlag {static_cast<CommandLineElementType>(0xFFU)};
+
+static constexpr std::array<ByteClass, 256U> kByteClasses = [] {
+    std::array<ByteClass, 256U> byte_classes {};
+
+    for (auto &byte_class : byte_classes) {
+        byte_class = ByteClass::kOther;
+    }
+    byte_classes[static_cast<unsigned char>('\0')] = ByteClass::kEnd;
+    byte_classes[static_cast<unsigned char>('-')] = ByteClass::kDash;
+
+    return byte_classes;
+}();
+
+// element types indexed by classes of the first and the second byte of element placed on command position
+static constexpr CommandLineElementType kElementTypes[kNumOfByteClasses][kNumOfByteClasses] {
+    /* kEnd   */ {CommandLineElementType::kCustomValue, CommandLineElementType::kCustomValue, CommandLineElementType::kCustomValue},
+    /* kDash  */ {CommandLineElementType::kCustomValue, kPendingFlag, CommandLineElementType::kOption},
+    /* kOther */ {CommandLineElementType::kCommand, CommandLineElementType::kCommand, CommandLineElementType::kCommand}
+};
+
+inline ByteClass GetByteClass(const char *element, const std::size_t index, const std::size_t max_size)
+{
+    return index < max_size ? kByteClasses[static_cast<unsigned char>(element[index])] : ByteClass::kEnd;
+}
+
+} // namespace
+
+CommandLineTokens CommandLineTokenizer::Tokenize(const unsigned int argc, char** argv, std::pmr::memory_resource *memory_resource)
+{
+    static constexpr std::size_t kUnknownSize {std::numeric_limits<std::size_t>::max()};
+    const TraceSpan trace_span("Tokenize", "parse");
+    CommandLineTokens tokens(argc, CommandLineElementType::kCustomValue, memory_resource);
+
+    if (argc > 1U) {
+        tokens[1U] = GetElementType(argv[1U], kUnknownSize, true);
+    }
+    for (unsigned int i=2U; i<argc; i++) {
+        tokens[i] = GetElementType(argv[i], kUnknownSize, false);
+    }
+
+    return tokens;
+}
+
+CommandLineElementType CommandLineTokenizer::GetElementType(const std::string_view element, const bool is_command_position)
+{
+    return GetElementType(element.data(), element.size(), is_command_position);
+}
+
+CommandLineElementType CommandLineTokenizer::GetElementType(const char *element, const std::size_t max_size, const bool is_command_position)
+{
+    // next byte is read only when the previous one is not the terminating one, so elements of argv never need their length computed
+    const ByteClass first_byte_class = GetByteClass(element, 0U, max_size);
+    const ByteClass second_byte_class = first_byte_class == ByteClass::kEnd ? ByteClass::kEnd : GetByteClass(element, 1U, max_size);
+    CommandLineElementType element_type = kElementTypes[first_byte_class][second_byte_class];
+
+    if (element_type == kPendingFlag) {
+        element_type = GetByteClass(element, 2U, max_size) == ByteClass::kEnd ? CommandLineElementType::kCustomValue
+                                                                              : CommandLineElementType::kFlag;
+    }
+    if (element_type == CommandLineElementType::kCommand && !is_command_position) {
+        element_type = CommandLineElementType::kCustomValue;
+    }
+
+    return element_type;
+}
+
+} // comlint
\ No newline at end of file
@@ -0,0 +1,613 @@
+#include <algorithm>
+#include <array>
+
+#include "comlint/compiled_interface.hpp"
+#include "comlint/environment_variables.hpp"
+#include "comlint/mapped_file.hpp"
+#include "comlint/config_file.hpp"
+#include "comlint/glob_expander.hpp"
+#include "comlint/path_validator.hpp"
+#include "comlint/tracer.hpp"
+#include "comlint/exceptions/ambiguous_abbreviation.hpp"
+#include "comlint/exceptions/unsupported_command.hpp"
+#include "comlint/exceptions/invalid_command_position.hpp"
+#include "comlint/exceptions/missing_command_value.hpp"
+#include "comlint/exceptions/unsupported_command_value.hpp"
+#include "comlint/exceptions/unsupported_option.hpp"
+#include "comlint/exceptions/missing_option_value.hpp"
+#include "comlint/exceptions/forbidden_option_value.hpp"
+#include "comlint/exceptions/forbidden_option.hpp"
+#include "comlint/exceptions/unsupported_flag.hpp"
+#include "comlint/exceptions/forbidden_flag.hpp"
+#include "comlint/exceptions/missing_required_option.hpp"
+#include "comlint/utils.hpp"
+
+namespace comlint {
+
+static const std::string kHelpCommandIndicator {"help"};
+static const std::size_t kParsingBufferSize {512U};
+static const std::size_t kNumOfDictionaryHintCandidates {16U};
+
+CompiledInterface::CompiledInterface(const bool allow_no_arguments, const bool allow_abbreviations, const Commands &commands,
+                                     const Options &options, const Flags &flags, const std::string_view config_file_path,
+                                     const std::string_view static_help, HelpRenderer render_help, std::pmr::memory_resource *memory_resource)
+: allow_no_arguments_{allow_no_arguments},
+  allow_abbreviations_{allow_abbreviations},
+  command_names_(memory_resource),
+  commands_(memory_resource),
+  option_names_(memory_resource),
+  options_(memory_resource),
+  flag_names_(memory_resource),
+  strings_(memory_resource),
+  has_environment_options_{false},
+  has_default_options_{false},
+  has_path_requirements_{false},
+  has_glob_expansions_{false},
+  config_file_path_(config_file_path, memory_resource),
+  static_help_{static_help},
+  render_help_{static_help.empty() ? std::move(render_help) : HelpRenderer()},
+  lazy_help_{static_help.empty() ? std::make_shared<LazyHelp>(memory_resource) : nullptr}
+{
+    option_names_.reserve(options.size());
+    options_.reserve(options.size());
+
+    for (const auto &[option_name, option_properties] : options) {
+        const StringRange allowed_values = AddStrings(option_properties.allowed_values);
+        const std::uint32_t default_value = option_properties.default_value.empty() ? kNoIndex : AddString(option_properties.default_value);
+        const std::uint32_t environment_variable = option_properties.environment_variable.empty() ? kNoIndex
+                                                                                                  : AddString(option_properties.environment_variable);
+
+        option_names_.emplace_back(option_name);
+        options_.push_back({allowed_values, default_value, environment_variable, option_properties.allowed_values_dictionary,
+                            option_properties.value_constraint, option_properties.path_requirement,
+                            option_properties.glob_expansion});
+        has_environment_options_ = has_environment_options_ || environment_variable != kNoIndex;
+        has_default_options_ = has_default_options_ || default_value != kNoIndex;
+        has_path_requirements_ = has_path_requirements_ || option_properties.path_requirement != PathRequirement::kNone;
+        has_glob_expansions_ = has_glob_expansions_ || option_properties.glob_expansion != GlobExpansion::kDisabled;
+    }
+
+    flag_names_.reserve(flags.size());
+
+    for (const auto &[flag_name, flag_properties] : flags) {
+        flag_names_.emplace_back(flag_name);
+    }
+
+    command_names_.reserve(commands.size());
+    commands_.reserve(commands.size());
+
+    for (const auto &[command_name, command_properties] : commands) {
+        CompiledCommand command {command_properties.num_of_required_values, AddStrings(command_properties.allowed_values),
+                                 AddStrings(command_properties.required_options), BitMask(memory_resource), BitMask(memory_resource),
+                                 BitMask(memory_resource), false, command_properties.allowed_values_dictionary,
+                                 command_properties.value_constraint, command_properties.path_requirement,
+                                 command_properties.glob_expansion};
+
+        has_path_requirements_ = has_path_requirements_ || command_properties.path_requirement != PathRequirement::kNone;
+        has_glob_expansions_ = has_glob_expansions_ || command_properties.glob_expansion != GlobExpansion::kDisabled;
+
+        // undeclared options and flags can never be used, so they are simply left out of the masks
+        for (const auto &option_name : command_properties.allowed_options) {
+            const std::uint32_t option = FindName(option_names_, option_name);
+
+            if (option != kNoIndex) {
+                command.allowed_options_mask.Set(option);
+            }
+        }
+        for (const auto &flag_name : command_properties.allowed_flags) {
+            const std::uint32_t flag = FindName(flag_names_, flag_name);
+
+            if (flag != kNoIndex) {
+                command.allowed_flags_mask.Set(flag);
+            }
+        }
+        for (const auto &option_name : command_properties.required_options) {
+            const std::uint32_t option = FindName(option_names_, option_name);
+
+            if (option != kNoIndex) {
+                command.required_options_mask.Set(option);
+            }
+            else {
+                command.has_undeclared_required_options = true;
+            }
+        }
+
+        // masks span only the allowed indexes, so their size does not grow with the size of the whole interface
+        command.allowed_options_mask.Compact();
+        command.allowed_flags_mask.Compact();
+        command.required_options_mask.Compact();
+
+        command_names_.emplace_back(command_name);
+        commands_.push_back(std::move(command));
+    }
+}
+
+ParsedCommand CompiledInterface::Parse(const int argc, char** argv) const
+{
+    OutputSink output {};
+
+    return Parse(argc, argv, output);
+}
+
+pmr::ParsedCommand CompiledInterface::Parse(const int argc, char** argv, std::pmr::memory_resource *memory_resource) const
+{
+    pmr::ParsedCommand parsed_command(memory_resource);
+    OutputSink output {};
+
+    ParseInto(static_cast<unsigned int>(argc), argv, parsed_command, output);
+
+    return parsed_command;
+}
+
+ParsedCommand CompiledInterface::Parse(const int argc, char** argv, OutputSink &output) const
+{
+    ParsedCommand parsed_command {};
+
+    ParseInto(static_cast<unsigned int>(argc), argv, parsed_command, output);
+
+    return parsed_command;
+}
+
+std::uint32_t CompiledInterface::Parse(const int argc, char** argv, ParsedCommand &parsed_command, OutputSink &output) const
+{
+    return ParseInto(static_cast<unsigned int>(argc), argv, parsed_command, output);
+}
+
+MemoryFootprint CompiledInterface::GetMemoryFootprint() const
+{
+    MemoryFootprint footprint {};
+
+    for (const auto *names : {&command_names_, &option_names_, &flag_names_}) {
+        footprint.names += MemoryFootprint::GetHeapSize(*names) - names->capacity() * sizeof(std::pmr::string);
+        footprint.lookup_indexes += names->capacity() * sizeof(std::pmr::string);
+    }
+    for (const auto &command : commands_) {
+        footprint.lookup_indexes += command.allowed_options_mask.GetHeapSize() + command.allowed_flags_mask.GetHeapSize() +
+                                    command.required_options_mask.GetHeapSize();
+    }
+
+    footprint.lookup_indexes += commands_.capacity() * sizeof(CompiledCommand) + options_.capacity() * sizeof(CompiledOption);
+    footprint.allowed_values = MemoryFootprint::GetHeapSize(strings_);
+    // help which is not requested yet takes no memory
+    if (lazy_help_ && lazy_help_->is_rendered.load(std::memory_order_acquire)) {
+        footprint.descriptions = MemoryFootprint::GetHeapSize(lazy_help_->help);
+    }
+
+    return footprint;
+}
+
+template <typename ParsedCommandType>
+std::uint32_t CompiledInterface::ParseInto(const unsigned int argc, char** argv, ParsedCommandType &parsed_command, OutputSink &output) const
+{
+    const TraceSpan trace_span("Parse", "parse");
+
+    if (InterfaceHelper::IsHelpRequired(argc, argv, allow_no_arguments_)) {
+        const TraceSpan help_trace_span("WriteHelp", "help");
+        output.Write(GetHelp());
+        parsed_command.name = kHelpCommandIndicator;
+        return kNoIndex;
+    }
+
+    std::array<std::byte, kParsingBufferSize> parsing_buffer {};
+    std::pmr::monotonic_buffer_resource parsing_memory_resource(parsing_buffer.data(), parsing_buffer.size());
+    BitMask used_options(option_names_.size(), &parsing_memory_resource);
+    BitMask used_flags(flag_names_.size(), &parsing_memory_resource);
+    const CommandLineTokens tokens = CommandLineTokenizer::Tokenize(argc, argv, &parsing_memory_resource);
+    std::uint32_t command = kNoIndex;
+
+    for (unsigned int i=1U; i<argc; i++) {
+        const CommandLineElementType element_type = tokens[i];
+
+        if (element_type == CommandLineElementType::kCommand) {
+            command = ParseCommand(argc, argv, tokens, i, parsed_command.values);
+            parsed_command.name = std::string_view(command_names_[command]);
+        }
+        if (element_type == CommandLineElementType::kOption) {
+            const auto [option, option_value] = ParseOption(argc, argv, command, i);
+
+            if (!used_options.Test(option)) {
+                parsed_command.options.emplace(std::string_view(option_names_[option]), option_value);
+                used_options.Set(option);
+            }
+        }
+        if (element_type == CommandLineElementType::kFlag) {
+            const std::uint32_t flag = ParseFlag(argv, command, i);
+
+            if (flag != kNoIndex && !used_flags.Test(flag)) {
+                parsed_command.flags.emplace(std::string_view(flag_names_[flag]), true);
+                used_flags.Set(flag);
+            }
+        }
+    }
+
+    if (has_environment_options_) {
+        ParseEnvironmentOptions(command, parsed_command.options, used_options);
+    }
+    if (!config_file_path_.empty()) {
+        ParseConfigFileOptions(parsed_command.name, command, parsed_command.options, used_options);
+    }
+    if (has_default_options_) {
+        ParseDefaultOptions(command, parsed_command.options, used_options);
+    }
+
+    if (command != kNoIndex &&
+        (commands_[command].has_undeclared_required_options || !used_options.Contains(commands_[command].required_options_mask))) {
+        const StringRange &required_options = commands_[command].required_options;
+
+        for (std::uint32_t i=required_options.begin; i<required_options.end; i++) {
+            if (!utils::MapContainsKey(parsed_command.options, strings_[i])) {
+                throw MissingRequiredOption("Command " + std::string(parsed_command.name) + " requires option " + std::string(strings_[i]) +
+                                            ", but such option has not been provided!");
+            }
+        }
+    }
+
+    if (has_glob_expansions_) {
+        CollectGlobPatterns(command, parsed_command);
+    }
+    if (has_path_requirements_) {
+        ValidatePaths(command, parsed_command, &parsing_memory_resource);
+    }
+
+    for (std::uint32_t flag=0U; flag<flag_names_.size(); flag++) {
+        if (!used_flags.Test(flag)) {
+            parsed_command.flags.emplace_hint(parsed_command.flags.end(), std::string_view(flag_names_[flag]), false);
+        }
+    }
+
+    return command;
+}
+
+template <typename CommandValuesType>
+std::uint32_t CompiledInterface::ParseCommand(const unsigned int argc, char** argv, const CommandLineTokens &tokens, const unsigned int command_index,
+                                              CommandValuesType &values) const
+{
+    const TraceSpan trace_span("ParseCommand", "parse");
+    const std::string_view command_name = argv[command_index];
+    const std::uint32_t command = ResolveName(command_names_, command_name, "Command");
+
+    if (command == kNoIndex) {
+        const std::string similar_commands = utils::GetSimilarValues(command_names_, command_name, "\n");
+
+        throw UnsupportedCommand("Command " + std::string(command_name) + " is not supported!" + InterfaceHelper::GetHint(similar_commands));
+    }
+    if (command_index != 1U) {
+        throw InvalidCommandPosition("Detected command " + std::string(command_name) + " is not directly after program name!");
+    }
+
+    const CompiledCommand &compiled_command = commands_[command];
+
+    if (compiled_command.num_of_required_values == 0U) {
+        return command;
+    }
+    else if (command_index + compiled_command.num_of_required_values >= argc ||
+             tokens[command_index + 1U] == CommandLineElementType::kOption || tokens[command_index + 1U] == CommandLineElementType::kFlag) {
+        throw MissingCommandValue("Command " + std::string(command_name) + " requires " + std::to_string(compiled_command.num_of_required_values) +
+                                  " value(s), but they were not provided!");
+    }
+
+    values.reserve(compiled_command.num_of_required_values);
+
+    for (unsigned int i=0U; i<compiled_command.num_of_required_values; i++) {
+        const std::string_view command_value = argv[command_index + i + 1U];
+
+        if (!IsValueAllowed(compiled_command.allowed_values, compiled_command.allowed_values_dictionary, command_value)) {
+            const std::string similar_values = GetSimilarValues(compiled_command.allowed_values, compiled_command.allowed_values_dictionary,
+                                                                command_value);
+
+            throw UnsupportedCommandValue("Unsupported value " + std::string(command_value) + " for " + std::string(command_name) + " command!" +
+                                          InterfaceHelper::GetHint(similar_values));
+        }
+        if (compiled_command.value_constraint && !compiled_command.value_constraint->IsSatisfied(command_value)) {
+            throw UnsupportedCommandValue("Unsupported value " + std::string(command_value) + " for " + std::string(command_name) + " command! " +
+                                          "Expected " + compiled_command.value_constraint->GetDescription() + ".");
+        }
+
+        values.emplace_back(command_value);
+    }
+
+    return command;
+}
+
+std::pair<std::uint32_t, std::string_view> CompiledInterface::ParseOption(const unsigned int argc, char** argv, const std::uint32_t command,
+                                                                          const unsigned int option_index) const
+{
+    const std::string_view option_name = argv[option_index];
+    const std::uint32_t option = ResolveName(option_names_, option_name, "Option");
+
+    if (option == kNoIndex) {
+        const std::string similar_options = utils::GetSimilarValues(option_names_, option_name, "\n");
+
+        throw UnsupportedOption("Option " + std::string(option_name) + " is not supported!" + InterfaceHelper::GetHint(similar_options));
+    }
+    if (option_index + 1U >= argc) {
+        throw MissingOptionValue("Option " + std::string(option_name) + " requires value, but no value has been provided!");
+    }
+    if (!IsOptionAllowed(command, option)) {
+        throw ForbiddenOption("Option " + std::string(option_name) + " is not allowed for " + std::string(command_names_[command]) + " command!");
+    }
+
+    const std::string_view value = argv[option_index + 1U];
+
+    ValidateOptionValue(option, value, "");
+
+    return {option, value};
+}
+
+std::uint32_t CompiledInterface::ParseFlag(char** argv, const std::uint32_t command, const unsigned int flag_index) const
+{
+    const std::string_view flag_name = argv[flag_index];
+    const std::uint32_t flag = ResolveName(flag_names_, flag_name, "Flag");
+
+    // reserved flag is checked only after the declared ones aren't found, so it costs nothing when it isn't used; tracing requested by
+    // it has already been started when the interface was constructed, so it's only skipped
+    if (flag == kNoIndex && flag_name == Tracer::kTraceFlag) {
+        return kNoIndex;
+    }
+    if (flag == kNoIndex) {
+        const std::string similar_flags = utils::GetSimilarValues(flag_names_, flag_name, "\n");
+
+        throw UnsupportedFlag("Flag " + std::string(flag_name) + " is not supported!" + InterfaceHelper::GetHint(similar_flags));
+    }
+    if (!IsFlagAllowed(command, flag)) {
+        throw ForbiddenFlag("Flag " + std::string(flag_name) + " is not allowed for " + std::string(command_names_[command]) + " command!");
+    }
+
+    return flag;
+}
+
+template <typename OptionsMapType>
+void CompiledInterface::ParseEnvironmentOptions(const std::uint32_t command, OptionsMapType &options, BitMask &used_options) const
+{
+    const TraceSpan trace_span("ParseEnvironmentOptions", "parse");
+    const EnvironmentVariables environment_variables(EnvironmentVariables::GetProcessEnvironment());
+
+    for (std::uint32_t option=0U; option<options_.size(); option++) {
+        const std::uint32_t environment_variable = options_[option].environment_variable;
+
+        if (environment_variable == kNoIndex || used_options.Test(option) || !IsOptionAllowed(command, option)) {
+            continue;
+        }
+
+        const std::optional<std::string_view> value = environment_variables.Get(strings_[environment_variable]);
+
+        if (!value) {
+            continue;
+        }
+
+        ValidateOptionValue(option, *value, " (taken from environment variable " + std::string(strings_[environment_variable]) + ")");
+        options.emplace(std::string_view(option_names_[option]), *value);
+        used_options.Set(option);
+    }
+}
+
+template <typename OptionsMapType>
+void CompiledInterface::ParseConfigFileOptions(const std::string_view command_name, const std::uint32_t command, OptionsMapType &options,
+                                               BitMask &used_options) const
+{
+    const TraceSpan trace_span("ParseConfigFileOptions", "parse");
+    const MappedFile config_file {std::string(config_file_path_)};
+
+    if (!config_file.IsMapped()) {
+        return;
+    }
+
+    const ConfigEntries entries = ConfigFile::GetSectionEntries(config_file.GetContent(), command_name);
+    const std::string value_origin = " (taken from configuration file " + std::string(config_file_path_) + ")";
+
+    // later entries override earlier ones, so entries are visited from the last one and only the first occurrence is used
+    for (auto entry = entries.rbegin(); entry != entries.rend(); entry++) {
+        const auto &[option_name, option_value] = *entry;
+        const std::uint32_t option = FindName(option_names_, option_name);
+
+        if (option == kNoIndex) {
+            const std::string similar_options = utils::GetSimilarValues(option_names_, option_name, "\n");
+
+            throw UnsupportedOption("Option " + std::string(option_name) + value_origin + " is not supported!" + InterfaceHelper::GetHint(similar_options));
+        }
+        if (!IsOptionAllowed(command, option)) {
+            throw ForbiddenOption("Option " + std::string(option_name) + value_origin + " is not allowed for " + std::string(command_name) + " command!");
+        }
+        if (used_options.Test(option)) {
+            continue;
+        }
+
+        ValidateOptionValue(option, option_value, value_origin);
+        options.emplace(std::string_view(option_names_[option]), option_value);
+        used_options.Set(option);
+    }
+}
+
+template <typename OptionsMapType>
+void CompiledInterface::ParseDefaultOptions(const std::uint32_t command, OptionsMapType &options, BitMask &used_options) const
+{
+    const TraceSpan trace_span("ParseDefaultOptions", "parse");
+
+    for (std::uint32_t option=0U; option<options_.size(); option++) {
+        const std::uint32_t default_value = options_[option].default_value;
+
+        if (default_value == kNoIndex || used_options.Test(option) || !IsOptionAllowed(command, option)) {
+            continue;
+        }
+
+        options.emplace(std::string_view(option_names_[option]), std::string_view(strings_[default_value]));
+        used_options.Set(option);
+    }
+}
+
+template <typename ParsedCommandType>
+void CompiledInterface::CollectGlobPatterns(const std::uint32_t command, ParsedCommandType &parsed_command) const
+{
+    const TraceSpan trace_span("CollectGlobPatterns", "parse");
+
+    if (command != kNoIndex && commands_[command].glob_expansion != GlobExpansion::kDisabled) {
+        for (const auto &command_value : parsed_command.values) {
+            if (GlobExpander::IsPattern(command_value)) {
+                parsed_command.globs.emplace(command_value, commands_[command].glob_expansion);
+            }
+        }
+    }
+    for (const auto &[option_name, option_value] : parsed_command.options) {
+        const GlobExpansion glob_expansion = options_[FindName(option_names_, option_name)].glob_expansion;
+
+        if (glob_expansion != GlobExpansion::kDisabled && GlobExpander::IsPattern(option_value)) {
+            parsed_command.globs.emplace(option_value, glob_expansion);
+        }
+    }
+}
+
+template <typename ParsedCommandType>
+void CompiledInterface::ValidatePaths(const std::uint32_t command, ParsedCommandType &parsed_command,
+                                      std::pmr::memory_resource *memory_resource) const
+{
+    const TraceSpan trace_span("ValidatePaths", "parse");
+    PathChecks path_checks(memory_resource);
+
+    if (command != kNoIndex && commands_[command].path_requirement != PathRequirement::kNone) {
+        for (const auto &command_value : parsed_command.values) {
+            // patterns are not paths themselves, paths matching them are given by ParsedCommand::ForEachPath
+            if (parsed_command.globs.find(command_value) != parsed_command.globs.end()) {
+                continue;
+            }
+            path_checks.push_back({command_value, commands_[command].path_requirement, parsed_command.name, false});
+        }
+    }
+    for (const auto &[option_name, option_value] : parsed_command.options) {
+        const PathRequirement path_requirement = options_[FindName(option_names_, option_name)].path_requirement;
+
+        if (path_requirement != PathRequirement::kNone && parsed_command.globs.find(option_value) == parsed_command.globs.end()) {
+            path_checks.push_back({option_value, path_requirement, option_name, true});
+        }
+    }
+
+    for (const auto &[path, path_metadata] : PathValidator::Validate(path_checks, memory_resource)) {
+        parsed_command.paths.emplace(path, path_metadata);
+    }
+}
+
+bool CompiledInterface::IsOptionAllowed(const std::uint32_t command, const std::uint32_t option) const
+{
+    return command == kNoIndex || commands_[command].allowed_options_mask.Test(option);
+}
+
+bool CompiledInterface::IsFlagAllowed(const std::uint32_t command, const std::uint32_t flag) const
+{
+    return command == kNoIndex || commands_[command].allowed_flags_mask.Test(flag);
+}
+
+bool CompiledInterface::IsValueAllowed(const StringRange &allowed_values, const ValueDictionaryPtr &allowed_values_dictionary,
+                                       const std::string_view value) const
+{
+    const bool is_on_list = std::find(strings_.begin() + allowed_values.begin, strings_.begin() + allowed_values.end, value) !=
+                            strings_.begin() + allowed_values.end;
+
+    if (allowed_values_dictionary) {
+        return is_on_list || allowed_values_dictionary->Contains(value);
+    }
+
+    return allowed_values.IsEmpty() || is_on_list;
+}
+
+std::string CompiledInterface::GetSimilarValues(const StringRange &allowed_values, const ValueDictionaryPtr &allowed_values_dictionary,
+                                                const std::string_view value) const
+{
+    const TraceSpan trace_span("GetSimilarValues", "hint");
+    std::string similar_values = utils::GetSimilarValues(strings_.begin() + allowed_values.begin, strings_.begin() + allowed_values.end, value, "\n");
+
+    if (allowed_values_dictionary) {
+        // only values stored next to the given one are checked, so that the hint doesn't read the whole dictionary
+        const auto neighbours = allowed_values_dictionary->GetNeighbours(value, kNumOfDictionaryHintCandidates);
+        const std::string similar_neighbours = utils::GetSimilarValues(neighbours.begin(), neighbours.end(), value, "\n");
+
+        if (!similar_values.empty() && !similar_neighbours.empty()) {
+            similar_values.append("\n");
+        }
+
+        similar_values.append(similar_neighbours);
+    }
+
+    return similar_values;
+}
+
+void CompiledInterface::ValidateOptionValue(const std::uint32_t option, const std::string_view value, const std::string &value_origin) const
+{
+    const StringRange &allowed_values = options_[option].allowed_values;
+
+    if (!IsValueAllowed(allowed_values, options_[option].allowed_values_dictionary, value)) {
+        const std::string similar_values = GetSimilarValues(allowed_values, options_[option].allowed_values_dictionary, value);
+
+        throw ForbiddenOptionValue("Given value " + std::string(value) + value_origin + " for option " + std::string(option_names_[option]) +
+                                   " is not allowed!" + InterfaceHelper::GetHint(similar_values));
+    }
+    if (options_[option].value_constraint && !options_[option].value_constraint->IsSatisfied(value)) {
+        throw ForbiddenOptionValue("Given value " + std::string(value) + value_origin + " for option " + std::string(option_names_[option]) +
+                                   " is not allowed! Expected " + options_[option].value_constraint->GetDescription() + ".");
+    }
+}
+
+CompiledInterface::StringRange CompiledInterface::AddStrings(const std::pmr::vector<std::pmr::string> &strings)
+{
+    const std::uint32_t begin = static_cast<std::uint32_t>(strings_.size());
+
+    strings_.insert(strings_.end(), strings.begin(), strings.end());
+
+    return {begin, static_cast<std::uint32_t>(strings_.size())};
+}
+
+std::uint32_t CompiledInterface::AddString(const std::string_view string)
+{
+    strings_.emplace_back(string);
+
+    return static_cast<std::uint32_t>(strings_.size() - 1U);
+}
+
+std::uint32_t CompiledInterface::ResolveName(const std::pmr::vector<std::pmr::string> &names, const std::string_view name,
+                                             const std::string_view element_kind) const
+{
+    const auto starts_with = [name](const std::string_view candidate) { return candidate.substr(0U, name.size()) == name; };
+    const auto found_name = std::lower_bound(names.begin(), names.end(), name, [](const std::pmr::string &lhs, const std::string_view rhs) {
+        return std::string_view(lhs) < rhs;
+    });
+
+    if (found_name == names.end() || (*found_name != name && (!allow_abbreviations_ || !starts_with(*found_name)))) {
+        return kNoIndex;
+    }
+    // exact match precedes all the names it abbreviates, and the only other name starting with the abbreviation would directly follow
+    // the found one, so one more comparison tells whether the abbreviation is unique
+    if (*found_name != name && found_name + 1 != names.end() && starts_with(*(found_name + 1))) {
+        std::string candidates {};
+
+        for (auto candidate = found_name; candidate != names.end() && starts_with(*candidate); candidate++) {
+            candidates.append(candidate == found_name ? "" : "\n").append(*candidate);
+        }
+
+        throw AmbiguousAbbreviation(std::string(element_kind) + " " + std::string(name) + " is ambiguous!" + InterfaceHelper::GetHint(candidates));
+    }
+
+    return static_cast<std::uint32_t>(found_name - names.begin());
+}
+
+std::uint32_t CompiledInterface::FindName(const std::pmr::vector<std::pmr::string> &names, const std::string_view name)
+{
+    const auto found_name = std::lower_bound(names.begin(), names.end(), name, [](const std::pmr::string &lhs, const std::string_view rhs) {
+        return std::string_view(lhs) < rhs;
+    });
+
+    return found_name != names.end() && *found_name == name ? static_cast<std::uint32_t>(found_name - names.begin()) : kNoIndex;
+}
+
+std::string_view CompiledInterface::GetHelp() const
+{
+    if (!static_help_.empty()) {
+        return static_help_;
+    }
+
+    std::call_once(lazy_help_->rendering_flag, [this]() {
+        lazy_help_->help = render_help_();
+        lazy_help_->is_rendered.store(true, std::memory_order_release);
+    });
+
+    return lazy_help_->help;
+}
+
+} // comlint
\ No newline at end of file
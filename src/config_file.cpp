@@ -0,0 +1,121 @@
+#include <algorithm>
+#include <map>
+
+#include "comlint/config_file.hpp"
+#include "comlint/exceptions/invalid_config_file.hpp"
+
+namespace comlint {
+
+static const char kLineSeparator {'\n'};
+static const char kSectionOpening {'['};
+static const char kSectionClosing {']'};
+static const char kKeyValueSeparator {'='};
+static const char kQuote {'"'};
+static const std::string_view kCommentPrefixes {"#;"};
+static const std::string_view kWhitespaces {" \t\r"};
+
+ConfigEntries ConfigFile::GetSectionEntries(const std::string_view content, const std::string_view section_name,
+                                            std::pmr::memory_resource *memory_resource)
+{
+    ConfigEntries entries(memory_resource);
+    bool is_in_section = section_name.empty();
+    std::size_t line_begin = 0U;
+    unsigned int line_number = 0U;
+
+    while (line_begin < content.size()) {
+        const std::size_t line_end = std::min(content.find(kLineSeparator, line_begin), content.size());
+        const std::string_view line = Trim(content.substr(line_begin, line_end - line_begin));
+
+        line_begin = line_end + 1U;
+        line_number++;
+
+        if (line.empty()) {
+            continue;
+        }
+        if (line.front() == kSectionOpening && line.back() == kSectionClosing) {
+            is_in_section = Trim(line.substr(1U, line.size() - 2U)) == section_name;
+            continue;
+        }
+        if (!is_in_section || kCommentPrefixes.find(line.front()) != std::string_view::npos) {
+            continue;
+        }
+
+        entries.push_back(ParseEntry(line, line_number));
+    }
+
+    return entries;
+}
+
+ConfigSections ConfigFile::GetSections(const std::string_view content, std::pmr::memory_resource *memory_resource)
+{
+    ConfigSections sections(memory_resource);
+    // indices of the sections by name, so repeated sections are found without searching all the sections listed so far
+    std::pmr::map<std::string_view, std::size_t> section_indices(memory_resource);
+    std::size_t section_index = 0U;
+    std::size_t line_begin = 0U;
+    unsigned int line_number = 0U;
+
+    sections.emplace_back(std::string_view(), ConfigEntries(memory_resource));
+    section_indices.emplace(std::string_view(), 0U);
+
+    while (line_begin < content.size()) {
+        const std::size_t line_end = std::min(content.find(kLineSeparator, line_begin), content.size());
+        const std::string_view line = Trim(content.substr(line_begin, line_end - line_begin));
+
+        line_begin = line_end + 1U;
+        line_number++;
+
+        if (line.empty()) {
+            continue;
+        }
+        if (line.front() == kSectionOpening && line.back() == kSectionClosing) {
+            const std::string_view section_name = Trim(line.substr(1U, line.size() - 2U));
+            const auto [section, is_new_section] = section_indices.emplace(section_name, sections.size());
+
+            if (is_new_section) {
+                sections.emplace_back(section_name, ConfigEntries(memory_resource));
+            }
+
+            section_index = section->second;
+            continue;
+        }
+        if (kCommentPrefixes.find(line.front()) != std::string_view::npos) {
+            continue;
+        }
+
+        sections[section_index].second.push_back(ParseEntry(line, line_number));
+    }
+
+    return sections;
+}
+
+ConfigEntry ConfigFile::ParseEntry(const std::string_view line, const unsigned int line_number)
+{
+    const std::size_t separator_position = line.find(kKeyValueSeparator);
+    const std::string_view key = Trim(line.substr(0U, separator_position));
+
+    if (separator_position == std::string_view::npos || key.empty()) {
+        throw InvalidConfigFile("Line " + std::to_string(line_number) + " is neither a section header nor a key=value entry!");
+    }
+
+    std::string_view value = Trim(line.substr(separator_position + 1U));
+
+    if (value.size() >= 2U && value.front() == kQuote && value.back() == kQuote) {
+        value = value.substr(1U, value.size() - 2U);
+    }
+
+    return {key, value};
+}
+
+std::string_view ConfigFile::Trim(const std::string_view text)
+{
+    const std::size_t begin = text.find_first_not_of(kWhitespaces);
+
+    if (begin == std::string_view::npos) {
+        return {};
+    }
+
+    return text.substr(begin, text.find_last_not_of(kWhitespaces) - begin + 1U);
+}
+
+} // comlint
\ No newline at end of file
@@ -0,0 +1,52 @@
+#include <cstdlib>
+
+#include "comlint/environment_variables.hpp"
+
+#ifndef _WIN32
+extern char** environ;
+#endif
+
+namespace comlint {
+
+static const char kNameValueSeparator {'='};
+
+EnvironmentVariables::EnvironmentVariables(char** environment, std::pmr::memory_resource *memory_resource)
+: variables_{memory_resource}
+{
+    if (!environment) {
+        return;
+    }
+
+    for (char** entry = environment; *entry; entry++) {
+        const std::string_view variable = *entry;
+        const std::size_t separator_position = variable.find(kNameValueSeparator);
+
+        if (separator_position == std::string_view::npos || separator_position == 0U) {
+            continue;
+        }
+
+        variables_.emplace(variable.substr(0U, separator_position), variable.substr(separator_position + 1U));
+    }
+}
+
+char** EnvironmentVariables::GetProcessEnvironment()
+{
+#ifdef _WIN32
+    return _environ;
+#else
+    return environ;
+#endif
+}
+
+std::optional<std::string_view> EnvironmentVariables::Get(const std::string_view name) const
+{
+    const auto variable = variables_.find(name);
+
+    if (variable == variables_.end()) {
+        return std::nullopt;
+    }
+
+    return variable->second;
+}
+
+} // comlint
\ No newline at end of file
@@ -0,0 +1,267 @@
+#include <algorithm>
+#include <filesystem>
+#include <mutex>
+#include <unordered_map>
+
+#include "comlint/glob_expander.hpp"
+#include "comlint/thread_pool.hpp"
+
+namespace comlint {
+
+namespace {
+
+const std::string kAnyDirectories {"**"};
+
+/**
+ * @brief Matches a single character of the name against the pattern element ("?", "[...]", escaped or literal character) starting at
+ *        the given position of the segment. Position of the next pattern element is stored in next_position.
+ */
+bool MatchesCharacter(const std::string_view segment, const std::size_t position, const char character, std::size_t &next_position)
+{
+    if (segment[position] == '?') {
+        next_position = position + 1U;
+        return true;
+    }
+    if (segment[position] == '\\' && position + 1U < segment.size()) {
+        next_position = position + 2U;
+        return segment[position + 1U] == character;
+    }
+    if (segment[position] == '[') {
+        std::size_t class_begin = position + 1U;
+        const bool is_negated = class_begin < segment.size() && (segment[class_begin] == '!' || segment[class_begin] == '^');
+
+        class_begin += is_negated ? 1U : 0U;
+
+        // "]" directly after the opening bracket is a member of the class
+        const std::size_t class_end = segment.find(']', class_begin + 1U);
+
+        if (class_begin < segment.size() && class_end != std::string_view::npos) {
+            bool is_member = false;
+
+            for (std::size_t i = class_begin; i < class_end; i++) {
+                if (i + 2U < class_end && segment[i + 1U] == '-') {
+                    is_member = is_member || (segment[i] <= character && character <= segment[i + 2U]);
+                    i += 2U;
+                } else {
+                    is_member = is_member || segment[i] == character;
+                }
+            }
+
+            next_position = class_end + 1U;
+            return is_member != is_negated;
+        }
+    }
+
+    next_position = position + 1U;
+    return segment[position] == character;
+}
+
+} // namespace
+
+bool GlobExpander::IsPattern(const std::string_view value)
+{
+    for (std::size_t i = 0U; i < value.size(); i++) {
+        if (value[i] == '\\') {
+            i++;
+        } else if (value[i] == '*' || value[i] == '?' || value[i] == '[') {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool GlobExpander::MatchesSegment(const std::string_view segment, const std::string_view name)
+{
+    std::size_t segment_position = 0U;
+    std::size_t name_position = 0U;
+    std::size_t star_segment_position = std::string_view::npos;
+    std::size_t star_name_position = 0U;
+
+    // on mismatch only the most recent "*" is backtracked, which is enough for patterns without "/", so matching never takes more than
+    // O(segment length * name length) steps
+    while (name_position < name.size()) {
+        std::size_t next_segment_position = 0U;
+
+        if (segment_position < segment.size() && segment[segment_position] == '*') {
+            star_segment_position = ++segment_position;
+            star_name_position = name_position;
+        } else if (segment_position < segment.size() &&
+                   MatchesCharacter(segment, segment_position, name[name_position], next_segment_position)) {
+            segment_position = next_segment_position;
+            name_position++;
+        } else if (star_segment_position != std::string_view::npos) {
+            segment_position = star_segment_position;
+            name_position = ++star_name_position;
+        } else {
+            return false;
+        }
+    }
+
+    while (segment_position < segment.size() && segment[segment_position] == '*') {
+        segment_position++;
+    }
+
+    return segment_position == segment.size();
+}
+
+void GlobExpander::Expand(const std::string &pattern, const GlobExpansion glob_expansion, const GlobMatchCallback &callback)
+{
+    if (!IsPattern(pattern)) {
+        callback(Unescape(pattern));
+        return;
+    }
+
+    std::vector<std::string> segments {};
+    std::string base = !pattern.empty() && pattern.front() == '/' ? "/" : "";
+
+    for (std::size_t begin = 0U; begin < pattern.size();) {
+        const std::size_t end = std::min(pattern.find('/', begin), pattern.size());
+        const std::string segment = pattern.substr(begin, end - begin);
+
+        begin = end + 1U;
+
+        if (segment.empty() || (segment == kAnyDirectories && !segments.empty() && segments.back() == kAnyDirectories)) {
+            continue;
+        }
+        // segments preceding the first wildcard only select the directory in which the walk starts
+        if (segments.empty() && !IsPattern(segment)) {
+            base = JoinPath(base, Unescape(segment));
+            continue;
+        }
+
+        segments.push_back(segment);
+    }
+
+    std::vector<PendingDirectory> level {{base, {0U}}};
+    std::mutex callback_mutex {};
+
+    while (!level.empty()) {
+        std::vector<DirectoryMatches> level_matches(level.size());
+
+        ThreadPool::GetShared().ParallelFor(level.size(), [&](const std::size_t i) {
+            const std::string &directory = level[i].path;
+            std::vector<DirectoryEntry> entries {};
+            std::error_code error {};
+
+            for (std::filesystem::directory_iterator entry(directory.empty() ? "." : directory, error), end; !error && entry != end;
+                 entry.increment(error)) {
+                std::error_code status_error {};
+
+                entries.push_back({entry->path().filename().string(), entry->is_directory(status_error), entry->is_symlink(status_error)});
+            }
+
+            if (glob_expansion == GlobExpansion::kOrdered) {
+                std::sort(entries.begin(), entries.end(), [](const auto &lhs, const auto &rhs) { return lhs.name < rhs.name; });
+            }
+
+            for (const auto &entry : entries) {
+                const std::size_t num_of_matches = level_matches[i].matches.size();
+
+                for (const std::size_t segment : level[i].segments) {
+                    MatchEntry(segments, directory, segment, entry, level_matches[i]);
+                }
+                // all matches of one entry are the same path, so it is reported once even if several segments matched it
+                level_matches[i].matches.resize(std::min(level_matches[i].matches.size(), num_of_matches + 1U));
+            }
+
+            if (glob_expansion != GlobExpansion::kOrdered) {
+                const std::lock_guard<std::mutex> lock(callback_mutex);
+
+                for (const auto &match : level_matches[i].matches) {
+                    callback(match);
+                }
+                level_matches[i].matches.clear();
+            }
+        });
+
+        std::vector<PendingDirectory> next_level {};
+        std::unordered_map<std::string, std::size_t> next_level_indices {};
+
+        for (auto &directory_matches : level_matches) {
+            for (const auto &match : directory_matches.matches) {
+                callback(match);
+            }
+            // "**" may reach the same directory through several parents, which is then walked only once with all its segments
+            for (auto &subdirectory : directory_matches.subdirectories) {
+                const auto [index, is_new] = next_level_indices.try_emplace(subdirectory.path, next_level.size());
+
+                if (is_new) {
+                    next_level.push_back(std::move(subdirectory));
+                    continue;
+                }
+
+                auto &pending_segments = next_level[index->second].segments;
+
+                for (const std::size_t segment : subdirectory.segments) {
+                    if (std::find(pending_segments.begin(), pending_segments.end(), segment) == pending_segments.end()) {
+                        pending_segments.push_back(segment);
+                    }
+                }
+            }
+        }
+
+        level = std::move(next_level);
+    }
+}
+
+void GlobExpander::MatchEntry(const std::vector<std::string> &segments, const std::string &directory, const std::size_t segment,
+                              const DirectoryEntry &entry, DirectoryMatches &directory_matches)
+{
+    const bool is_last_segment = segment + 1U == segments.size();
+    const bool is_hidden = entry.name.front() == '.';
+
+    if (segments[segment] == kAnyDirectories) {
+        if (!is_hidden) {
+            // symbolic links are not followed, so "**" never walks in a cycle
+            if (entry.is_directory && !entry.is_symlink) {
+                directory_matches.subdirectories.push_back({JoinPath(directory, entry.name), {segment}});
+            }
+            if (is_last_segment) {
+                directory_matches.matches.push_back(JoinPath(directory, entry.name));
+            }
+        }
+        // "**" may also match no directory at all
+        if (!is_last_segment) {
+            MatchEntry(segments, directory, segment + 1U, entry, directory_matches);
+        }
+        return;
+    }
+
+    const std::string_view pattern = segments[segment];
+
+    if ((is_hidden && pattern.front() != '.' && IsPattern(pattern)) || !MatchesSegment(pattern, entry.name)) {
+        return;
+    }
+
+    if (is_last_segment) {
+        directory_matches.matches.push_back(JoinPath(directory, entry.name));
+    } else if (entry.is_directory) {
+        directory_matches.subdirectories.push_back({JoinPath(directory, entry.name), {segment + 1U}});
+    }
+}
+
+std::string GlobExpander::JoinPath(const std::string &directory, const std::string &name)
+{
+    if (directory.empty()) {
+        return name;
+    }
+
+    return directory.back() == '/' ? directory + name : directory + "/" + name;
+}
+
+std::string GlobExpander::Unescape(const std::string_view value)
+{
+    std::string unescaped {};
+
+    for (std::size_t i = 0U; i < value.size(); i++) {
+        if (value[i] == '\\' && i + 1U < value.size()) {
+            i++;
+        }
+        unescaped.push_back(value[i]);
+    }
+
+    return unescaped;
+}
+
+} // comlint
\ No newline at end of file
@@ -1,7 +1,11 @@
+#include <algorithm>
+#include <cctype>
 #include <iomanip>
 #include <sstream>
 
 #include "comlint/interface_helper.hpp"
+#include "comlint/path_validator.hpp"
+#include "comlint/tracer.hpp"
 #include "comlint/utils.hpp"
 
 namespace comlint {
@@ -24,9 +28,11 @@ bool InterfaceHelper::IsHelpRequired(const unsigned int argc, char** argv, const
     }
 }
 
-std::string InterfaceHelper::GetHelp(const std::string &program_name, const std::string &program_description, const Commands &commands,
+std::string InterfaceHelper::GetHelp(const std::string_view program_name, const std::string_view program_description, const Commands &commands,
                                      const Options &options, const Flags &flags)
 {
+    const TraceSpan trace_span("RenderHelp", "help");
+
     std::stringstream help {};
 
     help << GetHelpHeader(program_name, program_description);
@@ -42,7 +48,182 @@ std::string InterfaceHelper::GetHint(const std::string &similar_values)
     return similar_values.empty() ? "" : " Did you mean:\n" + similar_values;
 }
 
-std::string InterfaceHelper::GetHelpHeader(const std::string &program_name, const std::string &program_description)
+std::string InterfaceHelper::GetManPage(const std::string_view program_name, const std::string_view program_description, const Commands &commands,
+                                        const Options &options, const Flags &flags)
+{
+    std::string title(program_name);
+    std::stringstream man_page {};
+
+    std::transform(title.begin(), title.end(), title.begin(), [](const unsigned char character) { return std::toupper(character); });
+
+    man_page << ".TH " << EscapeManText(title) << " 1" << std::endl;
+    man_page << ".SH NAME" << std::endl;
+    man_page << EscapeManText(program_name) << " \\- " << EscapeManText(program_description) << std::endl;
+    man_page << ".SH SYNOPSIS" << std::endl;
+    man_page << ".B " << EscapeManText(program_name) << std::endl;
+    man_page << "[command] [command values] [options] [flags]" << std::endl;
+    man_page << ".SH COMMANDS" << std::endl;
+
+    for (const auto &[command_name, command_properties] : commands) {
+        man_page << ".TP" << std::endl << ".B " << EscapeManText(command_name) << std::endl << EscapeManText(command_properties.description) << std::endl;
+
+        if (command_properties.RequiresValue()) {
+            man_page << ".br" << std::endl << "Number of values: " << command_properties.num_of_required_values << std::endl;
+        }
+        if (!command_properties.allowed_values.empty()) {
+            man_page << ".br" << std::endl << "Allowed values: " << EscapeManText(utils::VectorToString(command_properties.allowed_values, ", ")) << std::endl;
+        }
+        if (command_properties.allowed_values_dictionary) {
+            man_page << ".br" << std::endl << "Allowed values: " << EscapeManText(GetDictionarySummary(*command_properties.allowed_values_dictionary)) << std::endl;
+        }
+        if (command_properties.value_constraint) {
+            man_page << ".br" << std::endl << "Value constraint: " << EscapeManText(command_properties.value_constraint->GetDescription()) << std::endl;
+        }
+        if (command_properties.path_requirement != PathRequirement::kNone) {
+            man_page << ".br" << std::endl << "Values must be: " << EscapeManText(PathValidator::GetDescription(command_properties.path_requirement)) << std::endl;
+        }
+        if (command_properties.glob_expansion != GlobExpansion::kDisabled) {
+            man_page << ".br" << std::endl << "Glob patterns: " << GetGlobExpansionSummary(command_properties.glob_expansion) << std::endl;
+        }
+        if (!command_properties.allowed_options.empty()) {
+            man_page << ".br" << std::endl << "Allowed options: " << EscapeManText(utils::VectorToString(command_properties.allowed_options, ", ")) << std::endl;
+        }
+        if (!command_properties.allowed_flags.empty()) {
+            man_page << ".br" << std::endl << "Allowed flags: " << EscapeManText(utils::VectorToString(command_properties.allowed_flags, ", ")) << std::endl;
+        }
+        if (!command_properties.required_options.empty()) {
+            man_page << ".br" << std::endl << "Required options: " << EscapeManText(utils::VectorToString(command_properties.required_options, ", ")) << std::endl;
+        }
+    }
+
+    man_page << ".SH OPTIONS" << std::endl;
+
+    for (const auto &[option_name, option_properties] : options) {
+        man_page << ".TP" << std::endl << ".B " << EscapeManText(option_name) << std::endl << EscapeManText(option_properties.description) << std::endl;
+
+        if (!option_properties.allowed_values.empty()) {
+            man_page << ".br" << std::endl << "Allowed values: " << EscapeManText(utils::VectorToString(option_properties.allowed_values, ", ")) << std::endl;
+        }
+        if (option_properties.allowed_values_dictionary) {
+            man_page << ".br" << std::endl << "Allowed values: " << EscapeManText(GetDictionarySummary(*option_properties.allowed_values_dictionary)) << std::endl;
+        }
+        if (option_properties.value_constraint) {
+            man_page << ".br" << std::endl << "Value constraint: " << EscapeManText(option_properties.value_constraint->GetDescription()) << std::endl;
+        }
+        if (option_properties.path_requirement != PathRequirement::kNone) {
+            man_page << ".br" << std::endl << "Values must be: " << EscapeManText(PathValidator::GetDescription(option_properties.path_requirement)) << std::endl;
+        }
+        if (option_properties.glob_expansion != GlobExpansion::kDisabled) {
+            man_page << ".br" << std::endl << "Glob patterns: " << GetGlobExpansionSummary(option_properties.glob_expansion) << std::endl;
+        }
+        if (!option_properties.default_value.empty()) {
+            man_page << ".br" << std::endl << "Default value: " << EscapeManText(option_properties.default_value) << std::endl;
+        }
+        if (!option_properties.environment_variable.empty()) {
+            man_page << ".br" << std::endl << "Environment variable: " << EscapeManText(option_properties.environment_variable) << std::endl;
+        }
+    }
+
+    man_page << ".SH FLAGS" << std::endl;
+
+    for (const auto &[flag_name, flag_properties] : flags) {
+        man_page << ".TP" << std::endl << ".B " << EscapeManText(flag_name) << std::endl << EscapeManText(flag_properties.description) << std::endl;
+    }
+
+    return man_page.str();
+}
+
+std::string InterfaceHelper::GetMarkdown(const std::string_view program_name, const std::string_view program_description, const Commands &commands,
+                                         const Options &options, const Flags &flags)
+{
+    std::stringstream markdown {};
+
+    markdown << "# " << program_name << std::endl << std::endl;
+    markdown << program_description << std::endl << std::endl;
+    markdown << "## Commands" << std::endl << std::endl;
+
+    for (const auto &[command_name, command_properties] : commands) {
+        markdown << "### `" << command_name << "`" << std::endl << std::endl << command_properties.description << std::endl << std::endl;
+
+        if (command_properties.RequiresValue()) {
+            markdown << "* Number of values: " << command_properties.num_of_required_values << std::endl;
+        }
+        if (!command_properties.allowed_values.empty()) {
+            markdown << "* Allowed values: " << utils::VectorToString(command_properties.allowed_values, "`, `", "`", "`") << std::endl;
+        }
+        if (command_properties.allowed_values_dictionary) {
+            markdown << "* Allowed values: " << GetDictionarySummary(*command_properties.allowed_values_dictionary) << std::endl;
+        }
+        if (command_properties.value_constraint) {
+            markdown << "* Value constraint: `" << command_properties.value_constraint->GetDescription() << "`" << std::endl;
+        }
+        if (command_properties.path_requirement != PathRequirement::kNone) {
+            markdown << "* Values must be: " << PathValidator::GetDescription(command_properties.path_requirement) << std::endl;
+        }
+        if (command_properties.glob_expansion != GlobExpansion::kDisabled) {
+            markdown << "* Glob patterns: " << GetGlobExpansionSummary(command_properties.glob_expansion) << std::endl;
+        }
+        if (!command_properties.allowed_options.empty()) {
+            markdown << "* Allowed options: " << utils::VectorToString(command_properties.allowed_options, "`, `", "`", "`") << std::endl;
+        }
+        if (!command_properties.allowed_flags.empty()) {
+            markdown << "* Allowed flags: " << utils::VectorToString(command_properties.allowed_flags, "`, `", "`", "`") << std::endl;
+        }
+        if (!command_properties.required_options.empty()) {
+            markdown << "* Required options: " << utils::VectorToString(command_properties.required_options, "`, `", "`", "`") << std::endl;
+        }
+        if (command_properties.RequiresValue() || !command_properties.allowed_values.empty() || command_properties.allowed_values_dictionary ||
+            command_properties.value_constraint || command_properties.path_requirement != PathRequirement::kNone ||
+            command_properties.glob_expansion != GlobExpansion::kDisabled ||
+            !command_properties.allowed_options.empty() || !command_properties.allowed_flags.empty() ||
+            !command_properties.required_options.empty()) {
+            markdown << std::endl;
+        }
+    }
+
+    markdown << "## Options" << std::endl << std::endl;
+
+    for (const auto &[option_name, option_properties] : options) {
+        markdown << "### `" << option_name << "`" << std::endl << std::endl << option_properties.description << std::endl << std::endl;
+
+        if (!option_properties.allowed_values.empty()) {
+            markdown << "* Allowed values: " << utils::VectorToString(option_properties.allowed_values, "`, `", "`", "`") << std::endl;
+        }
+        if (option_properties.allowed_values_dictionary) {
+            markdown << "* Allowed values: " << GetDictionarySummary(*option_properties.allowed_values_dictionary) << std::endl;
+        }
+        if (option_properties.value_constraint) {
+            markdown << "* Value constraint: `" << option_properties.value_constraint->GetDescription() << "`" << std::endl;
+        }
+        if (option_properties.path_requirement != PathRequirement::kNone) {
+            markdown << "* Values must be: " << PathValidator::GetDescription(option_properties.path_requirement) << std::endl;
+        }
+        if (option_properties.glob_expansion != GlobExpansion::kDisabled) {
+            markdown << "* Glob patterns: " << GetGlobExpansionSummary(option_properties.glob_expansion) << std::endl;
+        }
+        if (!option_properties.default_value.empty()) {
+            markdown << "* Default value: `" << option_properties.default_value << "`" << std::endl;
+        }
+        if (!option_properties.environment_variable.empty()) {
+            markdown << "* Environment variable: `" << option_properties.environment_variable << "`" << std::endl;
+        }
+        if (!option_properties.allowed_values.empty() || option_properties.allowed_values_dictionary || option_properties.value_constraint ||
+            option_properties.path_requirement != PathRequirement::kNone ||
+            option_properties.glob_expansion != GlobExpansion::kDisabled || !option_properties.default_value.empty() || !option_properties.environment_variable.empty()) {
+            markdown << std::endl;
+        }
+    }
+
+    markdown << "## Flags" << std::endl << std::endl;
+
+    for (const auto &[flag_name, flag_properties] : flags) {
+        markdown << "### `" << flag_name << "`" << std::endl << std::endl << flag_properties.description << std::endl << std::endl;
+    }
+
+    return markdown.str();
+}
+
+std::string InterfaceHelper::GetHelpHeader(const std::string_view program_name, const std::string_view program_description)
 {
     std::stringstream header;
 
@@ -64,6 +245,18 @@ std::string InterfaceHelper::GetCommandsHelp(const Commands &commands)
         if (!command_properties.allowed_values.empty()) {
             help << std::setw(kHelpElementHolderWidth) << std::left << "  allowed values" << utils::VectorToString(command_properties.allowed_values, ", ", "[", "]") << std::endl;
         }
+        if (command_properties.allowed_values_dictionary) {
+            help << std::setw(kHelpElementHolderWidth) << std::left << "  allowed values" << GetDictionarySummary(*command_properties.allowed_values_dictionary) << std::endl;
+        }
+        if (command_properties.value_constraint) {
+            help << std::setw(kHelpElementHolderWidth) << std::left << "  value constraint" << command_properties.value_constraint->GetDescription() << std::endl;
+        }
+        if (command_properties.path_requirement != PathRequirement::kNone) {
+            help << std::setw(kHelpElementHolderWidth) << std::left << "  values must be" << PathValidator::GetDescription(command_properties.path_requirement) << std::endl;
+        }
+        if (command_properties.glob_expansion != GlobExpansion::kDisabled) {
+            help << std::setw(kHelpElementHolderWidth) << std::left << "  glob patterns" << GetGlobExpansionSummary(command_properties.glob_expansion) << std::endl;
+        }
         if (!command_properties.allowed_options.empty()) {
             help << std::setw(kHelpElementHolderWidth) << std::left << "  allowed options" << utils::VectorToString(command_properties.allowed_options, ", ", "[", "]") << std::endl;
         }
@@ -92,6 +285,24 @@ std::string InterfaceHelper::GetOptionsHelp(const Options &options)
         if (!option_properties.allowed_values.empty()) {
             help << std::setw(kHelpElementHolderWidth) << std::left << "  allowed values" << utils::VectorToString(option_properties.allowed_values, ", ", "[", "]") << std::endl;
         }
+        if (option_properties.allowed_values_dictionary) {
+            help << std::setw(kHelpElementHolderWidth) << std::left << "  allowed values" << GetDictionarySummary(*option_properties.allowed_values_dictionary) << std::endl;
+        }
+        if (option_properties.value_constraint) {
+            help << std::setw(kHelpElementHolderWidth) << std::left << "  value constraint" << option_properties.value_constraint->GetDescription() << std::endl;
+        }
+        if (option_properties.path_requirement != PathRequirement::kNone) {
+            help << std::setw(kHelpElementHolderWidth) << std::left << "  values must be" << PathValidator::GetDescription(option_properties.path_requirement) << std::endl;
+        }
+        if (option_properties.glob_expansion != GlobExpansion::kDisabled) {
+            help << std::setw(kHelpElementHolderWidth) << std::left << "  glob patterns" << GetGlobExpansionSummary(option_properties.glob_expansion) << std::endl;
+        }
+        if (!option_properties.default_value.empty()) {
+            help << std::setw(kHelpElementHolderWidth) << std::left << "  default value" << option_properties.default_value << std::endl;
+        }
+        if (!option_properties.environment_variable.empty()) {
+            help << std::setw(kHelpElementHolderWidth) << std::left << "  environment variable" << option_properties.environment_variable << std::endl;
+        }
     }
 
     help << std::endl;
@@ -112,4 +323,38 @@ std::string InterfaceHelper::GetFlagsHelp(const Flags &flags)
     return help.str();
 }
 
+std::string InterfaceHelper::EscapeManText(const std::string_view text)
+{
+    std::string escaped_text {};
+
+    // lines starting with a dot or an apostrophe would be taken as requests
+    if (!text.empty() && (text.front() == '.' || text.front() == '\'')) {
+        escaped_text.append("\\&");
+    }
+
+    for (const char character : text) {
+        if (character == '\\') {
+            escaped_text.append("\\e");
+        }
+        else if (character == '-') {
+            escaped_text.append("\\-");
+        }
+        else {
+            escaped_text.push_back(character);
+        }
+    }
+
+    return escaped_text;
+}
+
+std::string InterfaceHelper::GetDictionarySummary(const ValueDictionary &dictionary)
+{
+    return "one of " + std::to_string(dictionary.GetSize()) + " values listed in " + dictionary.GetPath();
+}
+
+std::string InterfaceHelper::GetGlobExpansionSummary(const GlobExpansion glob_expansion)
+{
+    return glob_expansion == GlobExpansion::kOrdered ? "expanded in deterministic order" : "expanded";
+}
+
 } // comlint
\ No newline at end of file
@@ -0,0 +1,142 @@
+#include <algorithm>
+#include <iterator>
+
+#include "comlint/interface_schema.hpp"
+#include "comlint/interface_validator.hpp"
+#include "comlint/config_file.hpp"
+#include "comlint/exceptions/invalid_interface_schema.hpp"
+
+namespace comlint {
+
+static const std::string_view kProgramSection {"program"};
+static const std::string_view kCommandSectionPrefix {"command:"};
+static const std::string_view kOptionSectionPrefix {"option:"};
+static const std::string_view kFlagSectionPrefix {"flag:"};
+static const char kListSeparator {','};
+static const std::string_view kWhitespaces {" \t"};
+
+namespace {
+
+std::vector<std::string> ParseList(const std::string_view list)
+{
+    std::vector<std::string> elements {};
+    std::size_t element_begin = 0U;
+
+    while (element_begin <= list.size()) {
+        const std::size_t element_end = std::min(list.find(kListSeparator, element_begin), list.size());
+        const std::string_view element = list.substr(element_begin, element_end - element_begin);
+        const std::size_t first = element.find_first_not_of(kWhitespaces);
+
+        if (first != std::string_view::npos) {
+            elements.emplace_back(element.substr(first, element.find_last_not_of(kWhitespaces) - first + 1U));
+        }
+
+        element_begin = element_end + 1U;
+    }
+
+    return elements;
+}
+
+std::string GetValue(const ConfigEntries &entries, const std::string_view section_name, const std::string_view key,
+                     std::initializer_list<std::string_view> allowed_keys)
+{
+    std::string value {};
+
+    for (const auto &[entry_key, entry_value] : entries) {
+        if (std::find(allowed_keys.begin(), allowed_keys.end(), entry_key) == allowed_keys.end()) {
+            throw InvalidInterfaceSchema("Key " + std::string(entry_key) + " is not supported in section " + std::string(section_name) + "!");
+        }
+        if (entry_key == key) {
+            value = entry_value;
+        }
+    }
+
+    return value;
+}
+
+} // namespace
+
+InterfaceSchema::InterfaceSchema(const allocator_type &allocator)
+: program_name(allocator),
+  description(allocator),
+  commands(allocator),
+  options(allocator),
+  flags(allocator)
+{}
+
+InterfaceSchema InterfaceSchema::Parse(const std::string_view content, std::pmr::memory_resource *memory_resource)
+{
+    static const std::initializer_list<std::string_view> kProgramKeys {"name", "description"};
+    static const std::initializer_list<std::string_view> kCommandKeys {"description", "num_of_values", "allowed_values", "allowed_options",
+                                                                       "allowed_flags", "required_options"};
+    static const std::initializer_list<std::string_view> kOptionKeys {"description", "allowed_values", "default_value", "environment_variable"};
+    static const std::initializer_list<std::string_view> kFlagKeys {"description"};
+    InterfaceSchema schema(memory_resource);
+
+    const ConfigSections sections = ConfigFile::GetSections(content);
+
+    if (!sections.front().second.empty()) {
+        throw InvalidInterfaceSchema("Schema must not contain entries placed before the first section!");
+    }
+
+    for (auto section = std::next(sections.begin()); section != sections.end(); section++) {
+        const auto &[section_name, entries] = *section;
+
+        if (section_name == kProgramSection) {
+            schema.program_name = GetValue(entries, section_name, "name", kProgramKeys);
+            schema.description = GetValue(entries, section_name, "description", kProgramKeys);
+        }
+        else if (section_name.substr(0U, kCommandSectionPrefix.size()) == kCommandSectionPrefix) {
+            const std::string command_name(section_name.substr(kCommandSectionPrefix.size()));
+            const std::string num_of_values = GetValue(entries, section_name, "num_of_values", kCommandKeys);
+
+            if (!InterfaceValidator::IsCommandNameValid(command_name)) {
+                throw InvalidInterfaceSchema("Name of the command " + command_name + " is invalid!");
+            }
+            if (num_of_values.find_first_not_of("0123456789") != std::string::npos) {
+                throw InvalidInterfaceSchema("Number of values " + num_of_values + " of the command " + command_name + " is not a number!");
+            }
+
+            schema.commands.emplace(std::piecewise_construct, std::forward_as_tuple(command_name),
+                                    std::forward_as_tuple(ParseList(GetValue(entries, section_name, "allowed_values", kCommandKeys)),
+                                                          ParseList(GetValue(entries, section_name, "allowed_options", kCommandKeys)),
+                                                          ParseList(GetValue(entries, section_name, "allowed_flags", kCommandKeys)),
+                                                          GetValue(entries, section_name, "description", kCommandKeys),
+                                                          num_of_values.empty() ? 0U : static_cast<unsigned int>(std::stoul(num_of_values)),
+                                                          ParseList(GetValue(entries, section_name, "required_options", kCommandKeys))));
+        }
+        else if (section_name.substr(0U, kOptionSectionPrefix.size()) == kOptionSectionPrefix) {
+            const std::string option_name(section_name.substr(kOptionSectionPrefix.size()));
+            const OptionValues allowed_values = ParseList(GetValue(entries, section_name, "allowed_values", kOptionKeys));
+            const OptionValue default_value = GetValue(entries, section_name, "default_value", kOptionKeys);
+
+            if (!InterfaceValidator::IsOptionNameValid(option_name)) {
+                throw InvalidInterfaceSchema("Name of the option " + option_name + " is invalid!");
+            }
+            if (!default_value.empty() && !allowed_values.empty() && std::find(allowed_values.begin(), allowed_values.end(), default_value) == allowed_values.end()) {
+                throw InvalidInterfaceSchema("Default value " + default_value + " of the option " + option_name + " is not one of the allowed values!");
+            }
+
+            schema.options.emplace(std::piecewise_construct, std::forward_as_tuple(option_name),
+                                   std::forward_as_tuple(GetValue(entries, section_name, "description", kOptionKeys), allowed_values, default_value,
+                                                         GetValue(entries, section_name, "environment_variable", kOptionKeys)));
+        }
+        else if (section_name.substr(0U, kFlagSectionPrefix.size()) == kFlagSectionPrefix) {
+            const std::string flag_name(section_name.substr(kFlagSectionPrefix.size()));
+
+            if (!InterfaceValidator::IsFlagNameValid(flag_name)) {
+                throw InvalidInterfaceSchema("Name of the flag " + flag_name + " is invalid!");
+            }
+
+            schema.flags.emplace(std::piecewise_construct, std::forward_as_tuple(flag_name),
+                                 std::forward_as_tuple(GetValue(entries, section_name, "description", kFlagKeys)));
+        }
+        else {
+            throw InvalidInterfaceSchema("Section " + std::string(section_name) + " is not supported!");
+        }
+    }
+
+    return schema;
+}
+
+} // comlint
\ No newline at end of file
@@ -0,0 +1,267 @@
+#include <cstdio>
+
+#include "comlint/invocation_log.hpp"
+#include "comlint/exceptions/invalid_invocation_log.hpp"
+
+namespace comlint {
+
+namespace {
+
+constexpr std::uint64_t kHashOffsetBasis {14695981039346656037ULL};
+constexpr std::uint64_t kHashPrime {1099511628211ULL};
+constexpr std::size_t kSchemaHashSize {8U};
+constexpr std::uint8_t kMaxOutcome {static_cast<std::uint8_t>(InvocationOutcome::kFailed)};
+
+void AppendVarint(std::string &buffer, std::uint64_t number)
+{
+    do {
+        const auto byte = static_cast<std::uint8_t>(number & 0x7FU);
+
+        number >>= 7U;
+        buffer.push_back(static_cast<char>(number == 0U ? byte : byte | 0x80U));
+    } while (number != 0U);
+}
+
+void AppendString(std::string &buffer, const std::string_view text)
+{
+    AppendVarint(buffer, text.size());
+    buffer.append(text);
+}
+
+std::uint64_t ToNanoseconds(const std::chrono::nanoseconds time)
+{
+    return time.count() > 0 ? static_cast<std::uint64_t>(time.count()) : 0U;
+}
+
+/**
+ * @brief Reads fields of a record, throwing InvalidInvocationLog if the record ends prematurely.
+ */
+class RecordReader
+{
+public:
+    RecordReader(const std::string_view content, const std::size_t offset)
+    : content_{content},
+      position_{offset}
+    {}
+
+    std::uint64_t ReadVarint()
+    {
+        std::uint64_t number = 0U;
+
+        for (unsigned int shift = 0U; shift < 64U; shift += 7U) {
+            const auto byte = static_cast<std::uint8_t>(ReadBytes(1U).front());
+
+            number |= static_cast<std::uint64_t>(byte & 0x7FU) << shift;
+
+            if ((byte & 0x80U) == 0U) {
+                return number;
+            }
+        }
+
+        throw InvalidInvocationLog("Number at offset " + std::to_string(position_) + " is too long!");
+    }
+    std::string_view ReadBytes(const std::uint64_t size)
+    {
+        if (size > content_.size() - position_) {
+            throw InvalidInvocationLog("Record ends prematurely at offset " + std::to_string(content_.size()) + "!");
+        }
+
+        const std::string_view bytes = content_.substr(position_, static_cast<std::size_t>(size));
+
+        position_ += static_cast<std::size_t>(size);
+        return bytes;
+    }
+    std::string_view ReadString()
+    {
+        return ReadBytes(ReadVarint());
+    }
+    std::size_t GetPosition() const
+    {
+        return position_;
+    }
+
+private:
+    std::string_view content_;
+    std::size_t position_;
+};
+
+class SchemaHash
+{
+public:
+    void Add(const std::string_view text)
+    {
+        for (const char character : text) {
+            hash_ = (hash_ ^ static_cast<std::uint8_t>(character)) * kHashPrime;
+        }
+
+        // terminator keeps "ab", "c" and "a", "bc" apart
+        hash_ = (hash_ ^ 0xFFU) * kHashPrime;
+    }
+    template <typename StringVector>
+    void AddList(const StringVector &strings)
+    {
+        Add(std::to_string(strings.size()));
+
+        for (const auto &string : strings) {
+            Add(string);
+        }
+    }
+    // checks of the values which are common to commands and options
+    template <typename Properties>
+    void AddValueChecks(const Properties &properties)
+    {
+        Add(properties.allowed_values_dictionary ? std::string_view(properties.allowed_values_dictionary->GetPath()) : "");
+        Add(properties.value_constraint ? std::string_view(properties.value_constraint->GetDescription()) : "");
+        Add(std::to_string(static_cast<unsigned int>(properties.path_requirement)));
+        Add(std::to_string(static_cast<unsigned int>(properties.glob_expansion)));
+    }
+    std::uint64_t Get() const
+    {
+        return hash_;
+    }
+
+private:
+    std::uint64_t hash_ {kHashOffsetBasis};
+};
+
+} // namespace
+
+bool operator==(const InvocationRecord &lhs, const InvocationRecord &rhs)
+{
+    return lhs.schema_hash == rhs.schema_hash && lhs.arguments == rhs.arguments && lhs.outcome == rhs.outcome && lhs.result == rhs.result &&
+           lhs.parse_time == rhs.parse_time && lhs.run_time == rhs.run_time;
+}
+
+std::string InvocationLog::Serialize(const InvocationRecord &record)
+{
+    std::string body {};
+
+    for (std::size_t i = 0U; i < kSchemaHashSize; i++) {
+        body.push_back(static_cast<char>((record.schema_hash >> (8U * i)) & 0xFFU));
+    }
+
+    body.push_back(static_cast<char>(record.outcome));
+    AppendVarint(body, ToNanoseconds(record.parse_time));
+    AppendVarint(body, ToNanoseconds(record.run_time));
+    AppendVarint(body, record.arguments.size());
+
+    for (const std::string &argument : record.arguments) {
+        AppendString(body, argument);
+    }
+
+    AppendString(body, record.result);
+
+    std::string serialized_record(1U, static_cast<char>(kRecordMarker));
+
+    AppendString(serialized_record, body);
+    return serialized_record;
+}
+
+bool InvocationLog::Append(const std::string &log_path, const InvocationRecord &record)
+{
+    const std::string serialized_record = Serialize(record);
+    // append mode makes every write land at the current end of the file, even if other processes are appending as well
+    std::FILE *log_file = std::fopen(log_path.c_str(), "ab");
+
+    if (log_file == nullptr) {
+        return false;
+    }
+
+    // without a buffer the whole record is handed to a single write, instead of being split at the boundaries of the stdio buffer
+    if (std::setvbuf(log_file, nullptr, _IONBF, 0U) != 0) {
+        std::fclose(log_file);
+        return false;
+    }
+
+    const bool is_written = std::fwrite(serialized_record.data(), 1U, serialized_record.size(), log_file) == serialized_record.size();
+
+    return std::fclose(log_file) == 0 && is_written;
+}
+
+std::vector<InvocationRecord> InvocationLog::Read(const std::string_view content)
+{
+    std::vector<InvocationRecord> records {};
+    std::size_t offset = 0U;
+
+    while (offset < content.size()) {
+        if (static_cast<std::uint8_t>(content[offset]) != kRecordMarker) {
+            throw InvalidInvocationLog("Record at offset " + std::to_string(offset) + " doesn't start with the record marker!");
+        }
+
+        RecordReader record_reader(content, offset + 1U);
+        const std::string_view body = record_reader.ReadString();
+        RecordReader body_reader(body, 0U);
+        InvocationRecord record {};
+        const std::string_view schema_hash = body_reader.ReadBytes(kSchemaHashSize);
+
+        for (std::size_t i = 0U; i < kSchemaHashSize; i++) {
+            record.schema_hash |= static_cast<std::uint64_t>(static_cast<std::uint8_t>(schema_hash[i])) << (8U * i);
+        }
+
+        const auto outcome = static_cast<std::uint8_t>(body_reader.ReadBytes(1U).front());
+
+        if (outcome > kMaxOutcome) {
+            throw InvalidInvocationLog("Record at offset " + std::to_string(offset) + " has unknown outcome " + std::to_string(outcome) + "!");
+        }
+
+        record.outcome = static_cast<InvocationOutcome>(outcome);
+        record.parse_time = std::chrono::nanoseconds(static_cast<std::chrono::nanoseconds::rep>(body_reader.ReadVarint()));
+        record.run_time = std::chrono::nanoseconds(static_cast<std::chrono::nanoseconds::rep>(body_reader.ReadVarint()));
+
+        for (std::uint64_t num_of_arguments = body_reader.ReadVarint(); num_of_arguments > 0U; num_of_arguments--) {
+            record.arguments.emplace_back(body_reader.ReadString());
+        }
+
+        record.result = body_reader.ReadString();
+
+        if (body_reader.GetPosition() != body.size()) {
+            throw InvalidInvocationLog("Record at offset " + std::to_string(offset) + " has unexpected trailing bytes!");
+        }
+
+        records.push_back(std::move(record));
+        offset = record_reader.GetPosition();
+    }
+
+    return records;
+}
+
+std::uint64_t InvocationLog::GetSchemaHash(const Commands &commands, const Options &options, const Flags &flags, const bool allow_no_arguments,
+                                           const bool allow_abbreviations, const std::string_view config_file_path)
+{
+    SchemaHash hash {};
+
+    hash.Add(allow_no_arguments ? "1" : "0");
+    hash.Add(allow_abbreviations ? "1" : "0");
+    hash.Add(config_file_path);
+    hash.Add(std::to_string(commands.size()));
+
+    for (const auto &[command_name, command] : commands) {
+        hash.Add(command_name);
+        hash.Add(std::to_string(command.num_of_required_values));
+        hash.AddList(command.allowed_values);
+        hash.AddList(command.allowed_options);
+        hash.AddList(command.allowed_flags);
+        hash.AddList(command.required_options);
+        hash.AddValueChecks(command);
+    }
+
+    hash.Add(std::to_string(options.size()));
+
+    for (const auto &[option_name, option] : options) {
+        hash.Add(option_name);
+        hash.AddList(option.allowed_values);
+        hash.Add(option.default_value);
+        hash.Add(option.environment_variable);
+        hash.AddValueChecks(option);
+    }
+
+    hash.Add(std::to_string(flags.size()));
+
+    for (const auto &[flag_name, flag] : flags) {
+        hash.Add(flag_name);
+    }
+
+    return hash.Get();
+}
+
+} // comlint
\ No newline at end of file
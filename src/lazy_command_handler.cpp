@@ -0,0 +1,52 @@
+#include "comlint/lazy_command_handler.hpp"
+#include "comlint/tracer.hpp"
+#include "comlint/exceptions/invalid_command_handler.hpp"
+
+namespace comlint {
+
+LazyCommandHandler::LazyCommandHandler(CommandHandlerFactory command_handler_factory)
+: command_handler_factory_{std::move(command_handler_factory)},
+  creation_flag_{},
+  command_handler_{},
+  is_created_{false}
+{}
+
+void LazyCommandHandler::Run(const ParsedCommand &command)
+{
+    GetHandler(command).Run(command);
+}
+
+void LazyCommandHandler::Run(const ParsedCommand &command, OutputSink &output)
+{
+    GetHandler(command).Run(command, output);
+}
+
+void LazyCommandHandler::Run(const ParsedCommand &command, OutputSink &output, const CancellationToken &cancellation_token)
+{
+    GetHandler(command).Run(command, output, cancellation_token);
+}
+
+bool LazyCommandHandler::IsCreated() const
+{
+    return is_created_.load(std::memory_order_acquire);
+}
+
+CommandHandlerInterface& LazyCommandHandler::GetHandler(const ParsedCommand &command)
+{
+    // concurrent runs (e.g. of a command with fan-out) wait for the handler created by the first of them
+    std::call_once(creation_flag_, [this, &command]() {
+        const TraceSpan trace_span("CreateCommandHandler", "handler");
+        CommandHandlerPtr command_handler = command_handler_factory_();
+
+        if (!command_handler) {
+            throw InvalidCommandHandler("Command handler factory of " + command.name + " command returned a nullptr!");
+        }
+
+        command_handler_ = std::move(command_handler);
+        is_created_.store(true, std::memory_order_release);
+    });
+
+    return *command_handler_;
+}
+
+} // comlint
\ No newline at end of file
@@ -0,0 +1,150 @@
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "comlint/mapped_file.hpp"
+
+namespace comlint {
+
+#ifdef _WIN32
+
+MappedFile::MappedFile(const std::string &path)
+: is_mapped_{false},
+  data_{nullptr},
+  size_{0U},
+  file_handle_{INVALID_HANDLE_VALUE},
+  mapping_handle_{nullptr}
+{
+    file_handle_ = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+    if (file_handle_ == INVALID_HANDLE_VALUE) {
+        return;
+    }
+
+    LARGE_INTEGER file_size {};
+
+    if (!GetFileSizeEx(file_handle_, &file_size)) {
+        Unmap();
+        return;
+    }
+
+    size_ = static_cast<std::size_t>(file_size.QuadPart);
+
+    if (size_ == 0U) {
+        is_mapped_ = true;
+        return;
+    }
+
+    mapping_handle_ = CreateFileMappingA(file_handle_, nullptr, PAGE_READONLY, 0U, 0U, nullptr);
+
+    if (!mapping_handle_) {
+        Unmap();
+        return;
+    }
+
+    data_ = static_cast<const char*>(MapViewOfFile(mapping_handle_, FILE_MAP_READ, 0U, 0U, 0U));
+
+    if (!data_) {
+        Unmap();
+        return;
+    }
+
+    is_mapped_ = true;
+}
+
+void MappedFile::Unmap()
+{
+    if (data_) {
+        UnmapViewOfFile(data_);
+    }
+    if (mapping_handle_) {
+        CloseHandle(mapping_handle_);
+    }
+    if (file_handle_ != INVALID_HANDLE_VALUE) {
+        CloseHandle(file_handle_);
+    }
+
+    is_mapped_ = false;
+    data_ = nullptr;
+    size_ = 0U;
+    file_handle_ = INVALID_HANDLE_VALUE;
+    mapping_handle_ = nullptr;
+}
+
+#else
+
+MappedFile::MappedFile(const std::string &path)
+: is_mapped_{false},
+  data_{nullptr},
+  size_{0U},
+  file_descriptor_{-1}
+{
+    file_descriptor_ = open(path.c_str(), O_RDONLY);
+
+    if (file_descriptor_ < 0) {
+        return;
+    }
+
+    struct stat file_status {};
+
+    if (fstat(file_descriptor_, &file_status) != 0 || !S_ISREG(file_status.st_mode)) {
+        Unmap();
+        return;
+    }
+
+    size_ = static_cast<std::size_t>(file_status.st_size);
+
+    if (size_ == 0U) {
+        is_mapped_ = true;
+        return;
+    }
+
+    void* data = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, file_descriptor_, 0);
+
+    if (data == MAP_FAILED) {
+        Unmap();
+        return;
+    }
+
+    data_ = static_cast<const char*>(data);
+    is_mapped_ = true;
+}
+
+void MappedFile::Unmap()
+{
+    if (data_) {
+        munmap(const_cast<char*>(data_), size_);
+    }
+    if (file_descriptor_ >= 0) {
+        close(file_descriptor_);
+    }
+
+    is_mapped_ = false;
+    data_ = nullptr;
+    size_ = 0U;
+    file_descriptor_ = -1;
+}
+
+#endif
+
+MappedFile::~MappedFile()
+{
+    Unmap();
+}
+
+bool MappedFile::IsMapped() const
+{
+    return is_mapped_;
+}
+
+std::string_view MappedFile::GetContent() const
+{
+    return data_ ? std::string_view(data_, size_) : std::string_view();
+}
+
+} // comlint
\ No newline at end of file
@@ -0,0 +1,100 @@
+#include "comlint/memory_footprint.hpp"
+#include "comlint/interface_helper.hpp"
+
+namespace comlint {
+
+std::size_t MemoryFootprint::GetTotal() const
+{
+    return names + descriptions + allowed_values + lookup_indexes + handlers;
+}
+
+MemoryFootprint& MemoryFootprint::operator+=(const MemoryFootprint &other)
+{
+    names += other.names;
+    descriptions += other.descriptions;
+    allowed_values += other.allowed_values;
+    lookup_indexes += other.lookup_indexes;
+    handlers += other.handlers;
+
+    return *this;
+}
+
+MemoryFootprint MemoryFootprint::GetCommandFootprint(const std::pmr::string &command_name, const CommandProperties &command_properties)
+{
+    MemoryFootprint footprint {};
+
+    footprint.names = GetHeapSize(command_name);
+    footprint.descriptions = GetHeapSize(command_properties.description);
+    footprint.allowed_values = GetHeapSize(command_properties.allowed_values) + GetHeapSize(command_properties.allowed_options) +
+                               GetHeapSize(command_properties.allowed_flags) + GetHeapSize(command_properties.required_options) +
+                               GetHeapSize(command_properties.allowed_values_dictionary) + GetHeapSize(command_properties.value_constraint);
+    footprint.lookup_indexes = GetMapNodeSize<Commands::value_type>();
+
+    return footprint;
+}
+
+MemoryFootprint MemoryFootprint::GetOptionFootprint(const std::pmr::string &option_name, const OptionProperties &option_properties)
+{
+    MemoryFootprint footprint {};
+
+    footprint.names = GetHeapSize(option_name);
+    footprint.descriptions = GetHeapSize(option_properties.description);
+    footprint.allowed_values = GetHeapSize(option_properties.allowed_values) + GetHeapSize(option_properties.default_value) +
+                               GetHeapSize(option_properties.environment_variable) + GetHeapSize(option_properties.allowed_values_dictionary) +
+                               GetHeapSize(option_properties.value_constraint);
+    footprint.lookup_indexes = GetMapNodeSize<Options::value_type>();
+
+    return footprint;
+}
+
+MemoryFootprint MemoryFootprint::GetFlagFootprint(const std::pmr::string &flag_name, const FlagProperties &flag_properties)
+{
+    MemoryFootprint footprint {};
+
+    footprint.names = GetHeapSize(flag_name);
+    footprint.descriptions = GetHeapSize(flag_properties.description);
+    footprint.lookup_indexes = GetMapNodeSize<Flags::value_type>();
+
+    return footprint;
+}
+
+std::size_t MemoryFootprint::GetHeapSize(const std::pmr::string &string)
+{
+    static const std::size_t kInlineCapacity {std::pmr::string().capacity()};
+
+    return string.capacity() > kInlineCapacity ? string.capacity() + 1U : 0U;
+}
+
+std::size_t MemoryFootprint::GetHeapSize(const std::pmr::vector<std::pmr::string> &strings)
+{
+    std::size_t heap_size = strings.capacity() * sizeof(std::pmr::string);
+
+    for (const auto &string : strings) {
+        heap_size += GetHeapSize(string);
+    }
+
+    return heap_size;
+}
+
+std::size_t MemoryFootprint::GetHeapSize(const ValueDictionaryPtr &dictionary)
+{
+    if (!dictionary) {
+        return 0U;
+    }
+
+    const std::size_t path_capacity = dictionary->GetPath().capacity();
+
+    return sizeof(ValueDictionary) + (path_capacity > std::string().capacity() ? path_capacity + 1U : 0U);
+}
+
+std::size_t MemoryFootprint::GetHeapSize(const ValueConstraintPtr &constraint)
+{
+    return constraint ? sizeof(ValueConstraint) + constraint->GetHeapSize() : 0U;
+}
+
+MemoryFootprint operator+(MemoryFootprint lhs, const MemoryFootprint &rhs)
+{
+    return lhs += rhs;
+}
+
+} // comlint
\ No newline at end of file
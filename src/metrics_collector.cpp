@@ -0,0 +1,453 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#if defined(__GNUC__)
+#include <cxxabi.h>
+#endif
+
+#include "comlint/metrics_collector.hpp"
+
+namespace comlint {
+
+namespace {
+
+std::atomic<std::uint64_t> next_collector_id {1U};
+
+// labels may contain any text, so backslashes, quotes and line breaks have to be escaped
+std::string EscapeLabel(const std::string_view label)
+{
+    std::string escaped {};
+
+    for (const char character : label) {
+        if (character == '\\' || character == '"') {
+            escaped.push_back('\\');
+            escaped.push_back(character);
+        } else if (character == '\n') {
+            escaped.append("\\n");
+        } else {
+            escaped.push_back(character);
+        }
+    }
+
+    return escaped;
+}
+
+std::string ToSeconds(const std::uint64_t nanoseconds)
+{
+    char seconds[32U] {};
+
+    std::snprintf(seconds, sizeof(seconds), "%.9g", static_cast<double>(nanoseconds) / 1e9);
+
+    return seconds;
+}
+
+} // namespace
+
+std::size_t LatencyHistogram::GetBucket(const std::uint64_t nanoseconds)
+{
+    if (nanoseconds < kNumOfSubBuckets) {
+        return static_cast<std::size_t>(nanoseconds);
+    }
+
+    const std::size_t exponent = GetExponent(nanoseconds);
+
+    if (exponent >= kMaxExponent) {
+        return kNumOfBuckets - 1U;
+    }
+
+    // bits below the leading one select the sub-bucket, the rest of them are dropped
+    const std::size_t sub_bucket = static_cast<std::size_t>(nanoseconds >> (exponent - kSubBucketBits)) & (kNumOfSubBuckets - 1U);
+
+    return (exponent - kSubBucketBits + 1U) * kNumOfSubBuckets + sub_bucket;
+}
+
+std::uint64_t LatencyHistogram::GetUpperBound(const std::size_t bucket)
+{
+    const std::size_t next_bucket = bucket + 1U;
+
+    if (next_bucket >= kNumOfBuckets) {
+        return UINT64_MAX;
+    }
+    if (next_bucket < kNumOfSubBuckets) {
+        return next_bucket;
+    }
+
+    const std::size_t exponent = next_bucket / kNumOfSubBuckets + kSubBucketBits - 1U;
+
+    return static_cast<std::uint64_t>(kNumOfSubBuckets + next_bucket % kNumOfSubBuckets) << (exponent - kSubBucketBits);
+}
+
+std::size_t LatencyHistogram::GetExponent(const std::uint64_t value)
+{
+#if defined(__GNUC__)
+    return 63U - static_cast<std::size_t>(__builtin_clzll(value));
+#else
+    std::size_t exponent = 0U;
+
+    for (std::uint64_t rest = value >> 1U; rest != 0U; rest >>= 1U) {
+        exponent++;
+    }
+
+    return exponent;
+#endif
+}
+
+std::chrono::nanoseconds CommandMetrics::GetQuantile(const double fraction) const
+{
+    std::uint64_t num_of_latencies = 0U;
+
+    for (const std::uint64_t bucket_size : latency_buckets) {
+        num_of_latencies += bucket_size;
+    }
+
+    const auto rank = static_cast<std::uint64_t>(std::ceil(fraction * static_cast<double>(num_of_latencies)));
+    std::uint64_t num_of_lower_latencies = 0U;
+
+    for (std::size_t bucket = 0U; bucket < latency_buckets.size(); bucket++) {
+        num_of_lower_latencies += latency_buckets[bucket];
+
+        if (num_of_lower_latencies > 0U && num_of_lower_latencies >= rank) {
+            return std::chrono::nanoseconds(static_cast<std::int64_t>(std::min<std::uint64_t>(LatencyHistogram::GetUpperBound(bucket), INT64_MAX)));
+        }
+    }
+
+    return std::chrono::nanoseconds(0);
+}
+
+MetricsCollector::CounterTable::CounterTable(const std::size_t size)
+: size{size},
+  commands{new std::atomic<CommandCounters*>[size]}
+{
+    for (std::size_t command = 0U; command < size; command++) {
+        commands[command].store(nullptr);
+    }
+}
+
+MetricsCollector::Shard::Shard(const std::size_t num_of_commands)
+: table{nullptr},
+  tables{}
+{
+    tables.push_back(std::make_unique<CounterTable>(num_of_commands));
+    table.store(tables.back().get());
+}
+
+MetricsCollector::MetricsCollector(const std::string &program_name, const std::vector<std::string> &command_names, const MetricsSettings &settings)
+: id_{next_collector_id++},
+  program_name_{program_name},
+  command_names_{command_names},
+  settings_{settings},
+  shards_mutex_{},
+  shards_{},
+  write_mutex_{},
+  writer_mutex_{},
+  writer_stopped_{},
+  is_writer_stopping_{false},
+  writer_{}
+{
+    if (!settings_.path.empty() && settings_.write_interval.count() > 0) {
+        writer_ = std::thread(&MetricsCollector::RunWriter, this);
+    }
+}
+
+MetricsCollector::~MetricsCollector()
+{
+    {
+        const std::lock_guard<std::mutex> lock(writer_mutex_);
+
+        is_writer_stopping_ = true;
+    }
+
+    writer_stopped_.notify_one();
+
+    if (writer_.joinable()) {
+        writer_.join();
+    }
+
+    Write();
+
+    // counters created before the table was replaced are in the current table as well
+    for (auto &[thread_id, shard] : shards_) {
+        const CounterTable &table = *shard->table.load();
+
+        for (std::size_t command = 0U; command < table.size; command++) {
+            delete table.commands[command].load();
+        }
+    }
+}
+
+void MetricsCollector::RecordRun(const std::uint32_t command, const std::chrono::nanoseconds latency, const std::type_info *error_type)
+{
+    Shard &shard = GetShard();
+    CounterTable *table = shard.table.load(std::memory_order_relaxed);
+
+    if (command >= table->size) {
+        table = &GrowTable(shard, command + 1U);
+    }
+
+    std::atomic<CommandCounters*> &command_slot = table->commands[command];
+    CommandCounters *counters = command_slot.load(std::memory_order_relaxed);
+
+    if (counters == nullptr) {
+        counters = new CommandCounters();
+        command_slot.store(counters, std::memory_order_release);
+    }
+
+    const auto nanoseconds = static_cast<std::uint64_t>(std::max<std::int64_t>(0, latency.count()));
+
+    Increment(counters->num_of_runs);
+    Increment(counters->total_latency, nanoseconds);
+    Increment(counters->latency_buckets[LatencyHistogram::GetBucket(nanoseconds)]);
+
+    if (error_type == nullptr) {
+        return;
+    }
+
+    for (ErrorCounter &error_counter : counters->errors) {
+        const std::type_info *counted_type = error_counter.type.load(std::memory_order_relaxed);
+
+        if (counted_type == nullptr) {
+            error_counter.type.store(error_type, std::memory_order_release);
+            Increment(error_counter.count);
+            return;
+        }
+        // type_info objects of the same type may differ across shared libraries, so they are compared rather than their addresses
+        if (*counted_type == *error_type) {
+            Increment(error_counter.count);
+            return;
+        }
+    }
+
+    Increment(counters->num_of_other_errors);
+}
+
+std::vector<CommandMetrics> MetricsCollector::GetSnapshot() const
+{
+    const std::lock_guard<std::mutex> lock(shards_mutex_);
+    std::vector<CommandMetrics> snapshot(command_names_.size());
+
+    for (std::size_t command = 0U; command < command_names_.size(); command++) {
+        CommandMetrics &command_metrics = snapshot[command];
+
+        command_metrics.name = command_names_[command];
+        command_metrics.num_of_runs = 0U;
+        command_metrics.total_latency = std::chrono::nanoseconds(0);
+        command_metrics.latency_buckets.fill(0U);
+
+        for (const auto &[thread_id, shard] : shards_) {
+            const CounterTable &table = *shard->table.load(std::memory_order_acquire);
+            const CommandCounters *counters = command < table.size ? table.commands[command].load(std::memory_order_acquire) : nullptr;
+
+            if (counters == nullptr) {
+                continue;
+            }
+
+            command_metrics.num_of_runs += counters->num_of_runs.load(std::memory_order_relaxed);
+            command_metrics.total_latency += std::chrono::nanoseconds(counters->total_latency.load(std::memory_order_relaxed));
+
+            for (std::size_t bucket = 0U; bucket < LatencyHistogram::kNumOfBuckets; bucket++) {
+                command_metrics.latency_buckets[bucket] += counters->latency_buckets[bucket].load(std::memory_order_relaxed);
+            }
+            for (const ErrorCounter &error_counter : counters->errors) {
+                const std::type_info *error_type = error_counter.type.load(std::memory_order_acquire);
+
+                if (error_type != nullptr) {
+                    command_metrics.num_of_errors[GetTypeName(*error_type)] += error_counter.count.load(std::memory_order_relaxed);
+                }
+            }
+
+            const std::uint64_t num_of_other_errors = counters->num_of_other_errors.load(std::memory_order_relaxed);
+
+            if (num_of_other_errors > 0U) {
+                command_metrics.num_of_errors["other"] += num_of_other_errors;
+            }
+        }
+    }
+
+    return snapshot;
+}
+
+std::string MetricsCollector::GetPrometheusText() const
+{
+    const std::vector<CommandMetrics> snapshot = GetSnapshot();
+    const std::string program_label = "program=\"" + EscapeLabel(program_name_) + "\"";
+    std::ostringstream runs {};
+    std::ostringstream errors {};
+    std::ostringstream latencies {};
+
+    runs << "# HELP comlint_command_runs_total Number of runs of the command handler.\n"
+         << "# TYPE comlint_command_runs_total counter\n";
+    errors << "# HELP comlint_command_errors_total Number of runs of the command handler which have thrown, by type of the exception.\n"
+           << "# TYPE comlint_command_errors_total counter\n";
+    latencies << "# HELP comlint_command_latency_seconds Time spent in the command handler.\n"
+              << "# TYPE comlint_command_latency_seconds histogram\n";
+
+    for (const CommandMetrics &command_metrics : snapshot) {
+        if (command_metrics.num_of_runs == 0U) {
+            continue;
+        }
+
+        const std::string labels = program_label + ",command=\"" + EscapeLabel(command_metrics.name) + "\"";
+        std::uint64_t num_of_lower_latencies = 0U;
+
+        runs << "comlint_command_runs_total{" << labels << "} " << command_metrics.num_of_runs << "\n";
+
+        for (const auto &[error_type, num_of_errors] : command_metrics.num_of_errors) {
+            errors << "comlint_command_errors_total{" << labels << ",exception=\"" << EscapeLabel(error_type) << "\"} " << num_of_errors << "\n";
+        }
+
+        // exported buckets are the powers of two from about a microsecond, each of them spanning all the sub-buckets below it
+        for (std::size_t bucket = 0U; bucket + 1U < LatencyHistogram::kNumOfBuckets; bucket++) {
+            const std::uint64_t upper_bound = LatencyHistogram::GetUpperBound(bucket);
+
+            num_of_lower_latencies += command_metrics.latency_buckets[bucket];
+
+            if (upper_bound >= 1024U && (upper_bound & (upper_bound - 1U)) == 0U) {
+                latencies << "comlint_command_latency_seconds_bucket{" << labels << ",le=\"" << ToSeconds(upper_bound) << "\"} "
+                          << num_of_lower_latencies << "\n";
+            }
+        }
+
+        latencies << "comlint_command_latency_seconds_bucket{" << labels << ",le=\"+Inf\"} " << command_metrics.num_of_runs << "\n"
+                  << "comlint_command_latency_seconds_sum{" << labels << "} "
+                  << ToSeconds(static_cast<std::uint64_t>(command_metrics.total_latency.count())) << "\n"
+                  << "comlint_command_latency_seconds_count{" << labels << "} " << command_metrics.num_of_runs << "\n";
+    }
+
+    return runs.str() + errors.str() + latencies.str();
+}
+
+void MetricsCollector::Write() const
+{
+    if (settings_.path.empty()) {
+        return;
+    }
+
+    const std::lock_guard<std::mutex> lock(write_mutex_);
+    const std::string text = GetPrometheusText();
+
+    // metrics must never break the program, so a file which can't be written is skipped until the next write
+    if (settings_.is_appending) {
+        std::ofstream metrics_file(settings_.path, std::ios::app);
+
+        metrics_file << "# Written at " << std::time(nullptr) << "\n" << text;
+        return;
+    }
+
+    // readers (e.g. node exporter) must never see a partially written file, so it's replaced at once
+    const std::string temporary_path = settings_.path + ".tmp";
+    std::error_code error {};
+
+    {
+        std::ofstream metrics_file(temporary_path, std::ios::trunc);
+
+        metrics_file << text;
+
+        if (!metrics_file) {
+            return;
+        }
+    }
+
+    std::filesystem::rename(temporary_path, settings_.path, error);
+}
+
+std::uint32_t MetricsCollector::AddCommand(const std::string &command_name)
+{
+    const std::lock_guard<std::mutex> lock(shards_mutex_);
+    const auto command = std::find(command_names_.begin(), command_names_.end(), command_name);
+
+    if (command != command_names_.end()) {
+        return static_cast<std::uint32_t>(command - command_names_.begin());
+    }
+
+    command_names_.push_back(command_name);
+
+    return static_cast<std::uint32_t>(command_names_.size() - 1U);
+}
+
+MetricsCollector::Shard& MetricsCollector::GetShard()
+{
+    struct ShardCache
+    {
+        std::uint64_t collector_id;
+        Shard *shard;
+    };
+
+    // ids are never reused, so the cache can't point to a shard of a destroyed collector created at the same address
+    thread_local ShardCache shard_cache {0U, nullptr};
+
+    if (shard_cache.collector_id == id_) {
+        return *shard_cache.shard;
+    }
+
+    const std::lock_guard<std::mutex> lock(shards_mutex_);
+    std::unique_ptr<Shard> &shard = shards_[std::this_thread::get_id()];
+
+    if (!shard) {
+        shard = std::make_unique<Shard>(command_names_.size());
+    }
+
+    shard_cache = {id_, shard.get()};
+
+    return *shard;
+}
+
+MetricsCollector::CounterTable& MetricsCollector::GrowTable(Shard &shard, const std::size_t min_size)
+{
+    // only the thread owning the shard replaces its table, so the counters can't be created in the old one meanwhile
+    const CounterTable &table = *shard.tables.back();
+    auto grown_table = std::make_unique<CounterTable>(std::max(min_size, 2U * table.size));
+
+    for (std::size_t command = 0U; command < table.size; command++) {
+        grown_table->commands[command].store(table.commands[command].load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+
+    shard.tables.push_back(std::move(grown_table));
+    shard.table.store(shard.tables.back().get(), std::memory_order_release);
+
+    return *shard.tables.back();
+}
+
+void MetricsCollector::RunWriter()
+{
+    std::unique_lock<std::mutex> lock(writer_mutex_);
+
+    while (!writer_stopped_.wait_for(lock, settings_.write_interval, [this]() { return is_writer_stopping_; })) {
+        lock.unlock();
+        Write();
+        lock.lock();
+    }
+}
+
+std::string MetricsCollector::GetTypeName(const std::type_info &type)
+{
+    if (type == typeid(void)) {
+        return "unknown";
+    }
+
+#if defined(__GNUC__)
+    int status = 0;
+    char *demangled_name = abi::__cxa_demangle(type.name(), nullptr, nullptr, &status);
+
+    if (status == 0 && demangled_name != nullptr) {
+        std::string name {demangled_name};
+
+        std::free(demangled_name);
+        return name;
+    }
+#endif
+
+    return type.name();
+}
+
+void MetricsCollector::Increment(std::atomic<std::uint64_t> &counter, const std::uint64_t value)
+{
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+} // comlint
\ No newline at end of file
@@ -0,0 +1,168 @@
+#include "comlint/output_sink.hpp"
+
+namespace comlint {
+
+OutputSink::OutputSink(std::ostream &stream, const std::size_t buffer_size)
+: mutex_{},
+  stream_{&stream},
+  parent_{nullptr},
+  sequence_number_{0U},
+  buffer_size_{buffer_size},
+  buffer_{},
+  is_closed_{false},
+  next_child_sequence_number_{0U},
+  next_merged_sequence_number_{0U},
+  closed_children_{}
+{}
+
+OutputSink::OutputSink(OutputSink &parent, const std::size_t sequence_number)
+: mutex_{},
+  stream_{nullptr},
+  parent_{&parent},
+  sequence_number_{sequence_number},
+  buffer_size_{parent.buffer_size_},
+  buffer_{},
+  is_closed_{false},
+  next_child_sequence_number_{0U},
+  next_merged_sequence_number_{0U},
+  closed_children_{}
+{}
+
+OutputSink::~OutputSink()
+{
+    if (parent_ != nullptr) {
+        Close();
+        return;
+    }
+
+    try {
+        Flush();
+    }
+    catch (...) {
+        // destructor must not throw, output which can't be written is lost
+    }
+}
+
+void OutputSink::Write(const std::string_view text)
+{
+    const std::lock_guard<std::mutex> lock(mutex_);
+
+    Append(text);
+}
+
+void OutputSink::Flush()
+{
+    const std::lock_guard<std::mutex> lock(mutex_);
+
+    FlushStream();
+}
+
+std::unique_ptr<OutputSink> OutputSink::CreateChild()
+{
+    const std::lock_guard<std::mutex> lock(mutex_);
+
+    return std::unique_ptr<OutputSink>(new OutputSink(*this, next_child_sequence_number_++));
+}
+
+void OutputSink::Close()
+{
+    std::string text {};
+
+    {
+        const std::lock_guard<std::mutex> lock(mutex_);
+
+        if (parent_ == nullptr || is_closed_) {
+            return;
+        }
+
+        is_closed_ = true;
+        text.swap(buffer_);
+    }
+
+    parent_->MergeChild(sequence_number_, std::move(text));
+}
+
+void OutputSink::Append(const std::string_view text)
+{
+    if (is_closed_) {
+        return;
+    }
+    if (stream_ == nullptr) {
+        buffer_.append(text);
+
+        if (buffer_.size() > buffer_size_) {
+            PassToParent(false);
+        }
+        return;
+    }
+    if (buffer_.size() + text.size() > buffer_size_) {
+        FlushBuffer();
+    }
+    // text which doesn't fit in the buffer at all is written directly, without copying it
+    if (text.size() > buffer_size_) {
+        stream_->write(text.data(), static_cast<std::streamsize>(text.size()));
+        return;
+    }
+    if (buffer_.capacity() < buffer_size_) {
+        buffer_.reserve(buffer_size_);
+    }
+
+    buffer_.append(text);
+}
+
+void OutputSink::FlushBuffer()
+{
+    stream_->write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+    buffer_.clear();
+}
+
+void OutputSink::FlushStream()
+{
+    if (stream_ == nullptr) {
+        PassToParent(true);
+        return;
+    }
+
+    FlushBuffer();
+    stream_->flush();
+}
+
+void OutputSink::PassToParent(const bool flush)
+{
+    // parent is always locked after its child, so the locks are never taken in opposite order
+    if (!is_closed_ && parent_->AppendFromChild(sequence_number_, buffer_, flush)) {
+        buffer_.clear();
+    }
+}
+
+bool OutputSink::AppendFromChild(const std::size_t sequence_number, const std::string_view text, const bool flush)
+{
+    const std::lock_guard<std::mutex> lock(mutex_);
+
+    // text of a child which is not the eldest open one would end up before the output of its elder siblings
+    if (sequence_number != next_merged_sequence_number_) {
+        return false;
+    }
+
+    Append(text);
+
+    if (flush) {
+        FlushStream();
+    }
+    return true;
+}
+
+void OutputSink::MergeChild(const std::size_t sequence_number, std::string &&text)
+{
+    const std::lock_guard<std::mutex> lock(mutex_);
+
+    closed_children_.emplace(sequence_number, std::move(text));
+
+    for (auto child = closed_children_.begin(); child != closed_children_.end() && child->first == next_merged_sequence_number_;
+         child = closed_children_.erase(child)) {
+        Append(child->second);
+        next_merged_sequence_number_++;
+    }
+}
+
+} // comlint
\ No newline at end of file
@@ -7,14 +7,18 @@ ParsedCommand::ParsedCommand()
 : name{},
   values{},
   options{},
-  flags{}
+  flags{},
+  paths{},
+  globs{}
 {}
 
 ParsedCommand::ParsedCommand(const CommandName &name, const CommandValues &values, const OptionsMap &options, const FlagsMap &flags)
 : name{name},
   values{values},
   options{options},
-  flags{flags}
+  flags{flags},
+  paths{},
+  globs{}
 {}
 
 bool ParsedCommand::IsOptionUsed(const OptionName &option_name) const
@@ -23,9 +27,79 @@ bool ParsedCommand::IsOptionUsed(const OptionName &option_name) const
 
 }
 
+void ParsedCommand::ForEachPath(const std::string_view value, const GlobMatchCallback &callback) const
+{
+    const auto glob = globs.find(std::string(value));
+
+    if (glob == globs.end()) {
+        callback(std::string(value));
+        return;
+    }
+
+    GlobExpander::Expand(glob->first, glob->second, callback);
+}
+
+bool operator==(const ParsedCommand &lhs, const ParsedCommand &rhs)
+{
+  return lhs.name == rhs.name && lhs.values == rhs.values && utils::AreMapsEqual<OptionsMap>(lhs.options, rhs.options) && utils::AreMapsEqual<FlagsMap>(lhs.flags, rhs.flags);
+}
+
+namespace pmr {
+
+ParsedCommand::ParsedCommand(const allocator_type &allocator)
+: name(allocator),
+  values(allocator),
+  options(allocator),
+  flags(allocator),
+  paths(allocator),
+  globs(allocator)
+{}
+
+ParsedCommand::ParsedCommand(const ParsedCommand &other, const allocator_type &allocator)
+: name(other.name, allocator),
+  values(other.values, allocator),
+  options(other.options, allocator),
+  flags(other.flags, allocator),
+  paths(other.paths, allocator),
+  globs(other.globs, allocator)
+{}
+
+ParsedCommand::ParsedCommand(ParsedCommand &&other, const allocator_type &allocator)
+: name(std::move(other.name), allocator),
+  values(std::move(other.values), allocator),
+  options(std::move(other.options), allocator),
+  flags(std::move(other.flags), allocator),
+  paths(std::move(other.paths), allocator),
+  globs(std::move(other.globs), allocator)
+{}
+
+ParsedCommand::allocator_type ParsedCommand::get_allocator() const
+{
+    return name.get_allocator();
+}
+
+bool ParsedCommand::IsOptionUsed(const std::string_view option_name) const
+{
+    return options.find(option_name) != options.end();
+}
+
+void ParsedCommand::ForEachPath(const std::string_view value, const GlobMatchCallback &callback) const
+{
+    const auto glob = globs.find(value);
+
+    if (glob == globs.end()) {
+        callback(std::string(value));
+        return;
+    }
+
+    GlobExpander::Expand(std::string(glob->first), glob->second, callback);
+}
+
 bool operator==(const ParsedCommand &lhs, const ParsedCommand &rhs)
 {
   return lhs.name == rhs.name && lhs.values == rhs.values && utils::AreMapsEqual<OptionsMap>(lhs.options, rhs.options) && utils::AreMapsEqual<FlagsMap>(lhs.flags, rhs.flags);
 }
 
+} // pmr
+
 } // comlint
\ No newline at end of file
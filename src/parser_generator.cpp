@@ -0,0 +1,347 @@
+#include <algorithm>
+#include <cctype>
+#include <map>
+#include <set>
+#include <sstream>
+
+#include "comlint/parser_generator.hpp"
+
+namespace comlint {
+
+namespace {
+
+template <typename MapType>
+std::vector<std::string_view> GetNames(const MapType &map)
+{
+    std::vector<std::string_view> names {};
+
+    for (const auto &[name, properties] : map) {
+        names.emplace_back(name);
+    }
+
+    return names;
+}
+
+template <typename ListType>
+std::string GetList(const ListType &list)
+{
+    std::stringstream joined_list {};
+
+    for (std::size_t i = 0U; i < list.size(); i++) {
+        joined_list << (i == 0U ? "" : ", ") << list[i];
+    }
+
+    return joined_list.str();
+}
+
+/**
+ * @brief Strings referenced by the generated ranges, stored one after another in the same order as CompiledInterface stores them.
+ */
+class StringTable
+{
+public:
+    std::string AddStrings(const std::pmr::vector<std::pmr::string> &strings)
+    {
+        const std::size_t begin = strings_.size();
+
+        for (const auto &string : strings) {
+            strings_.push_back(ParserGenerator::GetStringLiteral(string));
+        }
+
+        return "GeneratedRange{" + std::to_string(begin) + "U, " + std::to_string(strings_.size()) + "U}";
+    }
+
+    const std::vector<std::string>& GetStrings() const
+    {
+        return strings_;
+    }
+
+private:
+    std::vector<std::string> strings_ {};
+};
+
+} // namespace
+
+std::string ParserGenerator::GetParserHeader(const InterfaceSchema &schema, const std::string_view name, const std::string_view schema_file_name)
+{
+    const std::string identifier = GetIdentifier(name);
+    const std::vector<std::string_view> command_names = GetNames(schema.commands);
+    const std::vector<std::string_view> option_names = GetNames(schema.options);
+    const std::vector<std::string_view> flag_names = GetNames(schema.flags);
+    std::vector<std::string> quoted_command_names {};
+    std::vector<std::string> quoted_option_names {};
+    std::vector<std::string> quoted_flag_names {};
+    std::vector<std::string> num_of_required_values {};
+    std::vector<std::string> command_allowed_values {};
+    std::vector<std::string> required_options {};
+    std::vector<std::string> allowed_options {};
+    std::vector<std::string> allowed_flags {};
+    std::vector<std::string> option_allowed_values {};
+    std::vector<std::string> default_values {};
+    std::vector<std::string> environment_variables {};
+    StringTable string_table {};
+
+    std::transform(command_names.begin(), command_names.end(), std::back_inserter(quoted_command_names), GetStringLiteral);
+    std::transform(option_names.begin(), option_names.end(), std::back_inserter(quoted_option_names), GetStringLiteral);
+    std::transform(flag_names.begin(), flag_names.end(), std::back_inserter(quoted_flag_names), GetStringLiteral);
+
+    // strings of the options are added before the ones of the commands, in the same way as CompiledInterface adds them
+    for (const auto &[option_name, option_properties] : schema.options) {
+        option_allowed_values.push_back(string_table.AddStrings(option_properties.allowed_values));
+        default_values.push_back(GetStringLiteral(option_properties.default_value));
+        environment_variables.push_back(option_properties.environment_variable.empty() ? "nullptr"
+                                                                                        : GetStringLiteral(option_properties.environment_variable));
+    }
+    for (const auto &[command_name, command_properties] : schema.commands) {
+        std::vector<std::string> command_allowed_options(option_names.size(), "false");
+        std::vector<std::string> command_allowed_flags(flag_names.size(), "false");
+
+        // undeclared options and flags can never be used, so they are left out of the tables
+        for (const auto &option_name : command_properties.allowed_options) {
+            const auto option = std::find(option_names.begin(), option_names.end(), option_name);
+
+            if (option != option_names.end()) {
+                command_allowed_options[static_cast<std::size_t>(option - option_names.begin())] = "true";
+            }
+        }
+        for (const auto &flag_name : command_properties.allowed_flags) {
+            const auto flag = std::find(flag_names.begin(), flag_names.end(), flag_name);
+
+            if (flag != flag_names.end()) {
+                command_allowed_flags[static_cast<std::size_t>(flag - flag_names.begin())] = "true";
+            }
+        }
+
+        num_of_required_values.push_back(std::to_string(command_properties.num_of_required_values) + "U");
+        command_allowed_values.push_back(string_table.AddStrings(command_properties.allowed_values));
+        required_options.push_back(string_table.AddStrings(command_properties.required_options));
+        allowed_options.push_back("std::array<bool, kNumOfOptions>{" + GetList(command_allowed_options) + "}");
+        allowed_flags.push_back("std::array<bool, kNumOfFlags>{" + GetList(command_allowed_flags) + "}");
+    }
+
+    const std::vector<std::string> command_enumerators = GetEnumerators(command_names);
+    std::stringstream header {};
+
+    header << "// Generated by comlint_help_generator from " << schema_file_name << ". Do not edit." << std::endl;
+    header << std::endl;
+    header << "#pragma once" << std::endl;
+    header << std::endl;
+    header << "#include <array>" << std::endl;
+    header << "#include <cstdint>" << std::endl;
+    header << "#include <string_view>" << std::endl;
+    header << std::endl;
+    header << "#include \"comlint/generated_parser.hpp\"" << std::endl;
+    header << "#include \"" << name << "_help.hpp\"" << std::endl;
+    header << std::endl;
+    header << "namespace comlint {" << std::endl;
+    header << "namespace generated {" << std::endl;
+    header << "namespace " << identifier << " {" << std::endl;
+    header << std::endl;
+    header << "struct Interface" << std::endl;
+    header << "{" << std::endl;
+    header << "    static constexpr std::uint32_t kNoIndex {UINT32_MAX};" << std::endl;
+    header << "    static constexpr std::size_t kNumOfCommands {" << command_names.size() << "U};" << std::endl;
+    header << "    static constexpr std::size_t kNumOfOptions {" << option_names.size() << "U};" << std::endl;
+    header << "    static constexpr std::size_t kNumOfFlags {" << flag_names.size() << "U};" << std::endl;
+    header << std::endl;
+    header << "    enum class Command : std::uint32_t" << std::endl;
+    header << "    {" << std::endl;
+
+    for (const auto &command_enumerator : command_enumerators) {
+        header << "        " << command_enumerator << "," << std::endl;
+    }
+
+    header << "        kNone = kNoIndex" << std::endl;
+    header << "    };" << std::endl;
+    header << std::endl;
+    header << "    static constexpr std::array<std::string_view, kNumOfCommands> kCommandNames {" << GetList(quoted_command_names) << "};" << std::endl;
+    header << "    static constexpr std::array<std::string_view, kNumOfOptions> kOptionNames {" << GetList(quoted_option_names) << "};" << std::endl;
+    header << "    static constexpr std::array<std::string_view, kNumOfFlags> kFlagNames {" << GetList(quoted_flag_names) << "};" << std::endl;
+    header << "    static constexpr std::array<std::string_view, " << string_table.GetStrings().size() << "U> kStrings {"
+           << GetList(string_table.GetStrings()) << "};" << std::endl;
+    header << "    static constexpr std::array<unsigned int, kNumOfCommands> kNumOfRequiredValues {" << GetList(num_of_required_values) << "};"
+           << std::endl;
+    header << "    static constexpr std::array<GeneratedRange, kNumOfCommands> kCommandAllowedValues {" << GetList(command_allowed_values) << "};"
+           << std::endl;
+    header << "    static constexpr std::array<GeneratedRange, kNumOfCommands> kRequiredOptions {" << GetList(required_options) << "};" << std::endl;
+    header << "    static constexpr std::array<std::array<bool, kNumOfOptions>, kNumOfCommands> kAllowedOptions {" << GetList(allowed_options) << "};"
+           << std::endl;
+    header << "    static constexpr std::array<std::array<bool, kNumOfFlags>, kNumOfCommands> kAllowedFlags {" << GetList(allowed_flags) << "};"
+           << std::endl;
+    header << "    static constexpr std::array<GeneratedRange, kNumOfOptions> kOptionAllowedValues {" << GetList(option_allowed_values) << "};"
+           << std::endl;
+    header << "    static constexpr std::array<std::string_view, kNumOfOptions> kDefaultValues {" << GetList(default_values) << "};" << std::endl;
+    header << "    static constexpr std::array<const char*, kNumOfOptions> kEnvironmentVariables {" << GetList(environment_variables) << "};"
+           << std::endl;
+    header << "    static constexpr std::string_view kHelp {" << identifier << "::kHelp};" << std::endl;
+    header << std::endl;
+    header << "    static std::uint32_t FindCommand(const std::string_view name)" << std::endl;
+    header << "    {" << std::endl;
+    header << GetLookup(command_names);
+    header << "    }" << std::endl;
+    header << "    static std::uint32_t FindOption(const std::string_view name)" << std::endl;
+    header << "    {" << std::endl;
+    header << GetLookup(option_names);
+    header << "    }" << std::endl;
+    header << "    static std::uint32_t FindFlag(const std::string_view name)" << std::endl;
+    header << "    {" << std::endl;
+    header << GetLookup(flag_names);
+    header << "    }" << std::endl;
+    header << "};" << std::endl;
+    header << std::endl;
+    header << "using Command = Interface::Command;" << std::endl;
+    header << "using Parser = GeneratedParser<Interface>;" << std::endl;
+    header << std::endl;
+    header << "} // " << identifier << std::endl;
+    header << "} // generated" << std::endl;
+    header << "} // comlint" << std::endl;
+
+    return header.str();
+}
+
+std::string ParserGenerator::GetIdentifier(const std::string_view name)
+{
+    std::string identifier {};
+
+    for (const unsigned char character : name) {
+        identifier.push_back(std::isalnum(character) ? static_cast<char>(character) : '_');
+    }
+    if (identifier.empty() || std::isdigit(static_cast<unsigned char>(identifier.front()))) {
+        identifier.insert(identifier.begin(), '_');
+    }
+
+    return identifier;
+}
+
+std::string ParserGenerator::GetStringLiteral(const std::string_view text)
+{
+    std::stringstream literal {};
+
+    literal << "\"";
+
+    for (const unsigned char character : text) {
+        if (character == '"' || character == '\\') {
+            literal << '\\' << character;
+        }
+        else if (character == '\n') {
+            // every line is a separate literal, so the generated header stays readable
+            literal << "\\n\"\n    \"";
+        }
+        else if (std::isprint(character)) {
+            literal << character;
+        }
+        else {
+            literal << "\\" << std::oct << static_cast<unsigned int>(character) << std::dec << "\"\"";
+        }
+    }
+
+    literal << "\"";
+
+    return literal.str();
+}
+
+std::vector<std::string> ParserGenerator::GetEnumerators(const std::vector<std::string_view> &names)
+{
+    std::vector<std::string> enumerators {};
+    std::set<std::string> used_enumerators {"kNone"};
+
+    for (std::size_t i = 0U; i < names.size(); i++) {
+        std::string enumerator {"k"};
+        bool is_word_begin = true;
+
+        for (const unsigned char character : names[i]) {
+            if (!std::isalnum(character)) {
+                is_word_begin = true;
+                continue;
+            }
+
+            enumerator.push_back(is_word_begin ? static_cast<char>(std::toupper(character)) : static_cast<char>(character));
+            is_word_begin = false;
+        }
+        if (!used_enumerators.insert(enumerator).second) {
+            enumerator.append(std::to_string(i));
+            used_enumerators.insert(enumerator);
+        }
+
+        enumerators.push_back(enumerator);
+    }
+
+    return enumerators;
+}
+
+std::string ParserGenerator::GetLookup(const std::vector<std::string_view> &names)
+{
+    std::map<std::size_t, std::vector<std::size_t>> names_by_size {};
+    std::stringstream lookup {};
+
+    for (std::size_t i = 0U; i < names.size(); i++) {
+        names_by_size[names[i].size()].push_back(i);
+    }
+
+    if (names_by_size.empty()) {
+        lookup << "        static_cast<void>(name);" << std::endl;
+        lookup << "        return kNoIndex;" << std::endl;
+        return lookup.str();
+    }
+
+    lookup << "        switch (name.size()) {" << std::endl;
+
+    for (const auto &[size, indexes] : names_by_size) {
+        std::size_t position = 0U;
+        std::size_t max_num_of_characters = 0U;
+
+        // position splitting the names of this size into the most groups
+        for (std::size_t i = 0U; i < size; i++) {
+            std::set<char> characters {};
+
+            for (const std::size_t index : indexes) {
+                characters.insert(names[index][i]);
+            }
+            if (characters.size() > max_num_of_characters) {
+                max_num_of_characters = characters.size();
+                position = i;
+            }
+        }
+
+        std::map<char, std::vector<std::size_t>> names_by_character {};
+
+        for (const std::size_t index : indexes) {
+            names_by_character[names[index][position]].push_back(index);
+        }
+
+        lookup << "        case " << size << "U:" << std::endl;
+        lookup << "            switch (name[" << position << "U]) {" << std::endl;
+
+        for (const auto &[character, character_indexes] : names_by_character) {
+            lookup << "            case " << GetCharacterLiteral(character) << ":" << std::endl;
+
+            for (const std::size_t index : character_indexes) {
+                lookup << "                if (name == " << GetStringLiteral(names[index]) << ") { return " << index << "U; }" << std::endl;
+            }
+
+            lookup << "                break;" << std::endl;
+        }
+
+        lookup << "            }" << std::endl;
+        lookup << "            break;" << std::endl;
+    }
+
+    lookup << "        }" << std::endl;
+    lookup << "        return kNoIndex;" << std::endl;
+
+    return lookup.str();
+}
+
+std::string ParserGenerator::GetCharacterLiteral(const char character)
+{
+    if (character == '\'' || character == '\\') {
+        return std::string("'\\") + character + "'";
+    }
+    if (std::isprint(static_cast<unsigned char>(character))) {
+        return std::string("'") + character + "'";
+    }
+
+    return "static_cast<char>(" + std::to_string(static_cast<int>(character)) + ")";
+}
+
+} // comlint
\ No newline at end of file
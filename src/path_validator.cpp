@@ -0,0 +1,132 @@
+#include <algorithm>
+
+#ifdef _WIN32
+#include <filesystem>
+#include <io.h>
+#else
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "comlint/path_validator.hpp"
+#include "comlint/thread_pool.hpp"
+#include "comlint/exceptions/invalid_path.hpp"
+
+namespace comlint {
+
+CheckedPaths PathValidator::Validate(const PathChecks &path_checks, std::pmr::memory_resource *memory_resource)
+{
+    CheckedPaths checked_paths(memory_resource);
+
+    checked_paths.reserve(path_checks.size());
+
+    for (const auto &path_check : path_checks) {
+        checked_paths.emplace_back(path_check.path, PathMetadata{});
+    }
+
+    const auto is_path_less = [](const auto &lhs, const auto &rhs) { return lhs.first < rhs.first; };
+    const auto is_path_equal = [](const auto &lhs, const auto &rhs) { return lhs.first == rhs.first; };
+
+    std::sort(checked_paths.begin(), checked_paths.end(), is_path_less);
+    checked_paths.erase(std::unique(checked_paths.begin(), checked_paths.end(), is_path_equal), checked_paths.end());
+
+    const auto find_checked_path = [&checked_paths, &is_path_less](const std::string_view path) {
+        return std::lower_bound(checked_paths.begin(), checked_paths.end(), std::make_pair(path, PathMetadata{}), is_path_less);
+    };
+    std::pmr::vector<bool> check_readability(checked_paths.size(), false, memory_resource);
+
+    for (const auto &path_check : path_checks) {
+        if (HasRequirement(path_check.requirement, PathRequirement::kReadable)) {
+            check_readability[static_cast<std::size_t>(find_checked_path(path_check.path) - checked_paths.begin())] = true;
+        }
+    }
+
+    ThreadPool::GetShared().ParallelFor(checked_paths.size(), [&checked_paths, &check_readability](const std::size_t i) {
+        checked_paths[i].second = GetMetadata(std::string(checked_paths[i].first), check_readability[i]);
+    });
+
+    std::string violations {};
+
+    for (const auto &path_check : path_checks) {
+        violations.append(GetViolation(path_check, find_checked_path(path_check.path)->second));
+    }
+
+    if (!violations.empty()) {
+        violations.pop_back();
+        throw InvalidPath("Invalid paths given!\n" + violations);
+    }
+
+    return checked_paths;
+}
+
+PathMetadata PathValidator::GetMetadata(const std::string &path, const bool check_readability)
+{
+    PathMetadata path_metadata {};
+
+#ifdef _WIN32
+    std::error_code error {};
+    const std::filesystem::file_status status = std::filesystem::status(path, error);
+
+    if (error || !std::filesystem::exists(status)) {
+        return path_metadata;
+    }
+
+    path_metadata.type = std::filesystem::is_regular_file(status) ? PathType::kFile
+                         : std::filesystem::is_directory(status) ? PathType::kDirectory : PathType::kOther;
+    path_metadata.size = path_metadata.type == PathType::kFile ? std::filesystem::file_size(path, error) : 0U;
+    path_metadata.modification_time = std::chrono::duration_cast<std::chrono::seconds>(
+        std::filesystem::last_write_time(path, error).time_since_epoch()).count();
+    path_metadata.is_readable = check_readability && _access(path.c_str(), 4) == 0;
+#else
+    struct stat status {};
+
+    if (stat(path.c_str(), &status) != 0) {
+        return path_metadata;
+    }
+
+    path_metadata.type = S_ISREG(status.st_mode) ? PathType::kFile : S_ISDIR(status.st_mode) ? PathType::kDirectory : PathType::kOther;
+    path_metadata.size = static_cast<std::uint64_t>(status.st_size);
+    path_metadata.modification_time = static_cast<std::int64_t>(status.st_mtime);
+    path_metadata.is_readable = check_readability && access(path.c_str(), R_OK) == 0;
+#endif
+
+    return path_metadata;
+}
+
+std::string PathValidator::GetDescription(const PathRequirement requirement)
+{
+    std::string description {"existing"};
+
+    if (HasRequirement(requirement, PathRequirement::kReadable)) {
+        description.append(" readable");
+    }
+
+    return description.append(HasRequirement(requirement, PathRequirement::kFile) ? " file"
+                              : HasRequirement(requirement, PathRequirement::kDirectory) ? " directory" : " path");
+}
+
+std::string PathValidator::GetViolation(const PathCheck &path_check, const PathMetadata &path_metadata)
+{
+    const std::string element = std::string(path_check.element_name) + (path_check.is_option_value ? " option" : " command");
+    const std::string prefix = "Path " + std::string(path_check.path) + " given for " + element;
+
+    if (path_check.requirement == PathRequirement::kNone) {
+        return "";
+    }
+    if (path_metadata.type == PathType::kNotFound) {
+        return prefix + " does not exist.\n";
+    }
+    if (HasRequirement(path_check.requirement, PathRequirement::kFile) && path_metadata.type != PathType::kFile) {
+        return prefix + " is not a file.\n";
+    }
+    if (HasRequirement(path_check.requirement, PathRequirement::kDirectory) && path_metadata.type != PathType::kDirectory) {
+        return prefix + " is not a directory.\n";
+    }
+    if (HasRequirement(path_check.requirement, PathRequirement::kReadable) && !path_metadata.is_readable) {
+        return prefix + " is not readable.\n";
+    }
+
+    return "";
+}
+
+} // comlint
\ No newline at end of file
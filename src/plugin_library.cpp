@@ -0,0 +1,71 @@
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+#include <memory>
+
+#include "comlint/plugin_library.hpp"
+#include "comlint/exceptions/invalid_command_handler.hpp"
+
+namespace comlint {
+
+namespace {
+
+#ifdef _WIN32
+
+std::shared_ptr<void> OpenLibrary(const std::string &library_path)
+{
+    HMODULE library = LoadLibraryA(library_path.c_str());
+
+    if (!library) {
+        throw InvalidCommandHandler("Unable to load plugin library " + library_path + "! Error code: " + std::to_string(GetLastError()));
+    }
+
+    return std::shared_ptr<void>(library, [](void *library) { FreeLibrary(static_cast<HMODULE>(library)); });
+}
+
+void* FindSymbol(const std::shared_ptr<void> &library, const std::string &symbol_name)
+{
+    return reinterpret_cast<void*>(GetProcAddress(static_cast<HMODULE>(library.get()), symbol_name.c_str()));
+}
+
+#else
+
+std::shared_ptr<void> OpenLibrary(const std::string &library_path)
+{
+    void *library = dlopen(library_path.c_str(), RTLD_NOW | RTLD_LOCAL);
+
+    if (!library) {
+        throw InvalidCommandHandler("Unable to load plugin library " + library_path + "! " + dlerror());
+    }
+
+    return std::shared_ptr<void>(library, [](void *library) { dlclose(library); });
+}
+
+void* FindSymbol(const std::shared_ptr<void> &library, const std::string &symbol_name)
+{
+    return dlsym(library.get(), symbol_name.c_str());
+}
+
+#endif
+
+} // namespace
+
+CommandHandlerFactory PluginLibrary::GetHandlerFactory(const std::string &library_path, const std::string &symbol_name)
+{
+    return [library_path, symbol_name]() -> CommandHandlerPtr {
+        const std::shared_ptr<void> library = OpenLibrary(library_path);
+        const auto create_handler = reinterpret_cast<PluginCommandHandlerCreator>(FindSymbol(library, symbol_name));
+
+        if (!create_handler) {
+            throw InvalidCommandHandler("Plugin library " + library_path + " does not define " + symbol_name + " function!");
+        }
+
+        // the library is released only after the handler, as the code of the handler lives in it
+        return CommandHandlerPtr(create_handler(), [library](CommandHandlerInterface *command_handler) { delete command_handler; });
+    };
+}
+
+} // comlint
\ No newline at end of file
@@ -0,0 +1,119 @@
+#include <algorithm>
+
+#include "comlint/thread_pool.hpp"
+
+namespace comlint {
+
+ThreadPool::ThreadPool(const std::size_t num_of_threads)
+: mutex_{},
+  has_batches_{},
+  batches_{},
+  is_stopping_{false},
+  threads_{}
+{
+    threads_.reserve(num_of_threads);
+
+    for (std::size_t i = 0U; i < num_of_threads; i++) {
+        threads_.emplace_back(&ThreadPool::RunWorker, this);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        is_stopping_ = true;
+    }
+
+    has_batches_.notify_all();
+
+    for (auto &thread : threads_) {
+        thread.join();
+    }
+}
+
+ThreadPool& ThreadPool::GetShared()
+{
+    static ThreadPool shared_pool(2U * std::max(1U, std::thread::hardware_concurrency()));
+
+    return shared_pool;
+}
+
+void ThreadPool::ParallelFor(const std::size_t num_of_tasks, const std::function<void(std::size_t)> &task)
+{
+    if (num_of_tasks == 0U) {
+        return;
+    }
+    if (num_of_tasks == 1U || threads_.empty()) {
+        for (std::size_t i = 0U; i < num_of_tasks; i++) {
+            task(i);
+        }
+        return;
+    }
+
+    Batch batch {&task, num_of_tasks, 0U, 0U, nullptr, {}};
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    batches_.push_back(&batch);
+    has_batches_.notify_all();
+    RunTasks(batch, lock);
+    batch.finished.wait(lock, [&batch]() { return batch.num_of_finished_tasks == batch.num_of_tasks; });
+
+    if (batch.exception) {
+        std::rethrow_exception(batch.exception);
+    }
+}
+
+std::size_t ThreadPool::GetNumOfThreads() const
+{
+    return threads_.size();
+}
+
+void ThreadPool::RunWorker()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    while (true) {
+        has_batches_.wait(lock, [this]() { return is_stopping_ || !batches_.empty(); });
+
+        if (is_stopping_) {
+            return;
+        }
+
+        RunTasks(*batches_.front(), lock);
+    }
+}
+
+void ThreadPool::RunTasks(Batch &batch, std::unique_lock<std::mutex> &lock)
+{
+    while (batch.next_task < batch.num_of_tasks) {
+        const std::size_t task = batch.next_task++;
+
+        // the last task is taken, so nobody else needs to find this batch in the queue
+        if (batch.next_task == batch.num_of_tasks) {
+            batches_.erase(std::find(batches_.begin(), batches_.end(), &batch));
+        }
+
+        lock.unlock();
+
+        std::exception_ptr exception {};
+
+        try {
+            (*batch.task)(task);
+        }
+        catch (...) {
+            exception = std::current_exception();
+        }
+
+        lock.lock();
+
+        if (exception && !batch.exception) {
+            batch.exception = exception;
+        }
+        if (++batch.num_of_finished_tasks == batch.num_of_tasks) {
+            batch.finished.notify_all();
+        }
+    }
+}
+
+} // comlint
\ No newline at end of file
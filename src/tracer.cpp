@@ -0,0 +1,211 @@
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <mutex>
+#include <vector>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "comlint/tracer.hpp"
+
+namespace comlint {
+
+namespace {
+
+struct TraceEvent
+{
+    std::string name;
+    std::string category;
+    std::int64_t begin;
+    std::int64_t end;
+    std::uint32_t thread_id;
+};
+
+/**
+ * @brief Events recorded so far, written to the trace file when recording is stopped or when the process exits.
+ */
+struct TraceRecorder
+{
+    ~TraceRecorder();
+
+    std::mutex mutex {};
+    std::string trace_path {};
+    std::vector<TraceEvent> events {};
+    std::chrono::steady_clock::time_point start_time {std::chrono::steady_clock::now()};
+};
+
+std::atomic<bool> is_tracing_enabled {false};
+
+TraceRecorder& GetRecorder()
+{
+    static TraceRecorder recorder {};
+
+    return recorder;
+}
+
+// small sequential numbers are easier to tell apart in the timeline than hashes of std::thread::id
+std::uint32_t GetThreadId()
+{
+    static std::atomic<std::uint32_t> next_thread_id {1U};
+    thread_local const std::uint32_t thread_id = next_thread_id++;
+
+    return thread_id;
+}
+
+int GetProcessId()
+{
+#ifdef _WIN32
+    return _getpid();
+#else
+    return static_cast<int>(getpid());
+#endif
+}
+
+std::string EscapeJson(const std::string_view text)
+{
+    std::string escaped {};
+
+    for (const char character : text) {
+        if (character == '"' || character == '\\') {
+            escaped.push_back('\\');
+            escaped.push_back(character);
+        } else if (static_cast<unsigned char>(character) < 0x20U) {
+            char code[8U] {};
+
+            std::snprintf(code, sizeof(code), "\\u%04x", static_cast<unsigned int>(character));
+            escaped.append(code);
+        } else {
+            escaped.push_back(character);
+        }
+    }
+
+    return escaped;
+}
+
+// trace timestamps are given in microseconds, events are recorded in nanoseconds
+std::string ToMicroseconds(const std::int64_t nanoseconds)
+{
+    char microseconds[32U] {};
+
+    std::snprintf(microseconds, sizeof(microseconds), "%.3f", static_cast<double>(nanoseconds) / 1000.0);
+
+    return microseconds;
+}
+
+// must be called with the lock of the recorder held
+void WriteTrace(TraceRecorder &recorder)
+{
+    std::ofstream trace_file(recorder.trace_path);
+    const int process_id = GetProcessId();
+
+    trace_file << "{\"traceEvents\":[";
+
+    for (std::size_t i = 0U; i < recorder.events.size(); i++) {
+        const TraceEvent &event = recorder.events[i];
+
+        trace_file << (i == 0U ? "\n" : ",\n") << "{\"name\":\"" << EscapeJson(event.name) << "\",\"cat\":\"" << EscapeJson(event.category)
+                   << "\",\"ph\":\"X\",\"ts\":" << ToMicroseconds(event.begin) << ",\"dur\":" << ToMicroseconds(event.end - event.begin)
+                   << ",\"pid\":" << process_id << ",\"tid\":" << event.thread_id << "}";
+    }
+
+    trace_file << "\n],\"displayTimeUnit\":\"ms\"}\n";
+    recorder.events.clear();
+}
+
+TraceRecorder::~TraceRecorder()
+{
+    const std::lock_guard<std::mutex> lock(mutex);
+
+    if (is_tracing_enabled.exchange(false)) {
+        WriteTrace(*this);
+    }
+}
+
+} // namespace
+
+void Tracer::Start(const std::string &trace_path)
+{
+    TraceRecorder &recorder = GetRecorder();
+    const std::lock_guard<std::mutex> lock(recorder.mutex);
+
+    recorder.trace_path = trace_path;
+    is_tracing_enabled = true;
+}
+
+void Tracer::Stop()
+{
+    TraceRecorder &recorder = GetRecorder();
+    const std::lock_guard<std::mutex> lock(recorder.mutex);
+
+    if (is_tracing_enabled.exchange(false)) {
+        WriteTrace(recorder);
+    }
+}
+
+bool Tracer::IsEnabled()
+{
+    return is_tracing_enabled.load(std::memory_order_relaxed);
+}
+
+void Tracer::StartIfRequested(const int argc, char** argv)
+{
+    const char *trace_path = std::getenv(std::string(kEnvironmentVariable).c_str());
+
+    if (trace_path != nullptr && *trace_path != '\0') {
+        Start(trace_path);
+        return;
+    }
+
+    for (int i = 1; i < argc; i++) {
+        if (argv[i] == kTraceFlag) {
+            Start(std::string(kDefaultTracePath));
+            return;
+        }
+    }
+}
+
+std::int64_t Tracer::GetTime()
+{
+    const auto elapsed_time = std::chrono::steady_clock::now() - GetRecorder().start_time;
+
+    return static_cast<std::int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed_time).count());
+}
+
+void Tracer::RecordSpan(const std::string_view name, const std::string_view category, const std::int64_t begin, const std::int64_t end)
+{
+    TraceRecorder &recorder = GetRecorder();
+    const std::uint32_t thread_id = GetThreadId();
+    const std::lock_guard<std::mutex> lock(recorder.mutex);
+
+    if (is_tracing_enabled) {
+        recorder.events.push_back({std::string(name), std::string(category), begin, end, thread_id});
+    }
+}
+
+void TraceBatch::Extend(const std::string_view name, const std::int64_t begin)
+{
+    if (name != name_) {
+        Close();
+        name_ = name;
+        begin_ = begin;
+    }
+
+    end_ = Tracer::GetTime();
+}
+
+void TraceBatch::Close()
+{
+    if (begin_ != Tracer::kNoTime) {
+        Tracer::RecordSpan(name_, "interface", begin_, end_);
+    }
+
+    begin_ = Tracer::kNoTime;
+}
+
+} // comlint
\ No newline at end of file
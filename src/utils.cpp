@@ -1,30 +1,54 @@
-#include <numeric>
-
+#include "comlint/tracer.hpp"
 #include "comlint/utils.hpp"
 
 namespace comlint {
 namespace utils {
 
+template <typename VectorType>
+static std::string VectorToStringImpl(const VectorType &vector, const std::string &delimiter, const std::string &opening_string, const std::string &closing_string)
+{
+    std::size_t text_size = opening_string.size() + closing_string.size() + (vector.empty() ? 0U : (vector.size() - 1U) * delimiter.size());
+
+    for (const auto &element : vector) {
+        text_size += element.size();
+    }
+
+    // text is built in place, as accumulating copies of it made joining quadratic in the number of elements
+    std::string text {};
+
+    text.reserve(text_size);
+    text.append(opening_string);
+
+    // delimiter is put only after some text, so empty elements at the beginning are skipped
+    for (const auto &element : vector) {
+        text.append(text.size() > opening_string.size() ? delimiter : "").append(element);
+    }
+
+    return text.append(closing_string);
+}
+
 std::string VectorToString(const std::vector<std::string> &vector, const std::string &delimiter, const std::string &opening_string, const std::string &closing_string)
 {
-    const std::string text = std::accumulate(vector.begin(), vector.end(), std::string(), [delimiter](const std::string &a, const std::string &b){
-        return a + (a.size() > 0U ? delimiter : "") + b;
-    });
+    return VectorToStringImpl(vector, delimiter, opening_string, closing_string);
+}
 
-    return opening_string + text + closing_string;
+std::string VectorToString(const std::pmr::vector<std::pmr::string> &vector, const std::string &delimiter, const std::string &opening_string, const std::string &closing_string)
+{
+    return VectorToStringImpl(vector, delimiter, opening_string, closing_string);
 }
 
-std::string GetSimilarValues(const std::vector<std::string> &vector, const std::string &value, const std::string &delimiter)
+std::string GetSimilarValues(const std::vector<std::string> &vector, const std::string_view value, const std::string &delimiter)
 {
-    std::string similar_values {};
+    const TraceSpan trace_span("GetSimilarValues", "hint");
 
-    for (const auto &element : vector) {
-        if (element.find(value) != std::string::npos || value.find(element) != std::string::npos) {
-            similar_values += element + delimiter;
-        }
-    }
+    return GetSimilarValues(vector.begin(), vector.end(), value, delimiter);
+}
+
+std::string GetSimilarValues(const std::pmr::vector<std::pmr::string> &vector, const std::string_view value, const std::string &delimiter)
+{
+    const TraceSpan trace_span("GetSimilarValues", "hint");
 
-    return similar_values.empty() ? similar_values : similar_values.substr(0U, similar_values.size() - delimiter.size());
+    return GetSimilarValues(vector.begin(), vector.end(), value, delimiter);
 }
 
 } // utils
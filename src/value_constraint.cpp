@@ -0,0 +1,556 @@
+#include <algorithm>
+#include <bitset>
+#include <charconv>
+#include <map>
+#include <unordered_set>
+
+#include "comlint/value_constraint.hpp"
+#include "comlint/exceptions/invalid_value_constraint.hpp"
+
+namespace comlint {
+
+namespace {
+
+using ByteSet = std::bitset<256U>;
+
+constexpr unsigned int kUnboundedRepetitions {UINT32_MAX};
+constexpr unsigned int kMaxNumOfRepetitions {256U};
+constexpr std::size_t kMaxNumOfNfaStates {65536U};
+constexpr std::size_t kMaxNumOfDfaStates {4096U};
+constexpr std::uint32_t kNoState {UINT32_MAX};
+
+struct PatternNode
+{
+    enum class Kind : std::uint8_t
+    {
+        kBytes,
+        kConcatenation,
+        kAlternation,
+        kRepetition
+    };
+
+    Kind kind;
+    ByteSet bytes {};
+    std::vector<PatternNode> children {};
+    unsigned int min_repetitions {0U};
+    unsigned int max_repetitions {0U};
+};
+
+/**
+ * @brief Recursive descent parser of the pattern syntax described in ValueConstraint.
+ */
+class PatternParser
+{
+public:
+    explicit PatternParser(const std::string_view pattern)
+    : pattern_{pattern},
+      position_{0U}
+    {}
+
+    PatternNode Parse()
+    {
+        PatternNode node = ParseAlternation();
+
+        if (position_ < pattern_.size()) {
+            Throw("unexpected \")\"");
+        }
+
+        return node;
+    }
+
+private:
+    PatternNode ParseAlternation()
+    {
+        PatternNode alternation {PatternNode::Kind::kAlternation};
+
+        alternation.children.push_back(ParseConcatenation());
+
+        while (position_ < pattern_.size() && pattern_[position_] == '|') {
+            position_++;
+            alternation.children.push_back(ParseConcatenation());
+        }
+
+        return alternation.children.size() == 1U ? std::move(alternation.children.front()) : std::move(alternation);
+    }
+
+    PatternNode ParseConcatenation()
+    {
+        PatternNode concatenation {PatternNode::Kind::kConcatenation};
+
+        while (position_ < pattern_.size() && pattern_[position_] != '|' && pattern_[position_] != ')') {
+            concatenation.children.push_back(ParseRepetition());
+        }
+
+        return concatenation;
+    }
+
+    PatternNode ParseRepetition()
+    {
+        PatternNode node = ParseAtom();
+
+        while (position_ < pattern_.size()) {
+            PatternNode repetition {PatternNode::Kind::kRepetition};
+
+            switch (pattern_[position_]) {
+                case '*':
+                    repetition.max_repetitions = kUnboundedRepetitions;
+                    position_++;
+                    break;
+                case '+':
+                    repetition.min_repetitions = 1U;
+                    repetition.max_repetitions = kUnboundedRepetitions;
+                    position_++;
+                    break;
+                case '?':
+                    repetition.max_repetitions = 1U;
+                    position_++;
+                    break;
+                case '{':
+                    ParseBounds(repetition);
+                    break;
+                default:
+                    return node;
+            }
+
+            repetition.children.push_back(std::move(node));
+            node = std::move(repetition);
+        }
+
+        return node;
+    }
+
+    PatternNode ParseAtom()
+    {
+        const char character = pattern_[position_++];
+        PatternNode node {PatternNode::Kind::kBytes};
+
+        switch (character) {
+            case '(':
+                node = ParseAlternation();
+
+                if (position_ >= pattern_.size() || pattern_[position_] != ')') {
+                    Throw("missing \")\"");
+                }
+
+                position_++;
+                break;
+            case '[':
+                node.bytes = ParseClass();
+                break;
+            case '.':
+                node.bytes.set();
+                break;
+            case '\\':
+                node.bytes = ParseEscape();
+                break;
+            case '*':
+            case '+':
+            case '?':
+            case '{':
+                Throw("nothing to repeat before \"" + std::string(1U, character) + "\"");
+                break;
+            case '^':
+            case '$':
+                Throw("anchor \"" + std::string(1U, character) + "\" is not supported, patterns always match the whole value (escape it to "
+                      "match the character)");
+                break;
+            default:
+                node.bytes.set(static_cast<unsigned char>(character));
+                break;
+        }
+
+        return node;
+    }
+
+    ByteSet ParseClass()
+    {
+        ByteSet bytes {};
+        const bool is_negated = position_ < pattern_.size() && pattern_[position_] == '^';
+        bool is_first = true;
+
+        position_ += is_negated ? 1U : 0U;
+
+        while (position_ < pattern_.size() && (pattern_[position_] != ']' || is_first)) {
+            is_first = false;
+
+            if (pattern_[position_] == '\\') {
+                position_++;
+                bytes |= ParseEscape();
+                continue;
+            }
+
+            const unsigned char first = static_cast<unsigned char>(pattern_[position_++]);
+
+            if (position_ + 1U < pattern_.size() && pattern_[position_] == '-' && pattern_[position_ + 1U] != ']') {
+                const unsigned char last = static_cast<unsigned char>(pattern_[position_ + 1U]);
+
+                if (last < first) {
+                    Throw("invalid range of characters");
+                }
+                for (unsigned int byte = first; byte <= last; byte++) {
+                    bytes.set(byte);
+                }
+
+                position_ += 2U;
+            }
+            else {
+                bytes.set(first);
+            }
+        }
+
+        if (position_ >= pattern_.size()) {
+            Throw("missing \"]\"");
+        }
+
+        position_++;
+
+        return is_negated ? ~bytes : bytes;
+    }
+
+    ByteSet ParseEscape()
+    {
+        if (position_ >= pattern_.size()) {
+            Throw("\"\\\" at the end of the pattern");
+        }
+
+        const char character = pattern_[position_++];
+        ByteSet bytes {};
+
+        switch (character) {
+            case 'd':
+            case 'D':
+                SetRange(bytes, '0', '9');
+                break;
+            case 'w':
+            case 'W':
+                SetRange(bytes, '0', '9');
+                SetRange(bytes, 'a', 'z');
+                SetRange(bytes, 'A', 'Z');
+                bytes.set('_');
+                break;
+            case 's':
+            case 'S':
+                for (const char space : {' ', '\t', '\n', '\r', '\f', '\v'}) {
+                    bytes.set(static_cast<unsigned char>(space));
+                }
+                break;
+            default:
+                bytes.set(static_cast<unsigned char>(character));
+                return bytes;
+        }
+
+        return character == 'D' || character == 'W' || character == 'S' ? ~bytes : bytes;
+    }
+
+    void ParseBounds(PatternNode &repetition)
+    {
+        const std::size_t bounds_end = pattern_.find('}', position_);
+
+        if (bounds_end == std::string_view::npos) {
+            Throw("missing \"}\"");
+        }
+
+        const std::string_view bounds = pattern_.substr(position_ + 1U, bounds_end - position_ - 1U);
+        const std::size_t comma = bounds.find(',');
+
+        repetition.min_repetitions = ParseNumber(bounds.substr(0U, comma));
+        repetition.max_repetitions = comma == std::string_view::npos ? repetition.min_repetitions
+                                     : comma + 1U == bounds.size() ? kUnboundedRepetitions : ParseNumber(bounds.substr(comma + 1U));
+
+        if (repetition.max_repetitions < repetition.min_repetitions) {
+            Throw("invalid bounds of repetition");
+        }
+
+        position_ = bounds_end + 1U;
+    }
+
+    unsigned int ParseNumber(const std::string_view text) const
+    {
+        unsigned int number = 0U;
+        const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), number);
+
+        if (text.empty() || error != std::errc() || end != text.data() + text.size() || number > kMaxNumOfRepetitions) {
+            Throw("invalid number of repetitions \"" + std::string(text) + "\" (at most " + std::to_string(kMaxNumOfRepetitions) + " allowed)");
+        }
+
+        return number;
+    }
+
+    static void SetRange(ByteSet &bytes, const char first, const char last)
+    {
+        for (char byte = first; byte <= last; byte++) {
+            bytes.set(static_cast<unsigned char>(byte));
+        }
+    }
+
+    [[noreturn]] void Throw(const std::string &reason) const
+    {
+        throw InvalidValueConstraint("Invalid pattern " + std::string(pattern_) + "! Error at position " + std::to_string(position_) + ": " +
+                                     reason + ".");
+    }
+
+    std::string_view pattern_;
+    std::size_t position_;
+};
+
+/**
+ * @brief Nondeterministic automaton built with Thompson's construction. Every state either consumes one of its bytes and moves to the
+ *        next state, or moves without consuming input to any of its epsilon transitions.
+ */
+class Nfa
+{
+public:
+    struct State
+    {
+        ByteSet bytes {};
+        std::uint32_t next {kNoState};
+        std::vector<std::uint32_t> epsilon_transitions {};
+    };
+
+    explicit Nfa(const PatternNode &root)
+    : states_{},
+      accepting_state_{AddState()},
+      initial_state_{Build(root, accepting_state_)}
+    {}
+
+    const std::vector<State>& GetStates() const { return states_; }
+    std::uint32_t GetInitialState() const { return initial_state_; }
+    std::uint32_t GetAcceptingState() const { return accepting_state_; }
+
+private:
+    std::uint32_t AddState()
+    {
+        if (states_.size() >= kMaxNumOfNfaStates) {
+            throw InvalidValueConstraint("Unable to compile pattern! It is too complex.");
+        }
+
+        states_.emplace_back();
+
+        return static_cast<std::uint32_t>(states_.size() - 1U);
+    }
+
+    // builds states matching the node, which continue to the given state, and returns the first of them
+    std::uint32_t Build(const PatternNode &node, std::uint32_t out)
+    {
+        switch (node.kind) {
+            case PatternNode::Kind::kBytes: {
+                const std::uint32_t state = AddState();
+                states_[state].bytes = node.bytes;
+                states_[state].next = out;
+                return state;
+            }
+            case PatternNode::Kind::kConcatenation:
+                for (auto child = node.children.rbegin(); child != node.children.rend(); child++) {
+                    out = Build(*child, out);
+                }
+                return out;
+            case PatternNode::Kind::kAlternation: {
+                const std::uint32_t state = AddState();
+                for (const auto &child : node.children) {
+                    const std::uint32_t child_state = Build(child, out);
+                    states_[state].epsilon_transitions.push_back(child_state);
+                }
+                return state;
+            }
+            case PatternNode::Kind::kRepetition:
+                break;
+        }
+
+        const PatternNode &child = node.children.front();
+        std::uint32_t first = out;
+
+        if (node.max_repetitions == kUnboundedRepetitions) {
+            const std::uint32_t loop = AddState();
+            const std::uint32_t child_state = Build(child, loop);
+            states_[loop].epsilon_transitions = {child_state, out};
+            first = loop;
+        }
+        else {
+            for (unsigned int i = node.min_repetitions; i < node.max_repetitions; i++) {
+                const std::uint32_t optional = AddState();
+                const std::uint32_t child_state = Build(child, first);
+                states_[optional].epsilon_transitions = {child_state, out};
+                first = optional;
+            }
+        }
+        for (unsigned int i = 0U; i < node.min_repetitions; i++) {
+            first = Build(child, first);
+        }
+
+        return first;
+    }
+
+    std::vector<State> states_;
+    std::uint32_t accepting_state_;
+    std::uint32_t initial_state_;
+};
+
+std::vector<std::uint32_t> GetEpsilonClosure(const Nfa &nfa, std::vector<std::uint32_t> states)
+{
+    std::vector<bool> is_visited(nfa.GetStates().size(), false);
+    std::vector<std::uint32_t> closure {};
+
+    while (!states.empty()) {
+        const std::uint32_t state = states.back();
+        states.pop_back();
+
+        if (is_visited[state]) {
+            continue;
+        }
+
+        is_visited[state] = true;
+        closure.push_back(state);
+        states.insert(states.end(), nfa.GetStates()[state].epsilon_transitions.begin(), nfa.GetStates()[state].epsilon_transitions.end());
+    }
+
+    std::sort(closure.begin(), closure.end());
+
+    return closure;
+}
+
+} // namespace
+
+ValueConstraint ValueConstraint::Range(const std::int64_t min, const std::int64_t max)
+{
+    if (min > max) {
+        throw InvalidValueConstraint("Invalid range [" + std::to_string(min) + ", " + std::to_string(max) + "]! Minimum is greater than maximum.");
+    }
+
+    ValueConstraint constraint(Type::kRange, "integer in range [" + std::to_string(min) + ", " + std::to_string(max) + "]");
+
+    constraint.min_ = min;
+    constraint.max_ = max;
+
+    return constraint;
+}
+
+ValueConstraint ValueConstraint::Pattern(const std::string &pattern)
+{
+    const Nfa nfa(PatternParser(pattern).Parse());
+    const auto &nfa_states = nfa.GetStates();
+    ValueConstraint constraint(Type::kPattern, "value matching " + pattern);
+
+    // bytes belonging to exactly the same sets of the automaton are never distinguished, so they share a single column of transitions
+    std::unordered_set<ByteSet> distinct_byte_sets {};
+    std::map<std::vector<bool>, std::uint8_t> byte_classes {};
+    std::vector<unsigned char> class_representatives {};
+
+    for (const auto &state : nfa_states) {
+        if (state.next != kNoState) {
+            distinct_byte_sets.insert(state.bytes);
+        }
+    }
+    for (unsigned int byte = 0U; byte < 256U; byte++) {
+        std::vector<bool> signature {};
+
+        signature.reserve(distinct_byte_sets.size());
+
+        for (const auto &byte_set : distinct_byte_sets) {
+            signature.push_back(byte_set.test(byte));
+        }
+
+        const auto [byte_class, is_new] = byte_classes.try_emplace(std::move(signature), static_cast<std::uint8_t>(byte_classes.size()));
+
+        if (is_new) {
+            class_representatives.push_back(static_cast<unsigned char>(byte));
+        }
+
+        constraint.byte_classes_[byte] = byte_class->second;
+    }
+
+    constraint.num_of_byte_classes_ = static_cast<std::uint32_t>(class_representatives.size());
+
+    // subset construction, where the empty set of states becomes the rejecting state
+    std::map<std::vector<std::uint32_t>, std::uint32_t> dfa_state_ids {{{}, kRejectingState}};
+    std::vector<std::vector<std::uint32_t>> dfa_states {{}};
+
+    dfa_state_ids.emplace(GetEpsilonClosure(nfa, {nfa.GetInitialState()}), kInitialState);
+    dfa_states.push_back(GetEpsilonClosure(nfa, {nfa.GetInitialState()}));
+
+    for (std::size_t dfa_state = 0U; dfa_state < dfa_states.size(); dfa_state++) {
+        constraint.accepting_states_.push_back(std::binary_search(dfa_states[dfa_state].begin(), dfa_states[dfa_state].end(),
+                                                                  nfa.GetAcceptingState()) ? 1U : 0U);
+
+        for (const unsigned char representative : class_representatives) {
+            std::vector<std::uint32_t> next_states {};
+
+            for (const std::uint32_t nfa_state : dfa_states[dfa_state]) {
+                if (nfa_states[nfa_state].next != kNoState && nfa_states[nfa_state].bytes.test(representative)) {
+                    next_states.push_back(nfa_states[nfa_state].next);
+                }
+            }
+
+            auto closure = GetEpsilonClosure(nfa, std::move(next_states));
+            const auto [next_dfa_state, is_new] = dfa_state_ids.try_emplace(closure, static_cast<std::uint32_t>(dfa_states.size()));
+
+            if (is_new) {
+                if (dfa_states.size() >= kMaxNumOfDfaStates) {
+                    throw InvalidValueConstraint("Unable to compile pattern " + pattern + "! Its automaton exceeds " +
+                                                 std::to_string(kMaxNumOfDfaStates) + " states.");
+                }
+
+                dfa_states.push_back(std::move(closure));
+            }
+
+            constraint.transitions_.push_back(next_dfa_state->second);
+        }
+    }
+
+    constraint.transitions_.shrink_to_fit();
+    constraint.accepting_states_.shrink_to_fit();
+
+    return constraint;
+}
+
+bool ValueConstraint::IsSatisfied(const std::string_view value) const
+{
+    return type_ == Type::kRange ? IsInRange(value) : MatchesPattern(value);
+}
+
+const std::string& ValueConstraint::GetDescription() const
+{
+    return description_;
+}
+
+std::size_t ValueConstraint::GetHeapSize() const
+{
+    const std::size_t description_size = description_.capacity() > std::string().capacity() ? description_.capacity() + 1U : 0U;
+
+    return description_size + transitions_.capacity() * sizeof(std::uint32_t) + accepting_states_.capacity() * sizeof(std::uint8_t);
+}
+
+ValueConstraint::ValueConstraint(const Type type, const std::string &description)
+: type_{type},
+  description_{description},
+  min_{0},
+  max_{0},
+  byte_classes_{},
+  num_of_byte_classes_{0U},
+  transitions_{},
+  accepting_states_{}
+{}
+
+bool ValueConstraint::IsInRange(const std::string_view value) const
+{
+    std::int64_t number = 0;
+    const auto [end, error] = std::from_chars(value.data(), value.data() + value.size(), number);
+
+    return !value.empty() && error == std::errc() && end == value.data() + value.size() && number >= min_ && number <= max_;
+}
+
+bool ValueConstraint::MatchesPattern(const std::string_view value) const
+{
+    std::uint32_t state = kInitialState;
+
+    for (const char character : value) {
+        state = transitions_[state * num_of_byte_classes_ + byte_classes_[static_cast<unsigned char>(character)]];
+
+        if (state == kRejectingState) {
+            return false;
+        }
+    }
+
+    return accepting_states_[state] != 0U;
+}
+
+} // comlint
\ No newline at end of file
@@ -0,0 +1,123 @@
+#include <algorithm>
+
+#include "comlint/value_dictionary.hpp"
+#include "comlint/exceptions/invalid_value_dictionary.hpp"
+
+namespace comlint {
+
+ValueDictionary::ValueDictionary(const std::string &path)
+: path_{path},
+  file_{path},
+  content_{file_.GetContent()},
+  size_flag_{},
+  size_{0U}
+{
+    if (!file_.IsMapped()) {
+        throw InvalidValueDictionary("Unable to open dictionary of allowed values " + path + "!");
+    }
+}
+
+const std::string& ValueDictionary::GetPath() const
+{
+    return path_;
+}
+
+std::size_t ValueDictionary::GetSize() const
+{
+    std::call_once(size_flag_, [this]() {
+        for (std::size_t line_begin = 0U; line_begin < content_.size(); line_begin = FindLineEnd(line_begin) + 1U) {
+            if (!GetLine(line_begin).empty()) {
+                size_++;
+            }
+        }
+    });
+
+    return size_;
+}
+
+bool ValueDictionary::Contains(const std::string_view value) const
+{
+    const std::size_t line_begin = LowerBound(value);
+
+    return !value.empty() && line_begin < content_.size() && GetLine(line_begin) == value;
+}
+
+std::pmr::vector<std::string_view> ValueDictionary::GetNeighbours(const std::string_view value, const std::size_t max_num_of_values,
+                                                                  std::pmr::memory_resource *memory_resource) const
+{
+    std::pmr::vector<std::string_view> neighbours(memory_resource);
+    std::size_t first_line_begin = LowerBound(value);
+
+    // half of the values is taken from before the position of the value, the rest from after it
+    for (std::size_t i = 0U; i < max_num_of_values / 2U && first_line_begin > 0U; i++) {
+        first_line_begin = FindLineBegin(first_line_begin - 1U);
+    }
+    for (std::size_t line_begin = first_line_begin; line_begin < content_.size() && neighbours.size() < max_num_of_values;
+         line_begin = FindLineEnd(line_begin) + 1U) {
+        const std::string_view line = GetLine(line_begin);
+
+        if (!line.empty()) {
+            neighbours.push_back(line);
+        }
+    }
+
+    return neighbours;
+}
+
+std::size_t ValueDictionary::FindLineBegin(const std::size_t position) const
+{
+    const std::size_t new_line = content_.rfind('\n', position == 0U ? 0U : position - 1U);
+
+    return position == 0U || new_line == std::string_view::npos ? 0U : new_line + 1U;
+}
+
+std::size_t ValueDictionary::FindLineEnd(const std::size_t position) const
+{
+    const std::size_t new_line = content_.find('\n', position);
+
+    return new_line == std::string_view::npos ? content_.size() : new_line;
+}
+
+std::string_view ValueDictionary::GetLine(const std::size_t line_begin) const
+{
+    std::string_view line = content_.substr(line_begin, FindLineEnd(line_begin) - line_begin);
+
+    if (!line.empty() && line.back() == '\r') {
+        line.remove_suffix(1U);
+    }
+
+    return line;
+}
+
+std::size_t ValueDictionary::LowerBound(const std::string_view value) const
+{
+    // binary search over byte offsets: each step compares the line containing the middle byte, so only pages on the search path are read
+    std::size_t low = 0U;
+    std::size_t high = content_.size();
+
+    while (low < high) {
+        const std::size_t effective_begin = std::max(FindLineBegin(low + (high - low) / 2U), low);
+        std::size_t line_begin = effective_begin;
+
+        // empty lines are ignored, so the first non-empty line after the middle is compared instead
+        while (line_begin < high && GetLine(line_begin).empty()) {
+            line_begin = FindLineEnd(line_begin) + 1U;
+        }
+
+        if (line_begin < high && GetLine(line_begin) < value) {
+            low = FindLineEnd(line_begin) + 1U;
+        }
+        else {
+            high = effective_begin;
+        }
+    }
+
+    // lines before the lower bound are either smaller than the value or empty, so the bound may still point at an empty line
+    while (low < content_.size() && GetLine(low).empty()) {
+        low = FindLineEnd(low) + 1U;
+    }
+
+    return std::min(low, content_.size());
+}
+
+} // comlint
\ No newline at end of file
@@ -0,0 +1,87 @@
+#include "comlint/watchdog.hpp"
+
+namespace comlint {
+
+Watchdog::Watchdog()
+: mutex_{},
+  deadlines_changed_{},
+  deadlines_{},
+  next_watch_number_{0U},
+  is_stopping_{false},
+  thread_{}
+{}
+
+Watchdog::~Watchdog()
+{
+    {
+        const std::lock_guard<std::mutex> lock(mutex_);
+
+        is_stopping_ = true;
+    }
+
+    deadlines_changed_.notify_one();
+
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+Watchdog& Watchdog::GetShared()
+{
+    static Watchdog watchdog {};
+
+    return watchdog;
+}
+
+Watchdog::WatchId Watchdog::Watch(CancellationToken &token, const Clock::time_point deadline)
+{
+    const std::lock_guard<std::mutex> lock(mutex_);
+    // number makes the id unique when deadlines of multiple tokens are equal
+    const WatchId watch_id {deadline, next_watch_number_++};
+
+    if (!thread_.joinable()) {
+        thread_ = std::thread(&Watchdog::RunThread, this);
+    }
+
+    // thread has to wake up earlier only if the new deadline is the earliest one
+    const bool is_earliest = deadlines_.empty() || watch_id < deadlines_.begin()->first;
+
+    deadlines_.emplace(watch_id, &token);
+
+    if (is_earliest) {
+        deadlines_changed_.notify_one();
+    }
+
+    return watch_id;
+}
+
+void Watchdog::Unwatch(const WatchId &watch_id)
+{
+    const std::lock_guard<std::mutex> lock(mutex_);
+
+    deadlines_.erase(watch_id);
+}
+
+void Watchdog::RunThread()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    while (!is_stopping_) {
+        if (deadlines_.empty()) {
+            deadlines_changed_.wait(lock);
+            continue;
+        }
+
+        const auto earliest_deadline = deadlines_.begin();
+
+        if (Clock::now() < earliest_deadline->first.first) {
+            deadlines_changed_.wait_until(lock, earliest_deadline->first.first);
+            continue;
+        }
+
+        earliest_deadline->second->Cancel();
+        deadlines_.erase(earliest_deadline);
+    }
+}
+
+} // comlint
\ No newline at end of file
@@ -0,0 +1,175 @@
+#include <cstdlib>
+#include <new>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+#include "allocation_counter.hpp"
+
+namespace {
+
+thread_local AllocationCounter *current_counter = nullptr;
+
+void* Allocate(const std::size_t size)
+{
+    AllocationCounter::Record(size);
+
+    // malloc(0) may return nullptr, which operator new must not
+    if (void *memory = std::malloc(size == 0U ? 1U : size)) {
+        return memory;
+    }
+
+    throw std::bad_alloc();
+}
+
+void* AllocateAligned(const std::size_t size, const std::align_val_t alignment)
+{
+    AllocationCounter::Record(size);
+
+    const auto alignment_size = static_cast<std::size_t>(alignment);
+    // aligned_alloc requires the size to be a multiple of the alignment
+    const std::size_t aligned_size = (size + alignment_size - 1U) / alignment_size * alignment_size;
+#ifdef _WIN32
+    void *memory = _aligned_malloc(aligned_size == 0U ? alignment_size : aligned_size, alignment_size);
+#else
+    void *memory = std::aligned_alloc(alignment_size, aligned_size == 0U ? alignment_size : aligned_size);
+#endif
+
+    if (memory == nullptr) {
+        throw std::bad_alloc();
+    }
+
+    return memory;
+}
+
+void DeallocateAligned(void *memory)
+{
+#ifdef _WIN32
+    _aligned_free(memory);
+#else
+    std::free(memory);
+#endif
+}
+
+} // namespace
+
+AllocationCounter::AllocationCounter()
+: outer_counter_{current_counter},
+  is_counting_{true},
+  num_of_allocations_{0U},
+  num_of_allocated_bytes_{0U}
+{
+    current_counter = this;
+}
+
+AllocationCounter::~AllocationCounter()
+{
+    // counters are scoped, so the destroyed one is always the innermost
+    current_counter = outer_counter_;
+}
+
+void AllocationCounter::Stop()
+{
+    is_counting_ = false;
+}
+
+std::size_t AllocationCounter::GetNumOfAllocations() const
+{
+    return num_of_allocations_;
+}
+
+std::size_t AllocationCounter::GetNumOfAllocatedBytes() const
+{
+    return num_of_allocated_bytes_;
+}
+
+void AllocationCounter::Record(const std::size_t size)
+{
+    for (AllocationCounter *counter = current_counter; counter != nullptr; counter = counter->outer_counter_) {
+        if (counter->is_counting_) {
+            counter->num_of_allocations_++;
+            counter->num_of_allocated_bytes_ += size;
+        }
+    }
+}
+
+void* operator new(const std::size_t size)
+{
+    return Allocate(size);
+}
+
+void* operator new[](const std::size_t size)
+{
+    return Allocate(size);
+}
+
+void* operator new(const std::size_t size, const std::nothrow_t&) noexcept
+{
+    try {
+        return Allocate(size);
+    }
+    catch (...) {
+        return nullptr;
+    }
+}
+
+void* operator new[](const std::size_t size, const std::nothrow_t&) noexcept
+{
+    try {
+        return Allocate(size);
+    }
+    catch (...) {
+        return nullptr;
+    }
+}
+
+void* operator new(const std::size_t size, const std::align_val_t alignment)
+{
+    return AllocateAligned(size, alignment);
+}
+
+void* operator new[](const std::size_t size, const std::align_val_t alignment)
+{
+    return AllocateAligned(size, alignment);
+}
+
+void operator delete(void *memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void *memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void *memory, const std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void *memory, const std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void *memory, const std::align_val_t) noexcept
+{
+    DeallocateAligned(memory);
+}
+
+void operator delete[](void *memory, const std::align_val_t) noexcept
+{
+    DeallocateAligned(memory);
+}
+
+void operator delete(void *memory, const std::size_t, const std::align_val_t) noexcept
+{
+    DeallocateAligned(memory);
+}
+
+void operator delete[](void *memory, const std::size_t, const std::align_val_t) noexcept
+{
+    DeallocateAligned(memory);
+}
\ No newline at end of file
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+
+#include <gtest/gtest.h>
+
+/**
+ * @brief Counts allocations made with global operator new by the current thread while the counter exists (or until it's stopped).
+ *        Counters may be nested, allocation is then counted by all of them. Operator new is replaced in allocation_counter.cpp, which
+ *        has to be linked into the test binary.
+ */
+class AllocationCounter
+{
+public:
+    AllocationCounter();
+    ~AllocationCounter();
+
+    AllocationCounter(const AllocationCounter&) = delete;
+    AllocationCounter& operator=(const AllocationCounter&) = delete;
+
+    /**
+     * @brief Stops counting, so the counts may be checked without counting allocations of the check itself.
+     */
+    void Stop();
+
+    std::size_t GetNumOfAllocations() const;
+    std::size_t GetNumOfAllocatedBytes() const;
+
+    /**
+     * @brief Called by the replaced operator new for every allocation.
+     */
+    static void Record(const std::size_t size);
+
+private:
+    AllocationCounter *outer_counter_;
+    bool is_counting_;
+    std::size_t num_of_allocations_;
+    std::size_t num_of_allocated_bytes_;
+};
+
+#define COMLINT_EXPECT_ALLOCATIONS_(statement, counter_getter, comparison, limit, description)                                          \
+    do {                                                                                                                                 \
+        AllocationCounter allocation_counter {};                                                                                         \
+        statement;                                                                                                                       \
+        allocation_counter.Stop();                                                                                                       \
+        comparison(allocation_counter.counter_getter(), static_cast<std::size_t>(limit)) << description << " of: " #statement;           \
+    } while (false)
+
+/**
+ * @brief Expects the statement to allocate at most the given number of times.
+ */
+#define EXPECT_MAX_ALLOCATIONS(max_num_of_allocations, statement)                                                                        \
+    COMLINT_EXPECT_ALLOCATIONS_(statement, GetNumOfAllocations, EXPECT_LE, max_num_of_allocations, "Number of allocations")
+/**
+ * @brief Expects the statement to allocate at most the given number of bytes in total.
+ */
+#define EXPECT_MAX_ALLOCATED_BYTES(max_num_of_bytes, statement)                                                                          \
+    COMLINT_EXPECT_ALLOCATIONS_(statement, GetNumOfAllocatedBytes, EXPECT_LE, max_num_of_bytes, "Number of allocated bytes")
+/**
+ * @brief Expects the statement not to allocate at all.
+ */
+#define EXPECT_NO_ALLOCATIONS(statement) EXPECT_MAX_ALLOCATIONS(0U, statement)
\ No newline at end of file
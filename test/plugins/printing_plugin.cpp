@@ -0,0 +1,24 @@
+#include "comlint/plugin_library.hpp"
+
+using namespace comlint;
+
+namespace {
+
+class PrintingCommandHandler : public CommandHandlerInterface
+{
+public:
+    void Run(const ParsedCommand &command) final
+    {
+        OutputSink output {};
+
+        Run(command, output);
+    }
+    void Run(const ParsedCommand &command, OutputSink &output) final
+    {
+        output << "Running " << command.name << " from plugin\n";
+    }
+};
+
+} // namespace
+
+COMLINT_EXPORT_COMMAND_HANDLER(create_printing_handler, PrintingCommandHandler)
\ No newline at end of file
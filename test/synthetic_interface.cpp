@@ -0,0 +1,181 @@
+#include <algorithm>
+#include <random>
+#include <set>
+#include <sstream>
+
+#include "synthetic_interface.hpp"
+
+using namespace comlint;
+
+namespace {
+
+class NameGenerator
+{
+public:
+    explicit NameGenerator(const SyntheticInterfaceSettings &settings)
+    : random_engine_{settings.seed},
+      length_distribution_{settings.min_name_length, settings.max_name_length},
+      letter_distribution_{'a', 'z'},
+      used_names_{}
+    {}
+
+    /**
+     * @brief Returns random name not returned before (with any prefix).
+     */
+    std::string GetName(const std::string &prefix)
+    {
+        std::string name {};
+
+        do {
+            name = GetRandomName();
+        } while (!used_names_.insert(name).second);
+
+        return prefix + name;
+    }
+    /**
+     * @brief Returns list of random names, which are unique only within the list (as allowed values are).
+     */
+    std::vector<std::string> GetNames(const std::size_t num_of_names)
+    {
+        std::vector<std::string> names {};
+        std::set<std::string> unique_names {};
+
+        while (names.size() < num_of_names) {
+            std::string name = GetRandomName();
+
+            if (unique_names.insert(name).second) {
+                names.push_back(std::move(name));
+            }
+        }
+
+        return names;
+    }
+
+private:
+    std::string GetRandomName()
+    {
+        std::string name(length_distribution_(random_engine_), 'a');
+
+        for (char &letter : name) {
+            letter = static_cast<char>(letter_distribution_(random_engine_));
+        }
+
+        return name;
+    }
+
+    std::mt19937 random_engine_;
+    std::uniform_int_distribution<std::size_t> length_distribution_;
+    std::uniform_int_distribution<int> letter_distribution_;
+    std::set<std::string> used_names_;
+};
+
+std::string JoinNames(const std::vector<std::string> &names)
+{
+    std::string joined_names {};
+
+    for (const std::string &name : names) {
+        joined_names.append(joined_names.empty() ? "" : ", ").append(name);
+    }
+
+    return joined_names;
+}
+
+} // namespace
+
+SyntheticInterface::SyntheticInterface(const SyntheticInterfaceSettings &settings)
+: settings_{settings},
+  commands_{},
+  options_{},
+  flags_{}
+{
+    NameGenerator name_generator(settings);
+
+    for (std::size_t i = 0U; i < settings.num_of_options; i++) {
+        options_.push_back({name_generator.GetName("-"), name_generator.GetNames(settings.num_of_allowed_values)});
+    }
+    for (std::size_t i = 0U; i < settings.num_of_flags; i++) {
+        flags_.push_back(name_generator.GetName("--"));
+    }
+    for (std::size_t i = 0U; i < settings.num_of_commands; i++) {
+        Command command {name_generator.GetName(""), name_generator.GetNames(settings.num_of_allowed_values), {}, {}};
+
+        for (std::size_t j = 0U; j < std::min(settings.num_of_allowed_options, options_.size()); j++) {
+            command.allowed_options.push_back(options_[(i + j) % options_.size()].name);
+        }
+        for (std::size_t j = 0U; j < std::min(settings.num_of_allowed_flags, flags_.size()); j++) {
+            command.allowed_flags.push_back(flags_[(i + j) % flags_.size()]);
+        }
+
+        commands_.push_back(std::move(command));
+    }
+}
+
+void SyntheticInterface::AddTo(CommandLineInterface &cli) const
+{
+    for (const Command &command : commands_) {
+        cli.AddCommand(command.name, "Synthetic command", settings_.num_of_values, command.allowed_values, command.allowed_options,
+                       command.allowed_flags);
+    }
+    for (const Option &option : options_) {
+        cli.AddOption(option.name, "Synthetic option", option.allowed_values);
+    }
+    for (const std::string &flag : flags_) {
+        cli.AddFlag(flag, "Synthetic flag");
+    }
+}
+
+std::string SyntheticInterface::GetSchema() const
+{
+    std::ostringstream schema {};
+
+    schema << "[program]\nname = synthetic\ndescription = Synthetic interface\n";
+
+    for (const Command &command : commands_) {
+        schema << "\n[command:" << command.name << "]\ndescription = Synthetic command\nnum_of_values = " << settings_.num_of_values
+               << "\nallowed_values = " << JoinNames(command.allowed_values) << "\nallowed_options = " << JoinNames(command.allowed_options)
+               << "\nallowed_flags = " << JoinNames(command.allowed_flags) << '\n';
+    }
+    for (const Option &option : options_) {
+        schema << "\n[option:" << option.name << "]\ndescription = Synthetic option\nallowed_values = " << JoinNames(option.allowed_values)
+               << '\n';
+    }
+    for (const std::string &flag : flags_) {
+        schema << "\n[flag:" << flag << "]\ndescription = Synthetic flag\n";
+    }
+
+    return schema.str();
+}
+
+std::vector<std::string> SyntheticInterface::GetInvocation(const std::size_t command_index) const
+{
+    const Command &command = commands_.at(command_index);
+    std::vector<std::string> arguments {command.name};
+
+    for (unsigned int i = 0U; i < settings_.num_of_values; i++) {
+        arguments.push_back(command.allowed_values.empty() ? "value" + std::to_string(i) : command.allowed_values[i % command.allowed_values.size()]);
+    }
+    for (const std::string &option_name : command.allowed_options) {
+        const auto option = std::find_if(options_.begin(), options_.end(), [&](const Option &element) { return element.name == option_name; });
+
+        arguments.push_back(option_name);
+        arguments.push_back(option->allowed_values.empty() ? "value" : option->allowed_values.front());
+    }
+    for (const std::string &flag_name : command.allowed_flags) {
+        arguments.push_back(flag_name);
+    }
+
+    return arguments;
+}
+
+SyntheticCommandLine::SyntheticCommandLine(const std::string &program_name, const std::vector<std::string> &arguments)
+: arguments_{},
+  argv_{}
+{
+    arguments_.reserve(arguments.size() + 1U);
+    arguments_.push_back(program_name);
+    arguments_.insert(arguments_.end(), arguments.begin(), arguments.end());
+
+    for (std::string &argument : arguments_) {
+        argv_.push_back(argument.data());
+    }
+}
\ No newline at end of file
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "comlint/command_line_interface.hpp"
+
+/**
+ * @brief Shape of the interface created by SyntheticInterface. Lengths of all the names (and allowed values) are drawn uniformly from
+ *        [min_name_length, max_name_length] (prefixes of options and flags are not counted), so the same settings and seed always give
+ *        the same interface.
+ */
+struct SyntheticInterfaceSettings
+{
+    std::size_t num_of_commands {8U};
+    std::size_t num_of_options {8U};
+    std::size_t num_of_flags {8U};
+    // number of values required by every command
+    unsigned int num_of_values {1U};
+    // number of allowed values of every command and option (0 means that any value is allowed)
+    std::size_t num_of_allowed_values {0U};
+    // number of options and flags allowed for every command, capped at the number of options and flags of the interface
+    std::size_t num_of_allowed_options {4U};
+    std::size_t num_of_allowed_flags {4U};
+    std::size_t min_name_length {4U};
+    std::size_t max_name_length {12U};
+    std::uint32_t seed {0U};
+};
+
+/**
+ * @brief Generates interface of arbitrary size for scaling tests. Command i allows options and flags i, i + 1, ... (wrapping around), so
+ *        every option and flag is used by some command when there are enough commands.
+ */
+class SyntheticInterface
+{
+public:
+    struct Command
+    {
+        std::string name;
+        std::vector<std::string> allowed_values;
+        std::vector<std::string> allowed_options;
+        std::vector<std::string> allowed_flags;
+    };
+    struct Option
+    {
+        std::string name;
+        std::vector<std::string> allowed_values;
+    };
+
+    explicit SyntheticInterface(const SyntheticInterfaceSettings &settings);
+
+    /**
+     * @brief Adds all the commands, options and flags to the interface.
+     */
+    void AddTo(comlint::CommandLineInterface &cli) const;
+    /**
+     * @brief Returns the interface in the schema format read by InterfaceSchema::Parse().
+     */
+    std::string GetSchema() const;
+    /**
+     * @brief Returns valid command line (without program name) using the command with all its allowed options and flags.
+     */
+    std::vector<std::string> GetInvocation(const std::size_t command_index) const;
+
+    const std::vector<Command>& GetCommands() const { return commands_; }
+    const std::vector<Option>& GetOptions() const { return options_; }
+    const std::vector<std::string>& GetFlags() const { return flags_; }
+
+private:
+    SyntheticInterfaceSettings settings_;
+    std::vector<Command> commands_;
+    std::vector<Option> options_;
+    std::vector<std::string> flags_;
+};
+
+/**
+ * @brief Owns strings of a command line and exposes them as argc and argv expected by the parser.
+ */
+class SyntheticCommandLine
+{
+public:
+    SyntheticCommandLine(const std::string &program_name, const std::vector<std::string> &arguments);
+
+    int GetArgc() const { return static_cast<int>(argv_.size()); }
+    char** GetArgv() { return argv_.data(); }
+
+private:
+    std::vector<std::string> arguments_;
+    std::vector<char*> argv_;
+};
\ No newline at end of file
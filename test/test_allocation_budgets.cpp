@@ -0,0 +1,195 @@
+#include <memory_resource>
+#include <sstream>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "allocation_counter.hpp"
+#include "comlint/command_line_interface.hpp"
+
+using namespace comlint;
+
+namespace {
+
+// storing the pointer prevents the compiler from eliding the allocation
+void* volatile escaped_pointer = nullptr;
+
+/**
+ * @brief Builds the git-like interface of the running example (examples/running_example_main.cpp).
+ */
+void AddExampleInterface(CommandLineInterface &cli)
+{
+    cli.AddCommand("add", "Add files to commit", 1U, ANY, NONE, {"--verbose", "--interactive"});
+    cli.AddCommand("commit", "Commit changes", {"-m", "-c"}, {"--verbose", "--amend"});
+    cli.AddCommand("merge", "Merge two branches", 2U, ANY, {"-s", "-m"}, NONE, {"-s"});
+    cli.AddCommand("submodule", "Perform operation on submodule", 1U, {"add", "update"}, NONE, {"--verbose"});
+    cli.AddOption("-b", "Specify branch name");
+    cli.AddOption("-m", "Provide message");
+    cli.AddOption("-c", "Provide commit hash");
+    cli.AddOption("-s", "Specify merging strategy", {"recursive", "resolve", "subtree"});
+    cli.AddFlag("--verbose", "Show verbose output");
+    cli.AddFlag("--interactive", "Add files to commit interactively");
+    cli.AddFlag("--amend", "Join to previous commit");
+}
+
+CompiledInterface CompileExampleInterface()
+{
+    CommandLineInterface cli(0, nullptr, "ExampleApplication", "Example usage of Comlint library basing on some git commands");
+
+    AddExampleInterface(cli);
+
+    return cli.Compile();
+}
+
+} // namespace
+
+TEST(TestAllocationCounter, CountsAllocationsAndBytes)
+{
+    AllocationCounter counter {};
+    std::vector<char> *buffer = new std::vector<char>(100U);
+
+    escaped_pointer = buffer;
+    counter.Stop();
+    delete buffer;
+
+    EXPECT_EQ(counter.GetNumOfAllocations(), 2U);
+    EXPECT_EQ(counter.GetNumOfAllocatedBytes(), sizeof(std::vector<char>) + 100U);
+}
+
+TEST(TestAllocationCounter, StoppedCounterIgnoresAllocations)
+{
+    AllocationCounter counter {};
+
+    counter.Stop();
+    escaped_pointer = new int(0);
+    delete static_cast<int*>(escaped_pointer);
+
+    EXPECT_EQ(counter.GetNumOfAllocations(), 0U);
+}
+
+TEST(TestAllocationCounter, NestedCountersCountSameAllocation)
+{
+    AllocationCounter outer_counter {};
+
+    {
+        AllocationCounter inner_counter {};
+
+        escaped_pointer = new int(0);
+        delete static_cast<int*>(escaped_pointer);
+        inner_counter.Stop();
+
+        EXPECT_EQ(inner_counter.GetNumOfAllocations(), 1U);
+    }
+
+    escaped_pointer = new int(0);
+    delete static_cast<int*>(escaped_pointer);
+    outer_counter.Stop();
+
+    EXPECT_EQ(outer_counter.GetNumOfAllocations(), 2U);
+}
+
+TEST(TestAllocationCounter, AssertionsCheckStatement)
+{
+    int number = 0;
+
+    EXPECT_NO_ALLOCATIONS(number++);
+    EXPECT_MAX_ALLOCATIONS(1U, escaped_pointer = new int(number));
+    delete static_cast<int*>(escaped_pointer);
+    EXPECT_MAX_ALLOCATED_BYTES(sizeof(int), escaped_pointer = new int(number));
+    delete static_cast<int*>(escaped_pointer);
+}
+
+TEST(TestAllocationBudgets, ParsingCommandWithValueAndFlag)
+{
+    const CompiledInterface compiled_interface = CompileExampleInterface();
+    char program_name[] = "git";
+    char add[] = "add";
+    char file[] = "file.txt";
+    char verbose[] = "--verbose";
+    char* argv[] = {program_name, add, file, verbose};
+
+    EXPECT_MAX_ALLOCATIONS(4U, compiled_interface.Parse(4, argv));
+}
+
+TEST(TestAllocationBudgets, ParsingCommandWithOptionAndFlag)
+{
+    const CompiledInterface compiled_interface = CompileExampleInterface();
+    char program_name[] = "git";
+    char commit[] = "commit";
+    char option[] = "-m";
+    char message[] = "message";
+    char amend[] = "--amend";
+    char* argv[] = {program_name, commit, option, message, amend};
+
+    EXPECT_MAX_ALLOCATIONS(4U, compiled_interface.Parse(5, argv));
+}
+
+TEST(TestAllocationBudgets, ParsingCommandWithValuesAndOptions)
+{
+    const CompiledInterface compiled_interface = CompileExampleInterface();
+    char program_name[] = "git";
+    char merge[] = "merge";
+    char branch[] = "feature";
+    char main_branch[] = "main";
+    char strategy_option[] = "-s";
+    char strategy[] = "recursive";
+    char message_option[] = "-m";
+    char message[] = "message";
+    char* argv[] = {program_name, merge, branch, main_branch, strategy_option, strategy, message_option, message};
+
+    EXPECT_MAX_ALLOCATIONS(6U, compiled_interface.Parse(8, argv));
+    EXPECT_MAX_ALLOCATED_BYTES(512U, compiled_interface.Parse(8, argv));
+}
+
+TEST(TestAllocationBudgets, ParsingCommandWithConstrainedValue)
+{
+    const CompiledInterface compiled_interface = CompileExampleInterface();
+    char program_name[] = "git";
+    char submodule[] = "submodule";
+    char update[] = "update";
+    char* argv[] = {program_name, submodule, update};
+
+    EXPECT_MAX_ALLOCATIONS(4U, compiled_interface.Parse(3, argv));
+}
+
+TEST(TestAllocationBudgets, ParsingIntoReusedMemoryResourceDoesNotAllocate)
+{
+    const CompiledInterface compiled_interface = CompileExampleInterface();
+    char program_name[] = "git";
+    char merge[] = "merge";
+    char branch[] = "feature";
+    char main_branch[] = "main";
+    char strategy_option[] = "-s";
+    char strategy[] = "recursive";
+    char* argv[] = {program_name, merge, branch, main_branch, strategy_option, strategy};
+    char buffer[4096U] {};
+    std::pmr::monotonic_buffer_resource memory_resource(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+
+    EXPECT_NO_ALLOCATIONS(compiled_interface.Parse(6, argv, &memory_resource));
+}
+
+TEST(TestAllocationBudgets, RunningCommandHandler)
+{
+    char program_name[] = "git";
+    char merge[] = "merge";
+    char branch[] = "feature";
+    char main_branch[] = "main";
+    char strategy_option[] = "-s";
+    char strategy[] = "recursive";
+    char* argv[] = {program_name, merge, branch, main_branch, strategy_option, strategy};
+    unsigned int num_of_calls = 0U;
+    std::ostringstream stream {};
+
+    CommandLineInterface cli(6, argv, "ExampleApplication", "Example usage of Comlint library basing on some git commands");
+
+    AddExampleInterface(cli);
+    cli.AddCommandHandler("merge", [&](const ParsedCommand&) { num_of_calls++; });
+
+    OutputSink output(stream);
+
+    // the first run compiles the interface, only the following ones are pinned
+    cli.Run(output);
+
+    EXPECT_MAX_ALLOCATIONS(8U, cli.Run(output));
+    EXPECT_EQ(num_of_calls, 2U);
+}
\ No newline at end of file
@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+
+#include <array>
+
+#include "comlint/bit_mask.hpp"
+
+using namespace comlint;
+
+TEST(TestBitMask, DefaultConstructedMaskIsEmpty)
+{
+    const BitMask bit_mask;
+
+    EXPECT_TRUE(bit_mask.IsEmpty());
+    EXPECT_FALSE(bit_mask.Test(0U));
+    EXPECT_FALSE(bit_mask.Test(1000U));
+}
+
+TEST(TestBitMask, SetBitsAreReported)
+{
+    BitMask bit_mask(8U);
+
+    bit_mask.Set(0U);
+    bit_mask.Set(5U);
+
+    EXPECT_FALSE(bit_mask.IsEmpty());
+    EXPECT_TRUE(bit_mask.Test(0U));
+    EXPECT_FALSE(bit_mask.Test(1U));
+    EXPECT_TRUE(bit_mask.Test(5U));
+}
+
+TEST(TestBitMask, MaskGrowsWhenBitAboveSizeIsSet)
+{
+    BitMask bit_mask(1U);
+
+    bit_mask.Set(64U);
+    bit_mask.Set(200U);
+
+    EXPECT_TRUE(bit_mask.Test(64U));
+    EXPECT_TRUE(bit_mask.Test(200U));
+    EXPECT_FALSE(bit_mask.Test(63U));
+    EXPECT_FALSE(bit_mask.Test(199U));
+}
+
+TEST(TestBitMask, ContainsChecksAllBitsOfOtherMask)
+{
+    BitMask bit_mask;
+    BitMask other_bit_mask;
+
+    EXPECT_TRUE(bit_mask.Contains(other_bit_mask));
+
+    other_bit_mask.Set(3U);
+    other_bit_mask.Set(70U);
+    EXPECT_FALSE(bit_mask.Contains(other_bit_mask));
+
+    bit_mask.Set(3U);
+    EXPECT_FALSE(bit_mask.Contains(other_bit_mask));
+
+    bit_mask.Set(70U);
+    bit_mask.Set(100U);
+    EXPECT_TRUE(bit_mask.Contains(other_bit_mask));
+    EXPECT_FALSE(other_bit_mask.Contains(bit_mask));
+}
+
+TEST(TestBitMask, MaskAllocatesFromGivenMemoryResource)
+{
+    std::array<std::byte, 64U> buffer {};
+    std::pmr::monotonic_buffer_resource memory_resource(buffer.data(), buffer.size(), std::pmr::null_memory_resource());
+    BitMask bit_mask(128U, &memory_resource);
+
+    bit_mask.Set(127U);
+
+    EXPECT_TRUE(bit_mask.Test(127U));
+}
+
+TEST(TestBitMask, CompactedMaskKeepsSetBits)
+{
+    BitMask bit_mask(1024U);
+
+    bit_mask.Set(300U);
+    bit_mask.Set(700U);
+    bit_mask.Compact();
+
+    EXPECT_TRUE(bit_mask.Test(300U));
+    EXPECT_TRUE(bit_mask.Test(700U));
+    EXPECT_FALSE(bit_mask.Test(0U));
+    EXPECT_FALSE(bit_mask.Test(1000U));
+    EXPECT_EQ(bit_mask.GetHeapSize(), 7U * sizeof(std::uint64_t));
+
+    bit_mask.Set(10U);
+
+    EXPECT_TRUE(bit_mask.Test(10U));
+    EXPECT_TRUE(bit_mask.Test(300U));
+    EXPECT_TRUE(bit_mask.Test(700U));
+}
+
+TEST(TestBitMask, ContainsWorksForCompactedMasks)
+{
+    BitMask used_bits(1024U);
+    BitMask required_bits;
+
+    required_bits.Set(500U);
+    required_bits.Set(900U);
+    required_bits.Compact();
+    used_bits.Set(500U);
+
+    EXPECT_FALSE(used_bits.Contains(required_bits));
+
+    used_bits.Set(900U);
+
+    EXPECT_TRUE(used_bits.Contains(required_bits));
+
+    used_bits.Set(0U);
+
+    EXPECT_FALSE(required_bits.Contains(used_bits));
+}
\ No newline at end of file
@@ -0,0 +1,150 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "comlint/command_fan_out.hpp"
+#include "comlint/exceptions/command_handler_failed.hpp"
+
+using namespace comlint;
+
+namespace {
+
+class RecordingCommandHandler : public CommandHandlerInterface
+{
+public:
+    void Run(const ParsedCommand &command) final
+    {
+        OutputSink output {};
+
+        Run(command, output);
+    }
+    void Run(const ParsedCommand &command, OutputSink &output) final
+    {
+        const int num_of_running = ++num_of_running_;
+
+        max_num_of_running_ = std::max(max_num_of_running_.load(), num_of_running);
+
+        // later values finish earlier, so the output would be reversed if it wasn't ordered
+        std::this_thread::sleep_for(std::chrono::milliseconds(2 * (8 - static_cast<int>(std::stoi(command.values.front())))));
+
+        for (const auto &value : command.values) {
+            output << value << ' ';
+        }
+        output << '\n';
+
+        {
+            const std::lock_guard<std::mutex> lock(mutex_);
+            chunks_.push_back(command.values);
+        }
+
+        --num_of_running_;
+    }
+
+    std::vector<CommandValues> GetChunks()
+    {
+        std::sort(chunks_.begin(), chunks_.end());
+        return chunks_;
+    }
+    int GetMaxNumOfRunning() const { return max_num_of_running_; }
+
+private:
+    std::mutex mutex_ {};
+    std::vector<CommandValues> chunks_ {};
+    std::atomic<int> num_of_running_ {0};
+    std::atomic<int> max_num_of_running_ {0};
+};
+
+class FailingCommandHandler : public CommandHandlerInterface
+{
+public:
+    void Run(const ParsedCommand &command) final
+    {
+        if (std::stoi(command.values.front()) % 2 == 0) {
+            throw std::runtime_error("even value");
+        }
+    }
+};
+
+ParsedCommand GetParsedCommand()
+{
+    return ParsedCommand("add", {"1", "2", "3", "4", "5"}, {{"-mode", "fast"}}, {{"--verbose", true}});
+}
+
+} // namespace
+
+TEST(TestCommandFanOut, EveryChunkOfValuesIsHandledOnce)
+{
+    RecordingCommandHandler command_handler {};
+    std::ostringstream stream {};
+    OutputSink output(stream);
+    const CancellationToken cancellation_token {};
+    const std::vector<CommandValues> expected_chunks {{"1", "2"}, {"3", "4"}, {"5"}};
+
+    CommandFanOut::Run(command_handler, GetParsedCommand(), {0U, 2U, true}, output, cancellation_token);
+
+    EXPECT_EQ(command_handler.GetChunks(), expected_chunks);
+}
+
+TEST(TestCommandFanOut, OrderedOutputFollowsValues)
+{
+    RecordingCommandHandler command_handler {};
+    std::ostringstream stream {};
+    const CancellationToken cancellation_token {};
+
+    {
+        OutputSink output(stream);
+
+        CommandFanOut::Run(command_handler, GetParsedCommand(), {5U, 1U, true}, output, cancellation_token);
+    }
+
+    EXPECT_EQ(stream.str(), "1 \n2 \n3 \n4 \n5 \n");
+}
+
+TEST(TestCommandFanOut, NumberOfConcurrentInvocationsIsLimited)
+{
+    RecordingCommandHandler command_handler {};
+    std::ostringstream stream {};
+    OutputSink output(stream);
+    const CancellationToken cancellation_token {};
+
+    CommandFanOut::Run(command_handler, GetParsedCommand(), {2U, 1U, false}, output, cancellation_token);
+
+    EXPECT_EQ(command_handler.GetChunks().size(), 5U);
+    EXPECT_LE(command_handler.GetMaxNumOfRunning(), 2);
+}
+
+TEST(TestCommandFanOut, AllFailuresAreReportedInOrderOfValues)
+{
+    FailingCommandHandler command_handler {};
+    std::ostringstream stream {};
+    OutputSink output(stream);
+    const CancellationToken cancellation_token {};
+
+    try {
+        CommandFanOut::Run(command_handler, GetParsedCommand(), {}, output, cancellation_token);
+        FAIL() << "Expected CommandHandlerFailed";
+    }
+    catch (const CommandHandlerFailed &exception) {
+        EXPECT_EQ(std::string(exception.what()), "CommandHandlerFailed: Command add failed in 2 of 5 invocation(s):\n2: even value\n4: even value");
+    }
+}
+
+TEST(TestCommandFanOut, ChunksAreNotStartedAfterCancellation)
+{
+    RecordingCommandHandler command_handler {};
+    std::ostringstream stream {};
+    OutputSink output(stream);
+    CancellationToken cancellation_token {};
+
+    cancellation_token.Cancel();
+    CommandFanOut::Run(command_handler, GetParsedCommand(), {}, output, cancellation_token);
+
+    EXPECT_TRUE(command_handler.GetChunks().empty());
+}
\ No newline at end of file
@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "comlint/command_handler_registry.hpp"
+
+using namespace comlint;
+
+namespace {
+
+class CountingCommandHandler : public CommandHandlerInterface
+{
+public:
+    CountingCommandHandler(std::atomic<unsigned int> &num_of_runs, std::atomic<unsigned int> &num_of_runs_after_destruction)
+    : num_of_runs_{num_of_runs},
+      num_of_runs_after_destruction_{num_of_runs_after_destruction},
+      is_destroyed_{false}
+    {}
+    ~CountingCommandHandler() override
+    {
+        is_destroyed_ = true;
+    }
+
+    void Run(const ParsedCommand&) final
+    {
+        if (is_destroyed_) {
+            num_of_runs_after_destruction_++;
+        }
+
+        num_of_runs_++;
+    }
+
+private:
+    std::atomic<unsigned int> &num_of_runs_;
+    std::atomic<unsigned int> &num_of_runs_after_destruction_;
+    std::atomic<bool> is_destroyed_;
+};
+
+} // namespace
+
+TEST(TestCommandHandlerRegistry, GetHandlerReturnsNullptrForCommandWithoutHandler)
+{
+    CommandHandlerRegistry registry {};
+
+    registry.AddCommand("command");
+
+    EXPECT_TRUE(registry.ContainsCommand("command"));
+    EXPECT_FALSE(registry.ContainsCommand("other_command"));
+    EXPECT_EQ(registry.GetHandler("command"), nullptr);
+}
+
+TEST(TestCommandHandlerRegistry, GetHandlerReturnsLastSetHandler)
+{
+    std::atomic<unsigned int> num_of_runs {0U};
+    std::atomic<unsigned int> num_of_runs_after_destruction {0U};
+    CommandHandlerRegistry registry {};
+    const CommandHandlerPtr first_handler = std::make_shared<CountingCommandHandler>(num_of_runs, num_of_runs_after_destruction);
+    const CommandHandlerPtr second_handler = std::make_shared<CountingCommandHandler>(num_of_runs, num_of_runs_after_destruction);
+
+    registry.AddCommand("command");
+    registry.SetHandler("command", first_handler);
+    EXPECT_EQ(registry.GetHandler("command"), first_handler);
+
+    registry.SetHandler("command", second_handler);
+    EXPECT_EQ(registry.GetHandler("command"), second_handler);
+}
+
+TEST(TestCommandHandlerRegistry, SlotReturnsHandlerSetAfterItWasLookedUp)
+{
+    std::atomic<unsigned int> num_of_runs {0U};
+    std::atomic<unsigned int> num_of_runs_after_destruction {0U};
+    CommandHandlerRegistry registry {};
+
+    registry.AddCommand("command");
+    registry.AddCommand("other_command");
+
+    const CommandHandlerRegistry::HandlerSlot &handler_slot = registry.GetSlot("command");
+    const CommandHandlerPtr command_handler = std::make_shared<CountingCommandHandler>(num_of_runs, num_of_runs_after_destruction);
+
+    EXPECT_EQ(registry.GetHandler(handler_slot), nullptr);
+
+    registry.SetHandler("command", command_handler);
+    EXPECT_EQ(registry.GetHandler(handler_slot), command_handler);
+    EXPECT_EQ(registry.GetHandler(registry.GetSlot("other_command")), nullptr);
+}
+
+TEST(TestCommandHandlerRegistry, PreviousHandlerIsReleasedAfterReplacement)
+{
+    std::atomic<unsigned int> num_of_runs {0U};
+    std::atomic<unsigned int> num_of_runs_after_destruction {0U};
+    CommandHandlerRegistry registry {};
+    CommandHandlerPtr first_handler = std::make_shared<CountingCommandHandler>(num_of_runs, num_of_runs_after_destruction);
+    const std::weak_ptr<CommandHandlerInterface> weak_first_handler = first_handler;
+
+    registry.AddCommand("command");
+    registry.SetHandler("command", std::move(first_handler));
+    registry.SetHandler("command", std::make_shared<CountingCommandHandler>(num_of_runs, num_of_runs_after_destruction));
+
+    EXPECT_TRUE(weak_first_handler.expired());
+}
+
+TEST(TestCommandHandlerRegistry, HandlersMayBeReplacedDuringConcurrentDispatches)
+{
+    const unsigned int num_of_reader_threads {8U};
+    const unsigned int num_of_dispatches {5000U};
+    const unsigned int num_of_swaps {1000U};
+    std::atomic<unsigned int> num_of_runs {0U};
+    std::atomic<unsigned int> num_of_runs_after_destruction {0U};
+    std::atomic<unsigned int> num_of_missing_handlers {0U};
+    CommandHandlerRegistry registry {};
+    const ParsedCommand parsed_command("command", {}, {}, {});
+    std::vector<std::thread> threads {};
+
+    registry.AddCommand("command");
+    registry.SetHandler("command", std::make_shared<CountingCommandHandler>(num_of_runs, num_of_runs_after_destruction));
+
+    for (unsigned int i=0U; i<num_of_reader_threads; i++) {
+        threads.emplace_back([&]() {
+            for (unsigned int j=0U; j<num_of_dispatches; j++) {
+                const CommandHandlerPtr command_handler = registry.GetHandler("command");
+
+                if (!command_handler) {
+                    num_of_missing_handlers++;
+                    continue;
+                }
+
+                command_handler->Run(parsed_command);
+            }
+        });
+    }
+    threads.emplace_back([&]() {
+        for (unsigned int i=0U; i<num_of_swaps; i++) {
+            registry.SetHandler("command", std::make_shared<CountingCommandHandler>(num_of_runs, num_of_runs_after_destruction));
+        }
+    });
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(num_of_runs, num_of_reader_threads * num_of_dispatches);
+    EXPECT_EQ(num_of_runs_after_destruction, 0U);
+    EXPECT_EQ(num_of_missing_handlers, 0U);
+}
\ No newline at end of file
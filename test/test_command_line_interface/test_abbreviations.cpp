@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+
+#include "comlint/command_line_interface.hpp"
+#include "comlint/exceptions/ambiguous_abbreviation.hpp"
+#include "comlint/exceptions/unsupported_command.hpp"
+#include "comlint/exceptions/unsupported_flag.hpp"
+
+using namespace comlint;
+
+TEST(TestCommandLineInterfaceAbbreviations, UniquePrefixesAreResolvedToFullNames)
+{
+    const int argc = 5;
+    char program_name[] = "program.exe";
+    char command[] = "comm";
+    char option[] = "-mess";
+    char option_value[] = "Initial commit";
+    char flag[] = "--verb";
+    char* argv[] = {program_name, command, option, option_value, flag};
+    const ParsedCommand expected_parsed_command("commit", {}, {{"-message", "Initial commit"}}, {{"--verbose", true}, {"--version", false}});
+
+    CommandLineInterface cli(argc, argv);
+
+    cli.AddCommand("commit", "Record changes", {"-message"}, {"--verbose"});
+    cli.AddCommand("checkout", "Switch branches");
+    cli.AddOption("-message", "Commit message");
+    cli.AddFlag("--verbose", "Be verbose");
+    cli.AddFlag("--version", "Print version");
+    cli.AllowAbbreviations();
+
+    EXPECT_EQ(cli.Parse(), expected_parsed_command);
+}
+
+TEST(TestCommandLineInterfaceAbbreviations, AbbreviationsAreRejectedUnlessAllowed)
+{
+    const int argc = 2;
+    char program_name[] = "program.exe";
+    char command[] = "comm";
+    char* argv[] = {program_name, command};
+
+    CommandLineInterface cli(argc, argv);
+
+    cli.AddCommand("commit", "Record changes");
+
+    EXPECT_THROW(cli.Parse(), UnsupportedCommand);
+
+    cli.AllowAbbreviations();
+
+    EXPECT_EQ(cli.Parse().name, "commit");
+
+    cli.AllowAbbreviations(false);
+
+    EXPECT_THROW(cli.Parse(), UnsupportedCommand);
+}
+
+TEST(TestCommandLineInterfaceAbbreviations, ExactNameIsPreferredOverLongerNames)
+{
+    const int argc = 2;
+    char program_name[] = "program.exe";
+    char command[] = "commit";
+    char* argv[] = {program_name, command};
+
+    CommandLineInterface cli(argc, argv);
+
+    cli.AddCommand("commit", "Record changes");
+    cli.AddCommand("commit-all", "Record all the changes");
+    cli.AllowAbbreviations();
+
+    EXPECT_EQ(cli.Parse().name, "commit");
+}
+
+TEST(TestCommandLineInterfaceAbbreviations, AmbiguousAbbreviationListsAllCandidates)
+{
+    const int argc = 3;
+    char program_name[] = "program.exe";
+    char command[] = "status";
+    char flag[] = "--ver";
+    char* argv[] = {program_name, command, flag};
+
+    CommandLineInterface cli(argc, argv);
+
+    cli.AddCommand("status", "Show status", NONE, {"--verbose", "--version"});
+    cli.AddFlag("--quiet", "Be quiet");
+    cli.AddFlag("--verbose", "Be verbose");
+    cli.AddFlag("--version", "Print version");
+    cli.AllowAbbreviations();
+
+    try {
+        cli.Parse();
+        FAIL() << "Expected AmbiguousAbbreviation";
+    }
+    catch (const AmbiguousAbbreviation &exception) {
+        EXPECT_EQ(std::string(exception.what()), "AmbiguousAbbreviation: Flag --ver is ambiguous! Did you mean:\n--verbose\n--version");
+    }
+}
+
+TEST(TestCommandLineInterfaceAbbreviations, PrefixOfNoNameIsStillUnsupported)
+{
+    const int argc = 3;
+    char program_name[] = "program.exe";
+    char command[] = "status";
+    char flag[] = "--verz";
+    char* argv[] = {program_name, command, flag};
+
+    CommandLineInterface cli(argc, argv);
+
+    cli.AddCommand("status", "Show status", NONE, {"--verbose"});
+    cli.AddFlag("--verbose", "Be verbose");
+    cli.AllowAbbreviations();
+
+    EXPECT_THROW(cli.Parse(), UnsupportedFlag);
+}
\ No newline at end of file
@@ -83,4 +83,22 @@ TEST(TestCommandLineInterfaceBasicFeatures, ParseReturnsEmptyParsedCommandIfInpu
     const ParsedCommand parsed_command = cli.Parse();
 
     EXPECT_EQ(parsed_command, expected_parsed_command);
+}
+
+TEST(TestCommandLineInterfaceBasicFeatures, ParsePrintsStaticHelpIfItIsSet)
+{
+    const int argc = 2;
+    char program_name[] = "program.exe";
+    char help[] = "--help";
+    char* argv[] = {program_name, help};
+    static constexpr std::string_view kStaticHelp {"Prerendered help\n"};
+    CommandLineInterface cli(argc, argv);
+
+    cli.AddCommand("command", "Some command");
+    cli.SetHelp(kStaticHelp);
+
+    testing::internal::CaptureStdout();
+    cli.Parse();
+
+    EXPECT_EQ(testing::internal::GetCapturedStdout(), kStaticHelp);
 }
\ No newline at end of file
@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 
+#include <thread>
+#include <vector>
+
 #include "comlint/command_line_interface.hpp"
 #include "mock_command_handler.hpp"
 
@@ -79,4 +82,43 @@ TEST(TestCommandLineInterfaceCommandHandlers, ProperCommandHandlerIsRanWithPrope
     EXPECT_CALL(*command_2_handler, Run(expected_parsed_command)).Times(1);
 
     cli.Run();
+}
+
+TEST(TestCommandLineInterfaceCommandHandlers, CommandHandlerMayBeReplacedWhileRunning)
+{
+    using ::testing::_;
+
+    const int argc = 2;
+    char program_name[] = "program.exe";
+    char command[] = "command";
+    char* argv[] = {program_name, command};
+    const unsigned int num_of_threads {4U};
+    const unsigned int num_of_runs {1000U};
+    CommandLineInterface cli(argc, argv);
+    std::vector<std::shared_ptr<MockCommandHandler>> command_handlers {};
+    std::vector<std::thread> threads {};
+
+    for (unsigned int i=0U; i<10U; i++) {
+        command_handlers.push_back(std::make_shared<MockCommandHandler>());
+        EXPECT_CALL(*command_handlers.back(), Run(_)).Times(::testing::AnyNumber());
+    }
+
+    cli.AddCommand("command", "Some command");
+    cli.AddCommandHandler("command", command_handlers.front());
+
+    for (unsigned int i=0U; i<num_of_threads; i++) {
+        threads.emplace_back([&cli]() {
+            for (unsigned int j=0U; j<num_of_runs; j++) {
+                cli.Run();
+            }
+        });
+    }
+    threads.emplace_back([&cli, &command_handlers]() {
+        for (unsigned int i=0U; i<num_of_runs; i++) {
+            cli.AddCommandHandler("command", command_handlers[i % command_handlers.size()]);
+        }
+    });
+    for (auto &thread : threads) {
+        thread.join();
+    }
 }
\ No newline at end of file
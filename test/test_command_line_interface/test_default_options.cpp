@@ -0,0 +1,222 @@
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+#include "comlint/command_line_interface.hpp"
+#include "comlint/exceptions/invalid_default_option_value.hpp"
+#include "comlint/exceptions/forbidden_option_value.hpp"
+#include "comlint/exceptions/forbidden_option.hpp"
+#include "comlint/exceptions/unsupported_option.hpp"
+
+using namespace comlint;
+
+class TestCommandLineInterfaceDefaultOptions : public ::testing::Test
+{
+protected:
+    std::string CreateConfigFile(const std::string &content)
+    {
+        std::ofstream file(config_file_path_);
+
+        file << content;
+
+        return config_file_path_.string();
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove(config_file_path_);
+    }
+
+private:
+    const std::filesystem::path config_file_path_ {std::filesystem::temp_directory_path() / "comlint_test_config_file.ini"};
+};
+
+TEST_F(TestCommandLineInterfaceDefaultOptions, AddOptionThrowsIfDefaultValueIsNotAllowed)
+{
+    const int argc = 1;
+    char program_name[] = "program.exe";
+    char* argv[] = {program_name};
+    CommandLineInterface cli(argc, argv);
+
+    EXPECT_THROW(cli.AddOption("-mode", "Mode in which file is opened", {"read_only", "read_write"}, "", "execute"), InvalidDefaultOptionValue);
+}
+
+TEST_F(TestCommandLineInterfaceDefaultOptions, DefaultValueIsUsedIfOptionIsNotProvided)
+{
+    const int argc = 2;
+    char program_name[] = "program.exe";
+    char open[] = "open";
+    char* argv[] = {program_name, open};
+    const ParsedCommand expected_parsed_command("open", {}, {{"-mode", "read_only"}}, {});
+
+    CommandLineInterface cli(argc, argv);
+
+    cli.AddCommand("open", "Command to open file", {"-mode"});
+    cli.AddCommand("close", "Command to close file");
+    cli.AddOption("-mode", "Mode in which file is opened", {"read_only", "read_write"}, "", "read_only");
+
+    const ParsedCommand parsed_command = cli.Parse();
+
+    EXPECT_EQ(parsed_command, expected_parsed_command);
+}
+
+TEST_F(TestCommandLineInterfaceDefaultOptions, DefaultValueIsNotUsedForCommandWhichDoesNotAllowOption)
+{
+    const int argc = 2;
+    char program_name[] = "program.exe";
+    char close[] = "close";
+    char* argv[] = {program_name, close};
+    const ParsedCommand expected_parsed_command("close", {}, {}, {});
+
+    CommandLineInterface cli(argc, argv);
+
+    cli.AddCommand("open", "Command to open file", {"-mode"});
+    cli.AddCommand("close", "Command to close file");
+    cli.AddOption("-mode", "Mode in which file is opened", {"read_only", "read_write"}, "", "read_only");
+
+    const ParsedCommand parsed_command = cli.Parse();
+
+    EXPECT_EQ(parsed_command, expected_parsed_command);
+}
+
+TEST_F(TestCommandLineInterfaceDefaultOptions, CommandLineValueTakesPrecedenceOverDefaultValue)
+{
+    const int argc = 4;
+    char program_name[] = "program.exe";
+    char open[] = "open";
+    char option[] = "-mode";
+    char option_value[] = "read_write";
+    char* argv[] = {program_name, open, option, option_value};
+    const ParsedCommand expected_parsed_command("open", {}, {{"-mode", "read_write"}}, {});
+
+    CommandLineInterface cli(argc, argv);
+
+    cli.AddCommand("open", "Command to open file", {"-mode"});
+    cli.AddOption("-mode", "Mode in which file is opened", {"read_only", "read_write"}, "", "read_only");
+
+    const ParsedCommand parsed_command = cli.Parse();
+
+    EXPECT_EQ(parsed_command, expected_parsed_command);
+}
+
+TEST_F(TestCommandLineInterfaceDefaultOptions, ConfigFileValueIsUsedForInvokedCommand)
+{
+    const int argc = 2;
+    char program_name[] = "program.exe";
+    char commit[] = "commit";
+    char* argv[] = {program_name, commit};
+    const ParsedCommand expected_parsed_command("commit", {}, {{"-m", "message from file"}, {"-c", "abc123"}}, {});
+
+    CommandLineInterface cli(argc, argv);
+
+    cli.AddCommand("commit", "Commit changes", {"-m", "-c"});
+    cli.AddCommand("merge", "Merge two branches", {"-s", "-m"});
+    cli.AddOption("-m", "Provide message", ANY, "", "default message");
+    cli.AddOption("-c", "Provide commit hash");
+    cli.AddOption("-s", "Specify merging strategy", {"recursive", "resolve"});
+    cli.SetConfigFile(CreateConfigFile("[merge]\n"
+                                       "-s = invalid_strategy\n"
+                                       "[commit]\n"
+                                       "-m = message from file\n"
+                                       "-c = abc000\n"
+                                       "-c = abc123\n"));
+
+    const ParsedCommand parsed_command = cli.Parse();
+
+    EXPECT_EQ(parsed_command, expected_parsed_command);
+}
+
+TEST_F(TestCommandLineInterfaceDefaultOptions, CommandLineValueTakesPrecedenceOverConfigFileValue)
+{
+    const int argc = 4;
+    char program_name[] = "program.exe";
+    char commit[] = "commit";
+    char option[] = "-m";
+    char option_value[] = "message from command line";
+    char* argv[] = {program_name, commit, option, option_value};
+    const ParsedCommand expected_parsed_command("commit", {}, {{"-m", "message from command line"}}, {});
+
+    CommandLineInterface cli(argc, argv);
+
+    cli.AddCommand("commit", "Commit changes", {"-m"});
+    cli.AddOption("-m", "Provide message");
+    cli.SetConfigFile(CreateConfigFile("[commit]\n"
+                                       "-m = message from file\n"));
+
+    const ParsedCommand parsed_command = cli.Parse();
+
+    EXPECT_EQ(parsed_command, expected_parsed_command);
+}
+
+TEST_F(TestCommandLineInterfaceDefaultOptions, NotExistingConfigFileIsIgnored)
+{
+    const int argc = 2;
+    char program_name[] = "program.exe";
+    char commit[] = "commit";
+    char* argv[] = {program_name, commit};
+    const ParsedCommand expected_parsed_command("commit", {}, {{"-m", "default message"}}, {});
+
+    CommandLineInterface cli(argc, argv);
+
+    cli.AddCommand("commit", "Commit changes", {"-m"});
+    cli.AddOption("-m", "Provide message", ANY, "", "default message");
+    cli.SetConfigFile("/not/existing/config.ini");
+
+    const ParsedCommand parsed_command = cli.Parse();
+
+    EXPECT_EQ(parsed_command, expected_parsed_command);
+}
+
+TEST_F(TestCommandLineInterfaceDefaultOptions, ThrowsIfConfigFileValueIsNotAllowed)
+{
+    const int argc = 2;
+    char program_name[] = "program.exe";
+    char merge[] = "merge";
+    char* argv[] = {program_name, merge};
+
+    CommandLineInterface cli(argc, argv);
+
+    cli.AddCommand("merge", "Merge two branches", {"-s"});
+    cli.AddOption("-s", "Specify merging strategy", {"recursive", "resolve"});
+    cli.SetConfigFile(CreateConfigFile("[merge]\n"
+                                       "-s = invalid_strategy\n"));
+
+    EXPECT_THROW(cli.Parse(), ForbiddenOptionValue);
+}
+
+TEST_F(TestCommandLineInterfaceDefaultOptions, ThrowsIfConfigFileOptionIsNotSupported)
+{
+    const int argc = 2;
+    char program_name[] = "program.exe";
+    char merge[] = "merge";
+    char* argv[] = {program_name, merge};
+
+    CommandLineInterface cli(argc, argv);
+
+    cli.AddCommand("merge", "Merge two branches", {"-s"});
+    cli.AddOption("-s", "Specify merging strategy");
+    cli.SetConfigFile(CreateConfigFile("[merge]\n"
+                                       "-x = value\n"));
+
+    EXPECT_THROW(cli.Parse(), UnsupportedOption);
+}
+
+TEST_F(TestCommandLineInterfaceDefaultOptions, ThrowsIfConfigFileOptionIsNotAllowedForCommand)
+{
+    const int argc = 2;
+    char program_name[] = "program.exe";
+    char merge[] = "merge";
+    char* argv[] = {program_name, merge};
+
+    CommandLineInterface cli(argc, argv);
+
+    cli.AddCommand("merge", "Merge two branches", {"-s"});
+    cli.AddOption("-s", "Specify merging strategy");
+    cli.AddOption("-m", "Provide message");
+    cli.SetConfigFile(CreateConfigFile("[merge]\n"
+                                       "-m = message\n"));
+
+    EXPECT_THROW(cli.Parse(), ForbiddenOption);
+}
\ No newline at end of file
@@ -0,0 +1,153 @@
+#include <cstdlib>
+
+#include <gtest/gtest.h>
+
+#include "comlint/command_line_interface.hpp"
+#include "comlint/exceptions/forbidden_option_value.hpp"
+
+using namespace comlint;
+
+class TestCommandLineInterfaceEnvironmentOptions : public ::testing::Test
+{
+protected:
+    void SetEnvironmentVariable(const std::string &name, const std::string &value)
+    {
+#ifdef _WIN32
+        _putenv_s(name.c_str(), value.c_str());
+#else
+        setenv(name.c_str(), value.c_str(), 1);
+#endif
+        variables_.push_back(name);
+    }
+
+    void TearDown() override
+    {
+        for (const auto &name : variables_) {
+#ifdef _WIN32
+            _putenv_s(name.c_str(), "");
+#else
+            unsetenv(name.c_str());
+#endif
+        }
+    }
+
+private:
+    std::vector<std::string> variables_;
+};
+
+TEST_F(TestCommandLineInterfaceEnvironmentOptions, OptionIsTakenFromEnvironmentVariable)
+{
+    const int argc = 2;
+    char program_name[] = "program.exe";
+    char open[] = "open";
+    char* argv[] = {program_name, open};
+    const ParsedCommand expected_parsed_command("open", {}, {{"-mode", "read_only"}}, {});
+
+    SetEnvironmentVariable("COMLINT_TEST_MODE", "read_only");
+
+    CommandLineInterface cli(argc, argv);
+
+    cli.AddCommand("open", "Command to open file", {"-mode"});
+    cli.AddOption("-mode", "Mode in which file is opened", ANY, "COMLINT_TEST_MODE");
+
+    const ParsedCommand parsed_command = cli.Parse();
+
+    EXPECT_EQ(parsed_command, expected_parsed_command);
+}
+
+TEST_F(TestCommandLineInterfaceEnvironmentOptions, CommandLineValueTakesPrecedenceOverEnvironmentVariable)
+{
+    const int argc = 4;
+    char program_name[] = "program.exe";
+    char open[] = "open";
+    char option[] = "-mode";
+    char option_value[] = "read_write";
+    char* argv[] = {program_name, open, option, option_value};
+    const ParsedCommand expected_parsed_command("open", {}, {{"-mode", "read_write"}}, {});
+
+    SetEnvironmentVariable("COMLINT_TEST_MODE", "read_only");
+
+    CommandLineInterface cli(argc, argv);
+
+    cli.AddCommand("open", "Command to open file", {"-mode"});
+    cli.AddOption("-mode", "Mode in which file is opened", ANY, "COMLINT_TEST_MODE");
+
+    const ParsedCommand parsed_command = cli.Parse();
+
+    EXPECT_EQ(parsed_command, expected_parsed_command);
+}
+
+TEST_F(TestCommandLineInterfaceEnvironmentOptions, OptionIsNotTakenFromUnsetEnvironmentVariable)
+{
+    const int argc = 2;
+    char program_name[] = "program.exe";
+    char open[] = "open";
+    char* argv[] = {program_name, open};
+    const ParsedCommand expected_parsed_command("open", {}, {}, {});
+
+    CommandLineInterface cli(argc, argv);
+
+    cli.AddCommand("open", "Command to open file", {"-mode"});
+    cli.AddOption("-mode", "Mode in which file is opened", ANY, "COMLINT_TEST_UNSET_MODE");
+
+    const ParsedCommand parsed_command = cli.Parse();
+
+    EXPECT_EQ(parsed_command, expected_parsed_command);
+}
+
+TEST_F(TestCommandLineInterfaceEnvironmentOptions, OptionIsNotTakenFromEnvironmentVariableIfForbiddenForCommand)
+{
+    const int argc = 2;
+    char program_name[] = "program.exe";
+    char open[] = "open";
+    char* argv[] = {program_name, open};
+    const ParsedCommand expected_parsed_command("open", {}, {}, {});
+
+    SetEnvironmentVariable("COMLINT_TEST_MODE", "read_only");
+
+    CommandLineInterface cli(argc, argv);
+
+    cli.AddCommand("open", "Command to open file");
+    cli.AddOption("-mode", "Mode in which file is opened", ANY, "COMLINT_TEST_MODE");
+
+    const ParsedCommand parsed_command = cli.Parse();
+
+    EXPECT_EQ(parsed_command, expected_parsed_command);
+}
+
+TEST_F(TestCommandLineInterfaceEnvironmentOptions, EnvironmentVariableSatisfiesRequiredOption)
+{
+    const int argc = 2;
+    char program_name[] = "program.exe";
+    char open[] = "open";
+    char* argv[] = {program_name, open};
+    const ParsedCommand expected_parsed_command("open", {}, {{"-mode", "read_only"}}, {});
+
+    SetEnvironmentVariable("COMLINT_TEST_MODE", "read_only");
+
+    CommandLineInterface cli(argc, argv);
+
+    cli.AddCommand("open", "Command to open file", {"-mode"}, NONE, {"-mode"});
+    cli.AddOption("-mode", "Mode in which file is opened", ANY, "COMLINT_TEST_MODE");
+
+    const ParsedCommand parsed_command = cli.Parse();
+
+    EXPECT_EQ(parsed_command, expected_parsed_command);
+}
+
+TEST_F(TestCommandLineInterfaceEnvironmentOptions, ThrowsIfEnvironmentVariableValueIsNotAllowed)
+{
+    const int argc = 2;
+    char program_name[] = "program.exe";
+    char open[] = "open";
+    char* argv[] = {program_name, open};
+
+    SetEnvironmentVariable("COMLINT_TEST_MODE", "execute");
+
+    CommandLineInterface cli(argc, argv);
+
+    cli.AddCommand("open", "Command to open file", {"-mode"});
+    cli.AddOption("-mode", "Mode in which file is opened", {"read_only", "read_write"}, "COMLINT_TEST_MODE");
+
+    EXPECT_THROW(cli.Parse(), ForbiddenOptionValue);
+}
\ No newline at end of file
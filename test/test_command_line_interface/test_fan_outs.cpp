@@ -0,0 +1,72 @@
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "comlint/command_line_interface.hpp"
+#include "comlint/exceptions/unsupported_command.hpp"
+
+using namespace comlint;
+
+namespace {
+
+class PrintingCommandHandler : public CommandHandlerInterface
+{
+public:
+    void Run(const ParsedCommand &command) final
+    {
+        OutputSink output {};
+
+        Run(command, output);
+    }
+    void Run(const ParsedCommand &command, OutputSink &output) final
+    {
+        output << "Adding";
+
+        for (const auto &value : command.values) {
+            output << ' ' << value;
+        }
+
+        output << " in " << (command.flags.at("--force") ? "force" : "normal") << " mode\n";
+    }
+};
+
+} // namespace
+
+TEST(TestCommandLineInterfaceFanOuts, HandlerIsInvokedForEveryChunkOfValues)
+{
+    char program_name[] = "program.exe";
+    char add[] = "add";
+    char first_file[] = "a.txt";
+    char second_file[] = "b.txt";
+    char third_file[] = "c.txt";
+    char flag[] = "--force";
+    char* argv[] = {program_name, add, first_file, second_file, third_file, flag};
+    std::ostringstream stream {};
+
+    CommandLineInterface cli(6, argv);
+
+    cli.AddCommand("add", "Add files", 3U, ANY, NONE, {"--force"});
+    cli.AddFlag("--force", "Overwrite files");
+    cli.AddCommandHandler("add", std::make_shared<PrintingCommandHandler>());
+    cli.SetFanOut("add", {0U, 2U, true});
+
+    {
+        OutputSink output(stream);
+
+        cli.Run(output);
+    }
+
+    EXPECT_EQ(stream.str(), "Adding a.txt b.txt in force mode\nAdding c.txt in force mode\n");
+}
+
+TEST(TestCommandLineInterfaceFanOuts, FanOutOfUnknownCommandIsRejected)
+{
+    char program_name[] = "program.exe";
+    char* argv[] = {program_name};
+
+    CommandLineInterface cli(1, argv);
+
+    EXPECT_THROW(cli.SetFanOut("add"), UnsupportedCommand);
+}
\ No newline at end of file
@@ -0,0 +1,105 @@
+#include <sstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "comlint/command_line_interface.hpp"
+#include "comlint/exceptions/missing_command_handler.hpp"
+#include "comlint/exceptions/unsupported_command.hpp"
+#include "mock_command_handler.hpp"
+
+using namespace comlint;
+
+TEST(TestCommandLineInterfaceFunctionHandlers, LambdaHandlerOfParsedCommandIsRun)
+{
+    char program_name[] = "program.exe";
+    char commit[] = "commit";
+    char option[] = "-m";
+    char message[] = "message";
+    char* argv[] = {program_name, commit, option, message};
+    unsigned int num_of_add_calls = 0U;
+    std::string committed_message {};
+
+    CommandLineInterface cli(4, argv);
+
+    cli.AddCommand("add", "Add files", 1U);
+    cli.AddCommand("commit", "Record changes", {"-m"});
+    cli.AddOption("-m", "Commit message");
+    cli.AddCommandHandler("add", [&](const ParsedCommand&) { num_of_add_calls++; });
+    cli.AddCommandHandler("commit", [&](const ParsedCommand &command) { committed_message = command.options.at("-m"); });
+
+    cli.Run();
+
+    EXPECT_EQ(num_of_add_calls, 0U);
+    EXPECT_EQ(committed_message, "message");
+}
+
+TEST(TestCommandLineInterfaceFunctionHandlers, LambdaHandlerWritesToOutputSink)
+{
+    char program_name[] = "program.exe";
+    char add[] = "add";
+    char value[] = "file.txt";
+    char* argv[] = {program_name, add, value};
+    std::ostringstream stream {};
+
+    CommandLineInterface cli(3, argv);
+
+    cli.AddCommand("add", "Add files", 1U);
+    cli.AddCommandHandler("add", [](const ParsedCommand &command, OutputSink &output) {
+        output << "Adding " << std::string_view(command.values.front()) << '\n';
+    });
+
+    {
+        OutputSink output(stream);
+
+        cli.Run(output);
+    }
+
+    EXPECT_EQ(stream.str(), "Adding file.txt\n");
+}
+
+TEST(TestCommandLineInterfaceFunctionHandlers, HandlersAreDispatchedAfterInterfaceIsRecompiled)
+{
+    char program_name[] = "program.exe";
+    char status[] = "status";
+    char* argv[] = {program_name, status};
+    const auto status_handler = std::make_shared<MockCommandHandler>();
+
+    CommandLineInterface cli(2, argv);
+
+    cli.AddCommand("status", "Show status");
+    cli.AddCommandHandler("status", status_handler);
+
+    EXPECT_CALL(*status_handler, Run(ParsedCommand("status", {}, {}, {}))).Times(2);
+
+    cli.Run();
+    // commands added later are sorted before and after the already dispatched one
+    cli.AddCommand("add", "Add files");
+    cli.AddCommand("tag", "Create tag");
+    cli.Run();
+}
+
+TEST(TestCommandLineInterfaceFunctionHandlers, RunWithoutCommandIsRejected)
+{
+    char program_name[] = "program.exe";
+    char flag[] = "--verbose";
+    char* argv[] = {program_name, flag};
+
+    CommandLineInterface cli(2, argv);
+
+    cli.AddCommand("status", "Show status");
+    cli.AddFlag("--verbose", "Be verbose");
+    cli.AddCommandHandler("status", [](const ParsedCommand&) {});
+
+    EXPECT_THROW(cli.Run(), MissingCommandHandler);
+}
+
+TEST(TestCommandLineInterfaceFunctionHandlers, LambdaHandlerOfUnknownCommandIsRejected)
+{
+    char program_name[] = "program.exe";
+    char* argv[] = {program_name};
+
+    CommandLineInterface cli(1, argv);
+
+    EXPECT_THROW(cli.AddCommandHandler("status", [](const ParsedCommand&) {}), UnsupportedCommand);
+}
\ No newline at end of file
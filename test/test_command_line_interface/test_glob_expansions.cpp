@@ -0,0 +1,107 @@
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "comlint/command_line_interface.hpp"
+#include "comlint/exceptions/unsupported_option.hpp"
+#include "mock_command_handler.hpp"
+
+using namespace comlint;
+using ::testing::_;
+
+class TestCommandLineInterfaceGlobExpansions : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        for (const std::string file : {"a.log", "b.log", "nested/c.log", "notes.txt"}) {
+            std::filesystem::create_directories((directory_path_ / file).parent_path());
+            std::ofstream(directory_path_ / file) << file;
+        }
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(directory_path_);
+    }
+
+    const std::filesystem::path directory_path_ {std::filesystem::temp_directory_path() / "comlint_test_glob_expansions"};
+    const std::string directory_ {directory_path_.string()};
+    std::string logs_pattern_ {directory_ + "/**/*.log"};
+    std::string notes_path_ {directory_ + "/notes.txt"};
+};
+
+TEST_F(TestCommandLineInterfaceGlobExpansions, HandlerGetsMatchesOfCommandValuePattern)
+{
+    char program_name[] = "program.exe";
+    char compress[] = "compress";
+    char* argv[] = {program_name, compress, logs_pattern_.data(), notes_path_.data()};
+    auto command_handler = std::make_unique<MockCommandHandler>();
+
+    CommandLineInterface cli(4, argv);
+
+    cli.AddCommand("compress", "Compress files", 2U);
+    cli.SetGlobExpansion("compress", GlobExpansion::kOrdered);
+    cli.SetPathRequirement("compress", PathRequirement::kFile);
+    EXPECT_CALL(*command_handler, Run(_)).WillOnce([this](const ParsedCommand &parsed_command) {
+        std::vector<std::string> paths {};
+
+        for (const auto &value : parsed_command.values) {
+            parsed_command.ForEachPath(value, [&paths](const std::string &path) { paths.push_back(path); });
+        }
+
+        EXPECT_EQ(paths, std::vector<std::string>({directory_ + "/a.log", directory_ + "/b.log", directory_ + "/nested/c.log", notes_path_}));
+        EXPECT_EQ(parsed_command.globs.size(), 1U);
+        EXPECT_EQ(parsed_command.paths.size(), 1U);
+    });
+    cli.AddCommandHandler("compress", std::move(command_handler));
+
+    cli.Run();
+}
+
+TEST_F(TestCommandLineInterfaceGlobExpansions, OptionValuePatternIsExpandedInParsedCommandFromMemoryResource)
+{
+    char program_name[] = "program.exe";
+    char option[] = "-input";
+    char* argv[] = {program_name, option, logs_pattern_.data()};
+    std::pmr::monotonic_buffer_resource memory_resource {};
+
+    CommandLineInterface cli(3, argv);
+
+    cli.AddOption("-input", "Input files");
+    cli.SetGlobExpansion("-input");
+
+    const pmr::ParsedCommand parsed_command = cli.Parse(&memory_resource);
+    std::vector<std::string> paths {};
+
+    parsed_command.ForEachPath(parsed_command.options.at("-input"), [&paths](const std::string &path) { paths.push_back(path); });
+    std::sort(paths.begin(), paths.end());
+
+    EXPECT_EQ(paths, std::vector<std::string>({directory_ + "/a.log", directory_ + "/b.log", directory_ + "/nested/c.log"}));
+}
+
+TEST_F(TestCommandLineInterfaceGlobExpansions, PatternsAreKeptAsIsWithoutGlobExpansion)
+{
+    char program_name[] = "program.exe";
+    char option[] = "-input";
+    char* argv[] = {program_name, option, logs_pattern_.data()};
+    std::vector<std::string> paths {};
+
+    CommandLineInterface cli(3, argv);
+
+    cli.AddOption("-input", "Input files");
+
+    const ParsedCommand parsed_command = cli.Parse();
+
+    parsed_command.ForEachPath(parsed_command.options.at("-input"), [&paths](const std::string &path) { paths.push_back(path); });
+
+    EXPECT_TRUE(parsed_command.globs.empty());
+    EXPECT_EQ(paths, std::vector<std::string>({logs_pattern_}));
+    EXPECT_THROW(cli.SetGlobExpansion("-output"), UnsupportedOption);
+}
\ No newline at end of file
@@ -0,0 +1,74 @@
+#include <memory>
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+#include "comlint/command_line_interface.hpp"
+#include "comlint/exceptions/invalid_command_handler.hpp"
+#include "mock_command_handler.hpp"
+
+using namespace comlint;
+
+TEST(TestCommandLineInterfaceHandlerFactories, OnlyHandlerOfUsedCommandIsCreated)
+{
+    char program_name[] = "program.exe";
+    char commit[] = "commit";
+    char* argv[] = {program_name, commit};
+    unsigned int num_of_add_creations = 0U;
+    unsigned int num_of_commit_creations = 0U;
+    const auto commit_handler = std::make_shared<MockCommandHandler>();
+
+    CommandLineInterface cli(2, argv);
+
+    cli.AddCommand("add", "Add files");
+    cli.AddCommand("commit", "Record changes");
+    cli.AddCommandHandlerFactory("add", [&]() {
+        num_of_add_creations++;
+        return std::make_shared<MockCommandHandler>();
+    });
+    cli.AddCommandHandlerFactory("commit", [&]() {
+        num_of_commit_creations++;
+        return commit_handler;
+    });
+
+    EXPECT_CALL(*commit_handler, Run(ParsedCommand("commit", {}, {}, {}))).Times(2);
+
+    cli.Run();
+    cli.Run();
+
+    EXPECT_EQ(num_of_add_creations, 0U);
+    EXPECT_EQ(num_of_commit_creations, 1U);
+}
+
+TEST(TestCommandLineInterfaceHandlerFactories, HandlerIsLoadedFromPlugin)
+{
+    char program_name[] = "program.exe";
+    char commit[] = "commit";
+    char* argv[] = {program_name, commit};
+    std::ostringstream stream {};
+
+    CommandLineInterface cli(2, argv);
+
+    cli.AddCommand("commit", "Record changes");
+    cli.AddCommandHandlerPlugin("commit", COMLINT_TEST_PLUGIN_PATH, "create_printing_handler");
+
+    {
+        OutputSink output(stream);
+
+        cli.Run(output);
+    }
+
+    EXPECT_EQ(stream.str(), "Running commit from plugin\n");
+}
+
+TEST(TestCommandLineInterfaceHandlerFactories, EmptyFactoryIsRejected)
+{
+    char program_name[] = "program.exe";
+    char* argv[] = {program_name};
+
+    CommandLineInterface cli(1, argv);
+
+    cli.AddCommand("commit", "Record changes");
+
+    EXPECT_THROW(cli.AddCommandHandlerFactory("commit", CommandHandlerFactory{}), InvalidCommandHandler);
+}
\ No newline at end of file
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "comlint/command_line_interface.hpp"
+#include "comlint/exceptions/memory_budget_exceeded.hpp"
+#include "mock_command_handler.hpp"
+
+using namespace comlint;
+
+TEST(TestCommandLineInterfaceMemoryBudget, FootprintGrowsWithEveryAddedElement)
+{
+    char program_name[] = "program";
+    char* argv[] = {program_name};
+    CommandLineInterface cli(1, argv);
+
+    const MemoryFootprint empty_footprint = cli.GetMemoryFootprint();
+    cli.AddCommand("open", "Command to open file", {"-mode"}, {"--verbose"});
+    const MemoryFootprint command_footprint = cli.GetMemoryFootprint();
+    cli.AddOption("-mode", "Mode in which file is opened", {"read_only", "read_write"});
+    const MemoryFootprint option_footprint = cli.GetMemoryFootprint();
+    cli.AddFlag("--verbose", "Show verbose output");
+    const MemoryFootprint flag_footprint = cli.GetMemoryFootprint();
+    cli.AddCommandHandler("open", std::make_unique<MockCommandHandler>());
+    const MemoryFootprint handler_footprint = cli.GetMemoryFootprint();
+    cli.AddCommandHandler("open", std::make_unique<MockCommandHandler>());
+
+    EXPECT_EQ(empty_footprint.GetTotal(), 0U);
+    EXPECT_GT(command_footprint.lookup_indexes, 0U);
+    EXPECT_GT(command_footprint.handlers, 0U);
+    EXPECT_GT(option_footprint.allowed_values, command_footprint.allowed_values);
+    EXPECT_GT(flag_footprint.lookup_indexes, option_footprint.lookup_indexes);
+    EXPECT_EQ(handler_footprint.handlers, flag_footprint.handlers + sizeof(CommandHandlerPtr));
+    EXPECT_EQ(cli.GetMemoryFootprint().GetTotal(), handler_footprint.GetTotal());
+}
+
+TEST(TestCommandLineInterfaceMemoryBudget, ElementExceedingBudgetIsNotAdded)
+{
+    char program_name[] = "program";
+    char help[] = "help";
+    char* argv[] = {program_name, help};
+    CommandLineInterface cli(2, argv);
+
+    cli.AddFlag("--verbose", "Show verbose output");
+    cli.SetMemoryBudget(cli.GetMemoryFootprint().GetTotal() + 1U);
+    const MemoryFootprint footprint = cli.GetMemoryFootprint();
+
+    EXPECT_THROW(cli.AddCommand("open", "Command to open file"), MemoryBudgetExceeded);
+    EXPECT_THROW(cli.AddOption("-mode", "Mode in which file is opened"), MemoryBudgetExceeded);
+    EXPECT_THROW(cli.AddFlag("--quiet", "Show no output"), MemoryBudgetExceeded);
+    EXPECT_EQ(cli.GetMemoryFootprint().GetTotal(), footprint.GetTotal());
+
+    cli.SetMemoryBudget(0U);
+    cli.AddCommand("open", "Command to open file");
+
+    EXPECT_EQ(cli.Parse().name, "help");
+    EXPECT_GT(cli.GetMemoryFootprint().GetTotal(), footprint.GetTotal());
+}
+
+TEST(TestCommandLineInterfaceMemoryBudget, BudgetLowerThanCurrentFootprintIsRejected)
+{
+    char program_name[] = "program";
+    char* argv[] = {program_name};
+    CommandLineInterface cli(1, argv);
+
+    cli.AddCommand("open", "Command to open file");
+
+    EXPECT_THROW(cli.SetMemoryBudget(1U), MemoryBudgetExceeded);
+    EXPECT_NO_THROW(cli.SetMemoryBudget(cli.GetMemoryFootprint().GetTotal()));
+}
+
+TEST(TestCommandLineInterfaceMemoryBudget, CompiledInterfaceIsIncludedInFootprintAndBudget)
+{
+    const int argc = 2;
+    char program_name[] = "program";
+    char open[] = "open";
+    char* argv[] = {program_name, open};
+    CommandLineInterface cli(argc, argv);
+
+    cli.AddCommand("open", "Command to open file", {"-mode"}, {"--verbose"});
+    cli.AddOption("-mode", "Mode in which file is opened", {"read_only", "read_write"});
+    cli.AddFlag("--verbose", "Show verbose output");
+
+    const MemoryFootprint declared_footprint = cli.GetMemoryFootprint();
+    const MemoryFootprint compiled_footprint = cli.Compile().GetMemoryFootprint();
+
+    cli.SetMemoryBudget(declared_footprint.GetTotal() + compiled_footprint.GetTotal() - 1U);
+
+    EXPECT_THROW(cli.Parse(), MemoryBudgetExceeded);
+    EXPECT_EQ(cli.GetMemoryFootprint().GetTotal(), declared_footprint.GetTotal());
+
+    cli.SetMemoryBudget(declared_footprint.GetTotal() + compiled_footprint.GetTotal());
+
+    EXPECT_EQ(cli.Parse().name, "open");
+    EXPECT_EQ(cli.GetMemoryFootprint().GetTotal(), declared_footprint.GetTotal() + compiled_footprint.GetTotal());
+    EXPECT_THROW(cli.SetMemoryBudget(declared_footprint.GetTotal()), MemoryBudgetExceeded);
+}
\ No newline at end of file
@@ -0,0 +1,86 @@
+#include <array>
+#include <memory_resource>
+
+#include <gtest/gtest.h>
+
+#include "comlint/command_line_interface.hpp"
+
+using namespace comlint;
+
+TEST(TestCommandLineInterfaceMemoryResources, ParseWithMemoryResourceReturnsSameResultAsParse)
+{
+    const int argc = 6;
+    char program_name[] = "program.exe";
+    char open[] = "open";
+    char path[] = "/some/very/long/path/to/the/file.txt";
+    char option[] = "-mode";
+    char option_value[] = "read_only";
+    char flag[] = "--verbose";
+    char* argv[] = {program_name, open, path, option, option_value, flag};
+    std::pmr::monotonic_buffer_resource memory_resource {};
+
+    CommandLineInterface cli(argc, argv);
+
+    cli.AddCommand("open", "Command to open file", 1U, ANY, {"-mode"}, {"--verbose"});
+    cli.AddOption("-mode", "Mode in which file is opened", {"read_only", "read_write"});
+    cli.AddFlag("--verbose", "Show verbose output");
+    cli.AddFlag("--quiet", "Show no output");
+
+    const ParsedCommand parsed_command = cli.Parse();
+    const pmr::ParsedCommand pmr_parsed_command = cli.Parse(&memory_resource);
+
+    EXPECT_EQ(pmr_parsed_command.get_allocator().resource(), &memory_resource);
+    EXPECT_EQ(std::string_view(pmr_parsed_command.name), parsed_command.name);
+    ASSERT_EQ(pmr_parsed_command.values.size(), parsed_command.values.size());
+    EXPECT_EQ(pmr_parsed_command.values.front(), path);
+    EXPECT_EQ(pmr_parsed_command.options.size(), parsed_command.options.size());
+    EXPECT_EQ(pmr_parsed_command.options.at("-mode"), "read_only");
+    EXPECT_EQ(pmr_parsed_command.flags.size(), parsed_command.flags.size());
+    EXPECT_TRUE(pmr_parsed_command.flags.at("--verbose"));
+    EXPECT_FALSE(pmr_parsed_command.flags.at("--quiet"));
+}
+
+TEST(TestCommandLineInterfaceMemoryResources, SchemaAndParsedCommandFitInStackBuffer)
+{
+    const int argc = 5;
+    char program_name[] = "program.exe";
+    char commit[] = "commit";
+    char option[] = "-m";
+    char option_value[] = "Some rather long commit message which does not fit in small string buffer";
+    char flag[] = "--amend";
+    char* argv[] = {program_name, commit, option, option_value, flag};
+    std::array<std::byte, 16384U> buffer {};
+    std::pmr::monotonic_buffer_resource memory_resource(buffer.data(), buffer.size(), std::pmr::null_memory_resource());
+
+    CommandLineInterface cli(argc, argv, "", "Description long enough to be allocated on the heap", true, &memory_resource);
+
+    cli.AddCommand("commit", "Commit changes", {"-m", "-c"}, {"--verbose", "--amend"}, {"-m"});
+    cli.AddCommand("merge", "Merge two branches", 2U, ANY, {"-s", "-m"}, NONE, {"-s"});
+    cli.AddOption("-m", "Provide message");
+    cli.AddOption("-c", "Provide commit hash");
+    cli.AddOption("-s", "Specify merging strategy", {"recursive", "resolve", "subtree"});
+    cli.AddFlag("--verbose", "Show verbose output");
+    cli.AddFlag("--amend", "Join to previous commit");
+
+    const pmr::ParsedCommand parsed_command = cli.Parse(&memory_resource);
+
+    EXPECT_EQ(parsed_command.name, "commit");
+    EXPECT_EQ(parsed_command.options.at("-m"), option_value);
+    EXPECT_TRUE(parsed_command.flags.at("--amend"));
+    EXPECT_FALSE(parsed_command.flags.at("--verbose"));
+}
+
+TEST(TestCommandLineInterfaceMemoryResources, SchemaIsAllocatedFromGivenMemoryResource)
+{
+    const int argc = 2;
+    char program_name[] = "program.exe";
+    char open[] = "open";
+    char* argv[] = {program_name, open};
+    std::array<std::byte, 64U> buffer {};
+    std::pmr::monotonic_buffer_resource memory_resource(buffer.data(), buffer.size(), std::pmr::null_memory_resource());
+
+    CommandLineInterface cli(argc, argv, "", "", true, &memory_resource);
+
+    EXPECT_THROW(cli.AddCommand("open", "Description which is too long to fit in the remaining part of the small buffer", 1U,
+                                {"allowed_value_1", "allowed_value_2", "allowed_value_3"}), std::bad_alloc);
+}
\ No newline at end of file
@@ -0,0 +1,82 @@
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "comlint/command_line_interface.hpp"
+
+using namespace comlint;
+
+TEST(TestCommandLineInterfaceMetrics, RunsAndErrorsOfCommandsAreCollected)
+{
+    char program_name[] = "program.exe";
+    char add[] = "add";
+    char file[] = "file.txt";
+    char* argv[] = {program_name, add, file};
+    bool is_failing = false;
+
+    CommandLineInterface cli(3, argv);
+
+    cli.AddCommand("add", "Add files", 1U);
+    cli.AddCommand("status", "Show status");
+    cli.EnableMetrics();
+    cli.AddCommandHandler("add", [&](const ParsedCommand&) {
+        if (is_failing) {
+            throw std::invalid_argument("file is ignored");
+        }
+    });
+
+    cli.Run();
+    cli.Run();
+    is_failing = true;
+    EXPECT_THROW(cli.Run(), std::invalid_argument);
+
+    const std::vector<CommandMetrics> metrics = cli.GetMetrics();
+    const std::map<std::string, std::uint64_t> expected_errors {{"std::invalid_argument", 1U}};
+
+    ASSERT_EQ(metrics.size(), 2U);
+    EXPECT_EQ(metrics[0U].name, "add");
+    EXPECT_EQ(metrics[0U].num_of_runs, 3U);
+    EXPECT_EQ(metrics[0U].num_of_errors, expected_errors);
+    EXPECT_EQ(metrics[1U].name, "status");
+    EXPECT_EQ(metrics[1U].num_of_runs, 0U);
+}
+
+TEST(TestCommandLineInterfaceMetrics, CommandsAddedLaterAreCollected)
+{
+    char program_name[] = "program.exe";
+    char status[] = "status";
+    char* argv[] = {program_name, status};
+
+    CommandLineInterface cli(2, argv);
+
+    cli.AddCommand("status", "Show status");
+    cli.EnableMetrics();
+    cli.AddCommandHandler("status", [](const ParsedCommand&) {});
+    cli.Run();
+    cli.AddCommand("add", "Add files");
+    cli.Run();
+
+    const std::vector<CommandMetrics> metrics = cli.GetMetrics();
+
+    // commands keep the order in which they were first compiled, so the added one comes last
+    ASSERT_EQ(metrics.size(), 2U);
+    EXPECT_EQ(metrics[0U].name, "status");
+    EXPECT_EQ(metrics[0U].num_of_runs, 2U);
+    EXPECT_EQ(metrics[1U].name, "add");
+    EXPECT_EQ(metrics[1U].num_of_runs, 0U);
+}
+
+TEST(TestCommandLineInterfaceMetrics, NoMetricsAreCollectedUnlessEnabled)
+{
+    char program_name[] = "program.exe";
+    char status[] = "status";
+    char* argv[] = {program_name, status};
+
+    CommandLineInterface cli(2, argv);
+
+    cli.AddCommand("status", "Show status");
+    cli.AddCommandHandler("status", [](const ParsedCommand&) {});
+    cli.Run();
+
+    EXPECT_TRUE(cli.GetMetrics().empty());
+}
\ No newline at end of file
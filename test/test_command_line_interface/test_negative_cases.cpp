@@ -138,6 +138,32 @@ TEST(TestCommandLineInterfaceNegativeCases, ParseThrowsMissingRequiredOption)
     EXPECT_THROW(cli.Parse(), MissingRequiredOption);
 }
 
+TEST(TestCommandLineInterfaceNegativeCases, ParseThrowsMissingRequiredOptionForManyOptions)
+{
+    const int argc = 4;
+    char program_name[] = "program.exe";
+    char command[] = "command";
+    char option_name[] = "-option_0";
+    char option_value[] = "option_value";
+    char* argv[] = {program_name, command, option_name, option_value};
+    CommandLineInterface cli(argc, argv);
+    OptionNames allowed_options {};
+
+    for (unsigned int i=0U; i<100U; i++) {
+        allowed_options.push_back("-option_" + std::to_string(i));
+    }
+
+    const OptionNames required_options {"-option_0", "-option_99"};
+
+    cli.AddCommand("command", "Some command", allowed_options, NONE, required_options);
+
+    for (const auto &allowed_option : allowed_options) {
+        cli.AddOption(allowed_option, "Some option");
+    }
+
+    EXPECT_THROW(cli.Parse(), MissingRequiredOption);
+}
+
 TEST(TestCommandLineInterfaceNegativeCases, ParseThrowsMissingOptionValue)
 {
     const int argc = 3;
@@ -173,6 +199,29 @@ TEST(TestCommandLineInterfaceNegativeCases, ParseThrowsForbiddenOption)
     EXPECT_THROW(cli.Parse(), ForbiddenOption);
 }
 
+TEST(TestCommandLineInterfaceNegativeCases, ParseThrowsForbiddenOptionForManyOptions)
+{
+    const int argc = 4;
+    char program_name[] = "program.exe";
+    char command[] = "command";
+    char option_name[] = "-option_99";
+    char option_value[] = "option_value";
+    char* argv[] = {program_name, command, option_name, option_value};
+    CommandLineInterface cli(argc, argv);
+    OptionNames option_names {};
+
+    for (unsigned int i=0U; i<100U; i++) {
+        option_names.push_back("-option_" + std::to_string(i));
+        cli.AddOption(option_names.back(), "Some option");
+    }
+
+    const OptionNames allowed_options(option_names.begin(), option_names.end() - 1);
+
+    cli.AddCommand("command", "Some command", allowed_options);
+
+    EXPECT_THROW(cli.Parse(), ForbiddenOption);
+}
+
 TEST(TestCommandLineInterfaceNegativeCases, ParseThrowsForbiddenOptionForSpecifiedAllowedOptions)
 {
     const int argc = 4;
@@ -308,7 +357,7 @@ TEST(TestCommandLineInterfaceNegativeCases, AddCommandHandlerThrowsMissingComman
 
 TEST(TestCommandLineInterfaceNegativeCases, AddCommandThrowsInvalidCommandName)
 {
-    const int argc = 2;
+    const int argc = 1;
     char program_name[] = "program.exe";
     char* argv[] = {program_name};
     CommandLineInterface cli(argc, argv);
@@ -318,7 +367,7 @@ TEST(TestCommandLineInterfaceNegativeCases, AddCommandThrowsInvalidCommandName)
 
 TEST(TestCommandLineInterfaceNegativeCases, AddCommandThrowsDuplicatedCommand)
 {
-    const int argc = 2;
+    const int argc = 1;
     char program_name[] = "program.exe";
     char* argv[] = {program_name};
     CommandLineInterface cli(argc, argv);
@@ -330,7 +379,7 @@ TEST(TestCommandLineInterfaceNegativeCases, AddCommandThrowsDuplicatedCommand)
 
 TEST(TestCommandLineInterfaceNegativeCases, AddOptionThrowsInvalidOptionName)
 {
-    const int argc = 2;
+    const int argc = 1;
     char program_name[] = "program.exe";
     char* argv[] = {program_name};
     CommandLineInterface cli(argc, argv);
@@ -340,7 +389,7 @@ TEST(TestCommandLineInterfaceNegativeCases, AddOptionThrowsInvalidOptionName)
 
 TEST(TestCommandLineInterfaceNegativeCases, AddOptionThrowsDuplicatedOption)
 {
-    const int argc = 2;
+    const int argc = 1;
     char program_name[] = "program.exe";
     char* argv[] = {program_name};
     CommandLineInterface cli(argc, argv);
@@ -352,7 +401,7 @@ TEST(TestCommandLineInterfaceNegativeCases, AddOptionThrowsDuplicatedOption)
 
 TEST(TestCommandLineInterfaceNegativeCases, AddFlagThrowsInvalidFlagName)
 {
-    const int argc = 2;
+    const int argc = 1;
     char program_name[] = "program.exe";
     char* argv[] = {program_name};
     CommandLineInterface cli(argc, argv);
@@ -362,7 +411,7 @@ TEST(TestCommandLineInterfaceNegativeCases, AddFlagThrowsInvalidFlagName)
 
 TEST(TestCommandLineInterfaceNegativeCases, AddFlagThrowsDuplicatedFlag)
 {
-    const int argc = 2;
+    const int argc = 1;
     char program_name[] = "program.exe";
     char* argv[] = {program_name};
     CommandLineInterface cli(argc, argv);
@@ -0,0 +1,165 @@
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "comlint/command_line_interface.hpp"
+
+using namespace comlint;
+
+namespace {
+
+class PrintingCommandHandler : public CommandHandlerInterface
+{
+public:
+    void Run(const ParsedCommand &command) final
+    {
+        OutputSink output {};
+
+        Run(command, output);
+    }
+    void Run(const ParsedCommand &command, OutputSink &output) final
+    {
+        for (unsigned int i = 0U; i < 100U; ++i) {
+            output << "Running " << command.name << " with " << command.values.front() << '\n';
+        }
+    }
+};
+
+class FlushingCommandHandler : public CommandHandlerInterface
+{
+public:
+    explicit FlushingCommandHandler(const std::ostringstream &stream) : stream_{stream} {}
+
+    void Run(const ParsedCommand &command) final
+    {
+        OutputSink output {};
+
+        Run(command, output);
+    }
+    void Run(const ParsedCommand &command, OutputSink &output) final
+    {
+        output << "Opening " << command.values.front() << '\n';
+        output.Flush();
+        output_before_return_ = stream_.str();
+    }
+
+    std::string GetOutputBeforeReturn() const { return output_before_return_; }
+
+private:
+    const std::ostringstream &stream_;
+    std::string output_before_return_ {};
+};
+
+} // namespace
+
+TEST(TestCommandLineInterfaceOutputSinks, HandlerOutputIsCaptured)
+{
+    char program_name[] = "program.exe";
+    char open[] = "open";
+    char file[] = "file.txt";
+    char* argv[] = {program_name, open, file};
+    std::ostringstream stream {};
+
+    CommandLineInterface cli(3, argv);
+
+    cli.AddCommand("open", "Open file", 1U);
+    cli.AddCommandHandler("open", std::make_shared<PrintingCommandHandler>());
+
+    {
+        OutputSink output(stream);
+
+        cli.Run(output);
+    }
+
+    EXPECT_EQ(stream.str().size(), 100U * std::string("Running open with file.txt\n").size());
+    EXPECT_EQ(stream.str().rfind("Running open with file.txt\n", 0U), 0U);
+}
+
+TEST(TestCommandLineInterfaceOutputSinks, FlushedHandlerOutputIsWrittenBeforeHandlerReturns)
+{
+    char program_name[] = "program.exe";
+    char open[] = "open";
+    char file[] = "file.txt";
+    char* argv[] = {program_name, open, file};
+    std::ostringstream stream {};
+    const auto command_handler = std::make_shared<FlushingCommandHandler>(stream);
+
+    CommandLineInterface cli(3, argv);
+
+    cli.AddCommand("open", "Open file", 1U);
+    cli.AddCommandHandler("open", command_handler);
+
+    OutputSink output(stream);
+
+    cli.Run(output);
+
+    EXPECT_EQ(command_handler->GetOutputBeforeReturn(), "Opening file.txt\n");
+}
+
+TEST(TestCommandLineInterfaceOutputSinks, HelpIsWrittenToOutputSink)
+{
+    char program_name[] = "program.exe";
+    char help[] = "help";
+    char* argv[] = {program_name, help};
+    std::ostringstream stream {};
+
+    CommandLineInterface cli(2, argv);
+
+    cli.AddCommand("open", "Open file", 1U);
+    cli.SetHelp("Static help prompt\n");
+
+    {
+        OutputSink output(stream);
+
+        cli.Run(output);
+    }
+
+    EXPECT_EQ(stream.str(), "Static help prompt\n");
+}
+
+TEST(TestCommandLineInterfaceOutputSinks, OutputOfConcurrentRunsIsNotInterleaved)
+{
+    char program_name[] = "program.exe";
+    char open[] = "open";
+    char file[] = "file.txt";
+    char* argv[] = {program_name, open, file};
+    std::ostringstream stream {};
+    const std::string line {"Running open with file.txt\n"};
+    const std::string invocation_output = [&line]() {
+        std::string output {};
+
+        for (unsigned int i = 0U; i < 100U; ++i) {
+            output.append(line);
+        }
+        return output;
+    }();
+
+    CommandLineInterface cli(3, argv);
+
+    cli.AddCommand("open", "Open file", 1U);
+    cli.AddCommandHandler("open", std::make_shared<PrintingCommandHandler>());
+
+    {
+        OutputSink output(stream, 256U);
+        std::vector<std::thread> threads {};
+
+        for (unsigned int i = 0U; i < 8U; ++i) {
+            threads.emplace_back([&cli, &output]() { cli.Run(output); });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+    }
+
+    std::string expected_output {};
+
+    for (unsigned int i = 0U; i < 8U; ++i) {
+        expected_output.append(invocation_output);
+    }
+
+    EXPECT_EQ(stream.str(), expected_output);
+}
\ No newline at end of file
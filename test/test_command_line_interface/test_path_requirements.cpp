@@ -0,0 +1,100 @@
+#include <filesystem>
+#include <fstream>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "comlint/command_line_interface.hpp"
+#include "comlint/exceptions/invalid_path.hpp"
+#include "comlint/exceptions/unsupported_command.hpp"
+#include "mock_command_handler.hpp"
+
+using namespace comlint;
+using ::testing::_;
+
+class TestCommandLineInterfacePathRequirements : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        std::filesystem::create_directories(directory_path_);
+        std::ofstream(input_path_) << "input";
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(directory_path_);
+    }
+
+    const std::filesystem::path directory_path_ {std::filesystem::temp_directory_path() / "comlint_test_path_requirements"};
+    std::string directory_ {directory_path_.string()};
+    std::string input_path_ {(directory_path_ / "input.txt").string()};
+    std::string missing_path_ {(directory_path_ / "missing.txt").string()};
+};
+
+TEST_F(TestCommandLineInterfacePathRequirements, HandlerReceivesMetadataOfCheckedPaths)
+{
+    char program_name[] = "program.exe";
+    char copy[] = "copy";
+    char option[] = "-output";
+    char* argv[] = {program_name, copy, input_path_.data(), option, directory_.data()};
+    auto command_handler = std::make_unique<MockCommandHandler>();
+
+    CommandLineInterface cli(5, argv);
+
+    cli.AddCommand("copy", "Copy file to directory", 1U, ANY, {"-output"});
+    cli.AddOption("-output", "Output directory");
+    cli.SetPathRequirement("copy", PathRequirement::kFile | PathRequirement::kReadable);
+    cli.SetPathRequirement("-output", PathRequirement::kDirectory);
+    EXPECT_CALL(*command_handler, Run(_)).WillOnce([this](const ParsedCommand &parsed_command) {
+        ASSERT_EQ(parsed_command.paths.size(), 2U);
+        EXPECT_EQ(parsed_command.paths.at(input_path_).type, PathType::kFile);
+        EXPECT_EQ(parsed_command.paths.at(input_path_).size, 5U);
+        EXPECT_TRUE(parsed_command.paths.at(input_path_).is_readable);
+        EXPECT_EQ(parsed_command.paths.at(directory_).type, PathType::kDirectory);
+    });
+    cli.AddCommandHandler("copy", std::move(command_handler));
+
+    cli.Run();
+}
+
+TEST_F(TestCommandLineInterfacePathRequirements, AllInvalidPathsAreReportedTogether)
+{
+    char program_name[] = "program.exe";
+    char copy[] = "copy";
+    char option[] = "-output";
+    char* argv[] = {program_name, copy, missing_path_.data(), option, input_path_.data()};
+
+    CommandLineInterface cli(5, argv);
+
+    cli.AddCommand("copy", "Copy file to directory", 1U, ANY, {"-output"});
+    cli.AddOption("-output", "Output directory");
+    cli.SetPathRequirement("copy", PathRequirement::kFile);
+    cli.SetPathRequirement("-output", PathRequirement::kDirectory);
+
+    try {
+        cli.Parse();
+        FAIL() << "InvalidPath has not been thrown";
+    } catch (const InvalidPath &exception) {
+        const std::string message = exception.what();
+
+        EXPECT_NE(message.find(missing_path_ + " given for copy command does not exist."), std::string::npos);
+        EXPECT_NE(message.find(input_path_ + " given for -output option is not a directory."), std::string::npos);
+    }
+}
+
+TEST_F(TestCommandLineInterfacePathRequirements, ValuesWithoutRequirementAreNotChecked)
+{
+    char program_name[] = "program.exe";
+    char copy[] = "copy";
+    char* argv[] = {program_name, copy, missing_path_.data()};
+
+    CommandLineInterface cli(3, argv);
+
+    cli.AddCommand("copy", "Copy file to directory", 1U);
+    cli.AddOption("-output", "Output directory");
+    cli.SetPathRequirement("-output", PathRequirement::kDirectory);
+
+    EXPECT_TRUE(cli.Parse().paths.empty());
+    EXPECT_THROW(cli.SetPathRequirement("move", PathRequirement::kFile), UnsupportedCommand);
+}
\ No newline at end of file
@@ -0,0 +1,215 @@
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "comlint/command_line_interface.hpp"
+#include "comlint/exceptions/unsupported_command.hpp"
+
+using namespace comlint;
+
+class TestCommandLineInterfaceRecording : public ::testing::Test
+{
+protected:
+    void TearDown() override
+    {
+        unsetenv(std::string(InvocationLog::kEnvironmentVariable).c_str());
+        std::filesystem::remove(log_path_);
+    }
+
+    std::vector<InvocationRecord> ReadRecords() const
+    {
+        std::ifstream log_file(log_path_, std::ios::binary);
+        std::stringstream log {};
+
+        log << log_file.rdbuf();
+
+        return InvocationLog::Read(log.str());
+    }
+
+    static void AddInterface(CommandLineInterface &cli)
+    {
+        cli.AddCommand("commit", "Record changes", {"-m"}, {"--amend"});
+        cli.AddOption("-m", "Commit message");
+        cli.AddFlag("--amend", "Amend the previous commit");
+    }
+
+    const std::string log_path_ {(std::filesystem::temp_directory_path() / "comlint_test_recording.bin").string()};
+};
+
+TEST_F(TestCommandLineInterfaceRecording, ParsedInvocationIsRecorded)
+{
+    char program_name[] = "program.exe";
+    char commit[] = "commit";
+    char option[] = "-m";
+    char message[] = "message";
+    char* argv[] = {program_name, commit, option, message};
+
+    CommandLineInterface cli(4, argv);
+
+    AddInterface(cli);
+    cli.EnableRecording(log_path_);
+    cli.Parse();
+
+    const std::vector<InvocationRecord> records = ReadRecords();
+    const std::vector<std::string> expected_arguments {"commit", "-m", "message"};
+
+    ASSERT_EQ(records.size(), 1U);
+    EXPECT_EQ(records[0U].arguments, expected_arguments);
+    EXPECT_EQ(records[0U].outcome, InvocationOutcome::kParsed);
+    EXPECT_EQ(records[0U].result, "commit -m=message");
+    EXPECT_EQ(records[0U].run_time.count(), 0);
+}
+
+TEST_F(TestCommandLineInterfaceRecording, RunInvocationIsRecordedWithRunTime)
+{
+    char program_name[] = "program.exe";
+    char commit[] = "commit";
+    char amend[] = "--amend";
+    char* argv[] = {program_name, commit, amend};
+    std::pmr::monotonic_buffer_resource memory_resource {};
+
+    CommandLineInterface cli(3, argv);
+
+    AddInterface(cli);
+    cli.AddCommandHandler("commit", [](const ParsedCommand&) { std::this_thread::sleep_for(std::chrono::milliseconds(1)); });
+    cli.EnableRecording(log_path_);
+    cli.Run();
+    cli.Parse(&memory_resource);
+
+    const std::vector<InvocationRecord> records = ReadRecords();
+
+    ASSERT_EQ(records.size(), 2U);
+    EXPECT_EQ(records[0U].result, "commit --amend");
+    EXPECT_GE(records[0U].run_time, std::chrono::milliseconds(1));
+    EXPECT_EQ(records[1U].result, "commit --amend");
+    EXPECT_EQ(records[1U].schema_hash, records[0U].schema_hash);
+}
+
+TEST_F(TestCommandLineInterfaceRecording, InvocationWithFailingHandlerIsRecorded)
+{
+    char program_name[] = "program.exe";
+    char commit[] = "commit";
+    char* argv[] = {program_name, commit};
+
+    CommandLineInterface cli(2, argv);
+
+    AddInterface(cli);
+    cli.AddCommandHandler("commit", [](const ParsedCommand&) { throw std::runtime_error("nothing to commit"); });
+    cli.EnableRecording(log_path_);
+
+    EXPECT_THROW(cli.Run(), std::runtime_error);
+
+    const std::vector<InvocationRecord> records = ReadRecords();
+
+    ASSERT_EQ(records.size(), 1U);
+    EXPECT_EQ(records[0U].outcome, InvocationOutcome::kParsed);
+    EXPECT_EQ(records[0U].result, "commit");
+}
+
+TEST_F(TestCommandLineInterfaceRecording, FailedParsingIsRecordedWithError)
+{
+    char program_name[] = "program.exe";
+    char command[] = "comit";
+    char* argv[] = {program_name, command};
+
+    CommandLineInterface cli(2, argv);
+
+    AddInterface(cli);
+    cli.EnableRecording(log_path_);
+
+    EXPECT_THROW(cli.Parse(), UnsupportedCommand);
+    EXPECT_THROW(cli.Run(), UnsupportedCommand);
+
+    const std::vector<InvocationRecord> records = ReadRecords();
+
+    ASSERT_EQ(records.size(), 2U);
+
+    for (const InvocationRecord &record : records) {
+        EXPECT_EQ(record.outcome, InvocationOutcome::kFailed);
+        EXPECT_EQ(record.result.rfind("UnsupportedCommand: Command comit is not supported!", 0U), 0U);
+    }
+}
+
+TEST_F(TestCommandLineInterfaceRecording, HelpIsRecordedWithoutResult)
+{
+    char program_name[] = "program.exe";
+    char help[] = "--help";
+    char* argv[] = {program_name, help};
+    std::ostringstream stream {};
+
+    CommandLineInterface cli(2, argv);
+
+    AddInterface(cli);
+    cli.EnableRecording(log_path_);
+
+    {
+        OutputSink output(stream);
+
+        cli.Run(output);
+    }
+
+    const std::vector<InvocationRecord> records = ReadRecords();
+
+    ASSERT_EQ(records.size(), 1U);
+    EXPECT_EQ(records[0U].outcome, InvocationOutcome::kHelp);
+    EXPECT_TRUE(records[0U].result.empty());
+}
+
+TEST_F(TestCommandLineInterfaceRecording, SchemaHashChangesWithInterface)
+{
+    char program_name[] = "program.exe";
+    char commit[] = "commit";
+    char* argv[] = {program_name, commit};
+
+    CommandLineInterface cli(2, argv);
+
+    AddInterface(cli);
+    cli.EnableRecording(log_path_);
+    cli.Parse();
+    cli.AddFlag("--verbose", "Be verbose");
+    cli.Parse();
+
+    const std::vector<InvocationRecord> records = ReadRecords();
+
+    ASSERT_EQ(records.size(), 2U);
+    EXPECT_NE(records[0U].schema_hash, InvocationLog::GetSchemaHash({}, {}, {}, true, false, ""));
+    EXPECT_NE(records[0U].schema_hash, records[1U].schema_hash);
+}
+
+TEST_F(TestCommandLineInterfaceRecording, RecordingIsEnabledByEnvironmentVariable)
+{
+    char program_name[] = "program.exe";
+    char commit[] = "commit";
+    char* argv[] = {program_name, commit};
+
+    setenv(std::string(InvocationLog::kEnvironmentVariable).c_str(), log_path_.c_str(), 1);
+
+    CommandLineInterface cli(2, argv);
+
+    AddInterface(cli);
+    cli.Parse();
+
+    EXPECT_EQ(ReadRecords().size(), 1U);
+}
+
+TEST_F(TestCommandLineInterfaceRecording, RecordingIsDisabledByEmptyPath)
+{
+    char program_name[] = "program.exe";
+    char commit[] = "commit";
+    char* argv[] = {program_name, commit};
+
+    setenv(std::string(InvocationLog::kEnvironmentVariable).c_str(), log_path_.c_str(), 1);
+
+    CommandLineInterface cli(2, argv);
+
+    AddInterface(cli);
+    cli.EnableRecording("");
+    cli.Parse();
+
+    EXPECT_FALSE(std::filesystem::exists(log_path_));
+}
\ No newline at end of file
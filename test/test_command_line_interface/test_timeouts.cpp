@@ -0,0 +1,113 @@
+#include <chrono>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "comlint/command_line_interface.hpp"
+#include "comlint/exceptions/command_handler_failed.hpp"
+#include "comlint/exceptions/command_timed_out.hpp"
+#include "comlint/exceptions/unsupported_command.hpp"
+
+using namespace comlint;
+
+namespace {
+
+// polls the token until it's cancelled, as a handler of a long-running command should
+void WaitForCancellation(const CancellationToken &cancellation_token)
+{
+    for (unsigned int i = 0U; i < 10000U; i++) {
+        cancellation_token.ThrowIfCancelled();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+} // namespace
+
+TEST(TestCommandLineInterfaceTimeouts, HandlerExceedingTimeoutIsCancelled)
+{
+    char program_name[] = "program.exe";
+    char sync[] = "sync";
+    char* argv[] = {program_name, sync};
+
+    CommandLineInterface cli(2, argv);
+
+    cli.AddCommand("sync", "Synchronize repositories");
+    cli.SetTimeout("sync", std::chrono::milliseconds(20));
+    cli.AddCommandHandler("sync", [](const ParsedCommand&, OutputSink&, const CancellationToken &cancellation_token) {
+        WaitForCancellation(cancellation_token);
+    });
+
+    try {
+        cli.Run();
+        FAIL() << "Expected CommandTimedOut";
+    }
+    catch (const CommandTimedOut &exception) {
+        EXPECT_EQ(exception.GetCommandName(), "sync");
+        EXPECT_EQ(exception.GetTimeout(), std::chrono::milliseconds(20));
+        EXPECT_GE(exception.GetElapsedTime(), std::chrono::milliseconds(20));
+    }
+}
+
+TEST(TestCommandLineInterfaceTimeouts, HandlerFinishingInTimeIsNotCancelled)
+{
+    char program_name[] = "program.exe";
+    char sync[] = "sync";
+    char* argv[] = {program_name, sync};
+    bool was_cancelled = true;
+
+    CommandLineInterface cli(2, argv);
+
+    cli.AddCommand("sync", "Synchronize repositories");
+    cli.SetTimeout("sync", std::chrono::minutes(1));
+    cli.AddCommandHandler("sync", [&](const ParsedCommand&, OutputSink&, const CancellationToken &cancellation_token) {
+        was_cancelled = cancellation_token.IsCancelled();
+    });
+
+    EXPECT_NO_THROW(cli.Run());
+    EXPECT_FALSE(was_cancelled);
+}
+
+TEST(TestCommandLineInterfaceTimeouts, FailureOfHandlerInTimeIsPropagated)
+{
+    char program_name[] = "program.exe";
+    char sync[] = "sync";
+    char* argv[] = {program_name, sync};
+
+    CommandLineInterface cli(2, argv);
+
+    cli.AddCommand("sync", "Synchronize repositories");
+    cli.SetTimeout("sync", std::chrono::minutes(1));
+    cli.AddCommandHandler("sync", [](const ParsedCommand&) { throw std::runtime_error("no network"); });
+
+    EXPECT_THROW(cli.Run(), std::runtime_error);
+}
+
+TEST(TestCommandLineInterfaceTimeouts, TimeoutCoversAllFanOutInvocations)
+{
+    char program_name[] = "program.exe";
+    char sync[] = "sync";
+    char first[] = "first";
+    char second[] = "second";
+    char* argv[] = {program_name, sync, first, second};
+
+    CommandLineInterface cli(4, argv);
+
+    cli.AddCommand("sync", "Synchronize repositories", 2U);
+    cli.SetFanOut("sync");
+    cli.SetTimeout("sync", std::chrono::milliseconds(20));
+    cli.AddCommandHandler("sync", [](const ParsedCommand&, OutputSink&, const CancellationToken &cancellation_token) {
+        WaitForCancellation(cancellation_token);
+    });
+
+    EXPECT_THROW(cli.Run(), CommandTimedOut);
+}
+
+TEST(TestCommandLineInterfaceTimeouts, TimeoutOfUnknownCommandIsRejected)
+{
+    char program_name[] = "program.exe";
+    char* argv[] = {program_name};
+
+    CommandLineInterface cli(1, argv);
+
+    EXPECT_THROW(cli.SetTimeout("sync", std::chrono::seconds(1)), UnsupportedCommand);
+}
\ No newline at end of file
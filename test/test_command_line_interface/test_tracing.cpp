@@ -0,0 +1,145 @@
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+#include "comlint/command_line_interface.hpp"
+
+using namespace comlint;
+
+namespace {
+
+class TracedCommandHandler : public CommandHandlerInterface
+{
+public:
+    void Run(const ParsedCommand&) final
+    {
+        const TraceSpan span("handler work");
+    }
+};
+
+} // namespace
+
+class TestCommandLineInterfaceTracing : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+#ifdef _WIN32
+        _putenv_s(std::string(Tracer::kEnvironmentVariable).c_str(), trace_path_.c_str());
+#else
+        setenv(std::string(Tracer::kEnvironmentVariable).c_str(), trace_path_.c_str(), 1);
+#endif
+    }
+
+    void TearDown() override
+    {
+#ifdef _WIN32
+        _putenv_s(std::string(Tracer::kEnvironmentVariable).c_str(), "");
+#else
+        unsetenv(std::string(Tracer::kEnvironmentVariable).c_str());
+#endif
+        Tracer::Stop();
+        std::filesystem::remove(trace_path_);
+    }
+
+    std::string ReadTrace() const
+    {
+        std::ifstream trace_file(trace_path_);
+        std::stringstream trace {};
+
+        trace << trace_file.rdbuf();
+
+        return trace.str();
+    }
+
+    const std::string trace_path_ {(std::filesystem::temp_directory_path() / "comlint_test_tracing.json").string()};
+};
+
+TEST_F(TestCommandLineInterfaceTracing, WholeInvocationIsTraced)
+{
+    char program_name[] = "program.exe";
+    char open[] = "open";
+    char file[] = "file.txt";
+    char* argv[] = {program_name, open, file};
+
+    {
+        CommandLineInterface cli(3, argv);
+
+        cli.AddCommand("open", "Open file", 1U);
+        cli.AddOption("-mode", "Mode");
+        cli.AddOption("-encoding", "Encoding");
+        cli.AddCommandHandler("open", std::make_shared<TracedCommandHandler>());
+        cli.Run();
+    }
+
+    Tracer::Stop();
+    const std::string trace = ReadTrace();
+
+    for (const std::string span : {"CommandLineInterface", "AddCommand", "AddOption", "AddCommandHandler", "Compile", "Parse", "Tokenize",
+                                   "ParseCommand", "open", "handler work"}) {
+        EXPECT_NE(trace.find("\"name\":\"" + span + "\""), std::string::npos) << span;
+    }
+    EXPECT_EQ(trace.find("\"name\":\"RenderHelp\""), std::string::npos);
+}
+
+TEST_F(TestCommandLineInterfaceTracing, HelpIsRenderedOnlyWhenRequested)
+{
+    char program_name[] = "program.exe";
+    char help[] = "help";
+    char* argv[] = {program_name, help};
+    std::stringstream help_stream {};
+
+    {
+        CommandLineInterface cli(2, argv);
+        OutputSink output(help_stream);
+
+        cli.AddCommand("open", "Open file", 1U);
+        cli.Run(output);
+    }
+
+    Tracer::Stop();
+    const std::string trace = ReadTrace();
+
+    for (const std::string span : {"Compile", "Parse", "WriteHelp", "RenderHelp"}) {
+        EXPECT_NE(trace.find("\"name\":\"" + span + "\""), std::string::npos) << span;
+    }
+}
+
+TEST(TestCommandLineInterfaceTraceFlag, ReservedFlagStartsTracingOnConstructionAndIsSkippedByParsing)
+{
+    char program_name[] = "program.exe";
+    char open[] = "open";
+    char file[] = "file.txt";
+    char trace_flag[] = "--comlint-trace";
+    char* argv[] = {program_name, open, file, trace_flag};
+    const ParsedCommand expected_parsed_command("open", {"file.txt"}, {}, {});
+
+    EXPECT_FALSE(Tracer::IsEnabled());
+
+    {
+        CommandLineInterface cli(4, argv);
+
+        EXPECT_TRUE(Tracer::IsEnabled());
+
+        cli.AddCommand("open", "Open file", 1U);
+
+        EXPECT_EQ(cli.Parse(), expected_parsed_command);
+    }
+
+    Tracer::Stop();
+
+    std::ifstream trace_file(std::string(Tracer::kDefaultTracePath));
+    std::stringstream trace {};
+
+    trace << trace_file.rdbuf();
+    trace_file.close();
+
+    for (const std::string span : {"CommandLineInterface", "AddCommand", "Parse"}) {
+        EXPECT_NE(trace.str().find("\"name\":\"" + span + "\""), std::string::npos) << span;
+    }
+
+    EXPECT_TRUE(std::filesystem::remove(std::string(Tracer::kDefaultTracePath)));
+}
\ No newline at end of file
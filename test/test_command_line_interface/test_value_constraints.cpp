@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+
+#include "comlint/command_line_interface.hpp"
+#include "comlint/exceptions/forbidden_option_value.hpp"
+#include "comlint/exceptions/invalid_default_option_value.hpp"
+#include "comlint/exceptions/unsupported_command.hpp"
+#include "comlint/exceptions/unsupported_command_value.hpp"
+
+using namespace comlint;
+
+TEST(TestCommandLineInterfaceValueConstraints, OptionValueSatisfyingConstraintIsAccepted)
+{
+    const int argc = 4;
+    char program_name[] = "program.exe";
+    char serve[] = "serve";
+    char option[] = "-port";
+    char option_value[] = "8080";
+    char* argv[] = {program_name, serve, option, option_value};
+    const ParsedCommand expected_parsed_command("serve", {}, {{"-port", "8080"}}, {});
+
+    CommandLineInterface cli(argc, argv);
+
+    cli.AddCommand("serve", "Start the server", {"-port"});
+    cli.AddOption("-port", "Port to listen on");
+    cli.SetValueConstraint("-port", ValueConstraint::Range(1, 65535));
+
+    EXPECT_EQ(cli.Parse(), expected_parsed_command);
+}
+
+TEST(TestCommandLineInterfaceValueConstraints, OptionValueViolatingConstraintIsForbidden)
+{
+    const int argc = 4;
+    char program_name[] = "program.exe";
+    char serve[] = "serve";
+    char option[] = "-port";
+    char option_value[] = "70000";
+    char* argv[] = {program_name, serve, option, option_value};
+
+    CommandLineInterface cli(argc, argv);
+
+    cli.AddCommand("serve", "Start the server", {"-port"});
+    cli.AddOption("-port", "Port to listen on");
+    cli.SetValueConstraint("-port", ValueConstraint::Range(1, 65535));
+
+    EXPECT_THROW(cli.Parse(), ForbiddenOptionValue);
+}
+
+TEST(TestCommandLineInterfaceValueConstraints, CommandValueMustSatisfyConstraint)
+{
+    const int argc = 3;
+    char program_name[] = "program.exe";
+    char checkout[] = "checkout";
+    char valid_branch[] = "feature/value-constraints";
+    char invalid_branch[] = "feature//broken";
+    char* valid_argv[] = {program_name, checkout, valid_branch};
+    char* invalid_argv[] = {program_name, checkout, invalid_branch};
+
+    CommandLineInterface valid_cli(argc, valid_argv);
+    CommandLineInterface invalid_cli(argc, invalid_argv);
+
+    for (CommandLineInterface *cli : {&valid_cli, &invalid_cli}) {
+        cli->AddCommand("checkout", "Switch branches", 1U, ANY);
+        cli->SetValueConstraint("checkout", ValueConstraint::Pattern("[a-z0-9-]+(/[a-z0-9-]+)*"));
+    }
+
+    EXPECT_NO_THROW(valid_cli.Parse());
+    EXPECT_THROW(invalid_cli.Parse(), UnsupportedCommandValue);
+}
+
+TEST(TestCommandLineInterfaceValueConstraints, HelpShowsConstraint)
+{
+    const int argc = 2;
+    char program_name[] = "program.exe";
+    char help[] = "help";
+    char* argv[] = {program_name, help};
+
+    CommandLineInterface cli(argc, argv);
+
+    cli.AddOption("-port", "Port to listen on");
+    cli.SetValueConstraint("-port", ValueConstraint::Range(1, 65535));
+
+    testing::internal::CaptureStdout();
+    cli.Parse();
+    const std::string help_prompt = testing::internal::GetCapturedStdout();
+
+    EXPECT_NE(help_prompt.find("integer in range [1, 65535]"), std::string::npos);
+}
+
+TEST(TestCommandLineInterfaceValueConstraints, InvalidConstraintsAreRejected)
+{
+    const int argc = 1;
+    char program_name[] = "program.exe";
+    char* argv[] = {program_name};
+
+    CommandLineInterface cli(argc, argv);
+
+    cli.AddOption("-port", "Port to listen on", ANY, "", "http");
+
+    EXPECT_THROW(cli.SetValueConstraint("serve", ValueConstraint::Range(1, 65535)), UnsupportedCommand);
+    EXPECT_THROW(cli.SetValueConstraint("-port", ValueConstraint::Range(1, 65535)), InvalidDefaultOptionValue);
+    EXPECT_NO_THROW(cli.SetValueConstraint("-port", ValueConstraint::Pattern("[a-z]+|\\d+")));
+}
\ No newline at end of file
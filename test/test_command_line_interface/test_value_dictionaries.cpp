@@ -0,0 +1,147 @@
+#include <filesystem>
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+#include "comlint/command_line_interface.hpp"
+#include "comlint/exceptions/forbidden_option_value.hpp"
+#include "comlint/exceptions/invalid_default_option_value.hpp"
+#include "comlint/exceptions/invalid_value_dictionary.hpp"
+#include "comlint/exceptions/unsupported_command.hpp"
+#include "comlint/exceptions/unsupported_command_value.hpp"
+#include "comlint/exceptions/unsupported_option.hpp"
+
+using namespace comlint;
+
+class TestCommandLineInterfaceValueDictionaries : public ::testing::Test
+{
+protected:
+    std::string CreateDictionary(const std::string &content)
+    {
+        std::ofstream file(path_, std::ios::binary);
+
+        file << content;
+
+        return path_.string();
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove(path_);
+    }
+
+private:
+    const std::filesystem::path path_ {std::filesystem::temp_directory_path() / "comlint_test_value_dictionaries.txt"};
+};
+
+TEST_F(TestCommandLineInterfaceValueDictionaries, OptionValueFromDictionaryIsAccepted)
+{
+    const int argc = 4;
+    char program_name[] = "program.exe";
+    char deploy[] = "deploy";
+    char option[] = "-tenant";
+    char option_value[] = "globex";
+    char* argv[] = {program_name, deploy, option, option_value};
+    const ParsedCommand expected_parsed_command("deploy", {}, {{"-tenant", "globex"}}, {});
+
+    CommandLineInterface cli(argc, argv);
+
+    cli.AddCommand("deploy", "Deploy the service", {"-tenant"});
+    cli.AddOption("-tenant", "Tenant to deploy for");
+    cli.SetAllowedValuesDictionary("-tenant", CreateDictionary("acme\nglobex\ninitech\n"));
+
+    EXPECT_EQ(cli.Parse(), expected_parsed_command);
+}
+
+TEST_F(TestCommandLineInterfaceValueDictionaries, OptionValueNotInDictionaryIsForbidden)
+{
+    const int argc = 4;
+    char program_name[] = "program.exe";
+    char deploy[] = "deploy";
+    char option[] = "-tenant";
+    char option_value[] = "acm";
+    char* argv[] = {program_name, deploy, option, option_value};
+
+    CommandLineInterface cli(argc, argv);
+
+    cli.AddCommand("deploy", "Deploy the service", {"-tenant"});
+    cli.AddOption("-tenant", "Tenant to deploy for");
+    cli.SetAllowedValuesDictionary("-tenant", CreateDictionary("acme\nglobex\ninitech\n"));
+
+    try {
+        cli.Parse();
+        FAIL() << "ForbiddenOptionValue was not thrown";
+    }
+    catch (const ForbiddenOptionValue &exception) {
+        EXPECT_NE(std::string(exception.what()).find("acme"), std::string::npos);
+    }
+}
+
+TEST_F(TestCommandLineInterfaceValueDictionaries, CommandValueIsCheckedAgainstListAndDictionary)
+{
+    const int argc = 3;
+    char program_name[] = "program.exe";
+    char install[] = "install";
+    char listed_value[] = "local_package";
+    char dictionary_value[] = "libfoo";
+    char unknown_value[] = "libbaz";
+    char* listed_argv[] = {program_name, install, listed_value};
+    char* dictionary_argv[] = {program_name, install, dictionary_value};
+    char* unknown_argv[] = {program_name, install, unknown_value};
+    const std::string dictionary_path = CreateDictionary("libbar\nlibfoo\n");
+
+    for (char** argv : {listed_argv, dictionary_argv}) {
+        CommandLineInterface cli(argc, argv);
+
+        cli.AddCommand("install", "Install package", 1U, {"local_package"});
+        cli.SetAllowedValuesDictionary("install", dictionary_path);
+
+        EXPECT_NO_THROW(cli.Parse());
+    }
+
+    CommandLineInterface cli(argc, unknown_argv);
+
+    cli.AddCommand("install", "Install package", 1U, {"local_package"});
+    cli.SetAllowedValuesDictionary("install", dictionary_path);
+
+    EXPECT_THROW(cli.Parse(), UnsupportedCommandValue);
+}
+
+TEST_F(TestCommandLineInterfaceValueDictionaries, HelpShowsSummaryOfDictionary)
+{
+    const int argc = 2;
+    char program_name[] = "program.exe";
+    char help[] = "help";
+    char* argv[] = {program_name, help};
+    const std::string dictionary_path = CreateDictionary("acme\nglobex\ninitech\n");
+
+    CommandLineInterface cli(argc, argv);
+
+    cli.AddOption("-tenant", "Tenant to deploy for");
+    cli.SetAllowedValuesDictionary("-tenant", dictionary_path);
+
+    testing::internal::CaptureStdout();
+    cli.Parse();
+    const std::string help_prompt = testing::internal::GetCapturedStdout();
+
+    EXPECT_NE(help_prompt.find("one of 3 values listed in " + dictionary_path), std::string::npos);
+    EXPECT_EQ(help_prompt.find("globex"), std::string::npos);
+}
+
+TEST_F(TestCommandLineInterfaceValueDictionaries, InvalidDictionariesAreRejected)
+{
+    const int argc = 1;
+    char program_name[] = "program.exe";
+    char* argv[] = {program_name};
+
+    CommandLineInterface cli(argc, argv);
+
+    cli.AddCommand("deploy", "Deploy the service", {"-tenant"});
+    cli.AddOption("-tenant", "Tenant to deploy for", ANY, "", "default_tenant");
+
+    EXPECT_THROW(cli.SetAllowedValuesDictionary("undo", CreateDictionary("acme\n")), UnsupportedCommand);
+    EXPECT_THROW(cli.SetAllowedValuesDictionary("-region", CreateDictionary("acme\n")), UnsupportedOption);
+    EXPECT_THROW(cli.SetAllowedValuesDictionary("deploy", "/not/existing/dictionary.txt"), InvalidValueDictionary);
+    EXPECT_THROW(cli.SetAllowedValuesDictionary("-tenant", CreateDictionary("acme\n")), InvalidDefaultOptionValue);
+    EXPECT_NO_THROW(cli.SetAllowedValuesDictionary("-tenant", CreateDictionary("acme\ndefault_tenant\n")));
+}
\ No newline at end of file
@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+
+#include "comlint/command_line_tokenizer.hpp"
+
+using namespace comlint;
+
+TEST(TestCommandLineTokenizer, GetElementTypeReturnsCommandOnlyOnCommandPosition)
+{
+    EXPECT_EQ(CommandLineTokenizer::GetElementType("a", true), CommandLineElementType::kCommand);
+    EXPECT_EQ(CommandLineTokenizer::GetElementType("some-command", true), CommandLineElementType::kCommand);
+    EXPECT_EQ(CommandLineTokenizer::GetElementType("some-command", false), CommandLineElementType::kCustomValue);
+}
+
+TEST(TestCommandLineTokenizer, GetElementTypeReturnsOption)
+{
+    EXPECT_EQ(CommandLineTokenizer::GetElementType("-o", true), CommandLineElementType::kOption);
+    EXPECT_EQ(CommandLineTokenizer::GetElementType("-option", false), CommandLineElementType::kOption);
+    EXPECT_EQ(CommandLineTokenizer::GetElementType("-some--option", false), CommandLineElementType::kOption);
+}
+
+TEST(TestCommandLineTokenizer, GetElementTypeReturnsFlag)
+{
+    EXPECT_EQ(CommandLineTokenizer::GetElementType("--f", true), CommandLineElementType::kFlag);
+    EXPECT_EQ(CommandLineTokenizer::GetElementType("--flag", false), CommandLineElementType::kFlag);
+    EXPECT_EQ(CommandLineTokenizer::GetElementType("---flag", false), CommandLineElementType::kFlag);
+}
+
+TEST(TestCommandLineTokenizer, GetElementTypeReturnsCustomValueForIncompletePrefixes)
+{
+    EXPECT_EQ(CommandLineTokenizer::GetElementType("", true), CommandLineElementType::kCustomValue);
+    EXPECT_EQ(CommandLineTokenizer::GetElementType("-", true), CommandLineElementType::kCustomValue);
+    EXPECT_EQ(CommandLineTokenizer::GetElementType("--", true), CommandLineElementType::kCustomValue);
+}
+
+TEST(TestCommandLineTokenizer, GetElementTypeDoesNotReadBeyondViewSize)
+{
+    const std::string_view element("--flag", 2U);
+
+    EXPECT_EQ(CommandLineTokenizer::GetElementType(element, false), CommandLineElementType::kCustomValue);
+}
+
+TEST(TestCommandLineTokenizer, TokenizeClassifiesAllElements)
+{
+    const unsigned int argc = 8U;
+    char program_name[] = "program.exe";
+    char command[] = "command";
+    char command_value[] = "value";
+    char option[] = "-o";
+    char option_value[] = "-";
+    char flag[] = "--flag";
+    char empty_value[] = "";
+    char dashes[] = "--";
+    char* argv[] = {program_name, command, command_value, option, option_value, flag, empty_value, dashes};
+    const std::array<CommandLineElementType, argc> expected_tokens {CommandLineElementType::kCustomValue, CommandLineElementType::kCommand,
+                                                                    CommandLineElementType::kCustomValue, CommandLineElementType::kOption,
+                                                                    CommandLineElementType::kCustomValue, CommandLineElementType::kFlag,
+                                                                    CommandLineElementType::kCustomValue, CommandLineElementType::kCustomValue};
+
+    const CommandLineTokens tokens = CommandLineTokenizer::Tokenize(argc, argv);
+
+    ASSERT_EQ(tokens.size(), expected_tokens.size());
+    EXPECT_TRUE(std::equal(tokens.begin(), tokens.end(), expected_tokens.begin()));
+}
+
+TEST(TestCommandLineTokenizer, TokenizeReturnsOnlyProgramNameToken)
+{
+    char program_name[] = "program.exe";
+    char* argv[] = {program_name};
+
+    const CommandLineTokens tokens = CommandLineTokenizer::Tokenize(1U, argv);
+
+    ASSERT_EQ(tokens.size(), 1U);
+    EXPECT_EQ(tokens.front(), CommandLineElementType::kCustomValue);
+}
\ No newline at end of file
@@ -0,0 +1,188 @@
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "comlint/command_line_interface.hpp"
+#include "comlint/compiled_interface.hpp"
+#include "comlint/exceptions/unsupported_option.hpp"
+#include "comlint/exceptions/forbidden_option.hpp"
+#include "comlint/exceptions/forbidden_flag.hpp"
+#include "comlint/exceptions/missing_required_option.hpp"
+
+using namespace comlint;
+
+namespace {
+
+CompiledInterface CompileTestInterface(const OptionNames &required_options = {"-m"})
+{
+    char program_name[] = "program.exe";
+    char* argv[] = {program_name};
+    CommandLineInterface cli(1, argv);
+
+    cli.AddCommand("commit", "Record changes", {"-m", "-a"}, {"--amend", "--undeclared"}, required_options);
+    cli.AddCommand("add", "Add files", 1U, ANY, {"-a"});
+    cli.AddOption("-m", "Commit message");
+    cli.AddOption("-a", "Author", {"alice", "bob"});
+    cli.AddFlag("--amend", "Amend previous commit");
+    cli.AddFlag("--verbose", "Verbose output");
+
+    return cli.Compile();
+}
+
+} // namespace
+
+TEST(TestCompiledInterface, ParseReturnsSameResultAsCommandLineInterface)
+{
+    const int argc = 5;
+    char program_name[] = "program.exe";
+    char commit[] = "commit";
+    char m[] = "-m";
+    char message[] = "message";
+    char amend[] = "--amend";
+    char* argv[] = {program_name, commit, m, message, amend};
+    const ParsedCommand expected_parsed_command("commit", {}, {{"-m", "message"}}, {{"--amend", true}, {"--verbose", false}});
+    const CompiledInterface compiled_interface = CompileTestInterface();
+
+    const ParsedCommand parsed_command = compiled_interface.Parse(argc, argv);
+
+    EXPECT_EQ(parsed_command, expected_parsed_command);
+}
+
+TEST(TestCompiledInterface, ParseAllocatesResultFromGivenMemoryResource)
+{
+    const int argc = 3;
+    char program_name[] = "program.exe";
+    char add[] = "add";
+    char file[] = "file.txt";
+    char* argv[] = {program_name, add, file};
+    std::pmr::monotonic_buffer_resource memory_resource {};
+    const CompiledInterface compiled_interface = CompileTestInterface();
+
+    const pmr::ParsedCommand parsed_command = compiled_interface.Parse(argc, argv, &memory_resource);
+
+    EXPECT_EQ(parsed_command.get_allocator().resource(), &memory_resource);
+    EXPECT_EQ(std::string_view(parsed_command.name), "add");
+    ASSERT_EQ(parsed_command.values.size(), 1U);
+    EXPECT_EQ(std::string_view(parsed_command.values.front()), "file.txt");
+}
+
+TEST(TestCompiledInterface, CompiledInterfaceIsNotAffectedByLaterChangesOfInterface)
+{
+    const int argc = 4;
+    char program_name[] = "program.exe";
+    char commit[] = "commit";
+    char x[] = "-x";
+    char value[] = "value";
+    char* argv[] = {program_name, commit, x, value};
+    CommandLineInterface cli(argc, argv);
+
+    cli.AddCommand("commit", "Record changes", {"-x"});
+
+    const CompiledInterface compiled_interface = cli.Compile();
+
+    cli.AddOption("-x", "Some option");
+
+    EXPECT_THROW(compiled_interface.Parse(argc, argv), UnsupportedOption);
+    EXPECT_NO_THROW(cli.Parse());
+}
+
+TEST(TestCompiledInterface, HelpIsNotAffectedByLaterChangesOfInterface)
+{
+    const int argc = 2;
+    char program_name[] = "program.exe";
+    char help[] = "help";
+    char* argv[] = {program_name, help};
+    CommandLineInterface cli(argc, argv);
+    std::stringstream help_stream {};
+
+    cli.AddCommand("commit", "Record changes");
+
+    const CompiledInterface compiled_interface = cli.Compile();
+
+    cli.AddCommand("push", "Update remote refs");
+    {
+        OutputSink output(help_stream);
+        compiled_interface.Parse(argc, argv, output);
+    }
+
+    EXPECT_NE(help_stream.str().find("Record changes"), std::string::npos);
+    EXPECT_EQ(help_stream.str().find("Update remote refs"), std::string::npos);
+}
+
+TEST(TestCompiledInterface, ParseThrowsForbiddenOptionForOptionNotAllowedForCommand)
+{
+    const int argc = 5;
+    char program_name[] = "program.exe";
+    char add[] = "add";
+    char file[] = "file.txt";
+    char m[] = "-m";
+    char message[] = "message";
+    char* argv[] = {program_name, add, file, m, message};
+    const CompiledInterface compiled_interface = CompileTestInterface();
+
+    EXPECT_THROW(compiled_interface.Parse(argc, argv), ForbiddenOption);
+}
+
+TEST(TestCompiledInterface, ParseThrowsForbiddenFlagForFlagNotAllowedForCommand)
+{
+    const int argc = 5;
+    char program_name[] = "program.exe";
+    char commit[] = "commit";
+    char m[] = "-m";
+    char message[] = "message";
+    char verbose[] = "--verbose";
+    char* argv[] = {program_name, commit, m, message, verbose};
+    const CompiledInterface compiled_interface = CompileTestInterface();
+
+    EXPECT_THROW(compiled_interface.Parse(argc, argv), ForbiddenFlag);
+}
+
+TEST(TestCompiledInterface, ParseThrowsMissingRequiredOptionForUndeclaredRequiredOption)
+{
+    const int argc = 4;
+    char program_name[] = "program.exe";
+    char commit[] = "commit";
+    char m[] = "-m";
+    char message[] = "message";
+    char* argv[] = {program_name, commit, m, message};
+    const CompiledInterface compiled_interface = CompileTestInterface({"-m", "-undeclared"});
+
+    EXPECT_THROW(compiled_interface.Parse(argc, argv), MissingRequiredOption);
+}
+
+TEST(TestCompiledInterface, ParseMayBeCalledConcurrently)
+{
+    const unsigned int num_of_threads {8U};
+    const unsigned int num_of_iterations {500U};
+    const CompiledInterface compiled_interface = CompileTestInterface();
+    const ParsedCommand expected_parsed_command("commit", {}, {{"-m", "message"}, {"-a", "bob"}}, {{"--amend", false}, {"--verbose", false}});
+    std::vector<std::thread> threads {};
+    std::vector<unsigned int> num_of_matches(num_of_threads, 0U);
+
+    for (unsigned int i=0U; i<num_of_threads; i++) {
+        threads.emplace_back([&compiled_interface, &expected_parsed_command, &num_of_matches, i]() {
+            char program_name[] = "program.exe";
+            char commit[] = "commit";
+            char a[] = "-a";
+            char bob[] = "bob";
+            char m[] = "-m";
+            char message[] = "message";
+            char* argv[] = {program_name, commit, a, bob, m, message};
+
+            for (unsigned int j=0U; j<num_of_iterations; j++) {
+                if (compiled_interface.Parse(6, argv) == expected_parsed_command) {
+                    num_of_matches[i]++;
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    for (const unsigned int matches : num_of_matches) {
+        EXPECT_EQ(matches, num_of_iterations);
+    }
+}
\ No newline at end of file
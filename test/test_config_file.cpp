@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+
+#include "comlint/config_file.hpp"
+#include "comlint/exceptions/invalid_config_file.hpp"
+
+using namespace comlint;
+
+TEST(TestConfigFile, GetSectionEntriesReturnsEntriesOfGivenSection)
+{
+    const std::string_view content = "[commit]\n"
+                                     "-m = some message\n"
+                                     "-c=abc123\n"
+                                     "[merge]\n"
+                                     "-s = recursive\n";
+    const ConfigEntries expected_entries {{"-m", "some message"}, {"-c", "abc123"}};
+
+    EXPECT_EQ(ConfigFile::GetSectionEntries(content, "commit"), expected_entries);
+}
+
+TEST(TestConfigFile, GetSectionEntriesReturnsEntriesBeforeFirstSectionForEmptySectionName)
+{
+    const std::string_view content = "-option = value\n"
+                                     "[command]\n"
+                                     "-option = other_value\n";
+    const ConfigEntries expected_entries {{"-option", "value"}};
+
+    EXPECT_EQ(ConfigFile::GetSectionEntries(content, ""), expected_entries);
+}
+
+TEST(TestConfigFile, GetSectionEntriesMergesRepeatedSections)
+{
+    const std::string_view content = "[command]\n"
+                                     "-option_1 = value_1\n"
+                                     "[other_command]\n"
+                                     "-option_2 = value_2\n"
+                                     "[command]\n"
+                                     "-option_1 = value_3\n";
+    const ConfigEntries expected_entries {{"-option_1", "value_1"}, {"-option_1", "value_3"}};
+
+    EXPECT_EQ(ConfigFile::GetSectionEntries(content, "command"), expected_entries);
+}
+
+TEST(TestConfigFile, GetSectionEntriesSkipsCommentsAndEmptyLines)
+{
+    const std::string_view content = "  [ command ]  \r\n"
+                                     "# some comment\r\n"
+                                     "\r\n"
+                                     "; other comment\r\n"
+                                     "\t-option = \"quoted value\"\r\n";
+    const ConfigEntries expected_entries {{"-option", "quoted value"}};
+
+    EXPECT_EQ(ConfigFile::GetSectionEntries(content, "command"), expected_entries);
+}
+
+TEST(TestConfigFile, GetSectionEntriesReturnsNothingForMissingSection)
+{
+    const std::string_view content = "[command]\n"
+                                     "-option = value\n";
+
+    EXPECT_TRUE(ConfigFile::GetSectionEntries(content, "other_command").empty());
+}
+
+TEST(TestConfigFile, GetSectionEntriesThrowsForInvalidLineInGivenSection)
+{
+    const std::string_view content = "[command]\n"
+                                     "-option value\n";
+
+    EXPECT_THROW(ConfigFile::GetSectionEntries(content, "command"), InvalidConfigFile);
+}
+
+TEST(TestConfigFile, GetSectionEntriesIgnoresInvalidLinesInOtherSections)
+{
+    const std::string_view content = "[other_command]\n"
+                                     "-option value\n"
+                                     "[command]\n"
+                                     "-option = value\n";
+    const ConfigEntries expected_entries {{"-option", "value"}};
+
+    EXPECT_EQ(ConfigFile::GetSectionEntries(content, "command"), expected_entries);
+}
+
+TEST(TestConfigFile, GetSectionsReturnsEntriesOfAllSectionsInOrderOfAppearance)
+{
+    const std::string_view content = "-option = value\n"
+                                     "[merge]\n"
+                                     "-s = recursive\n"
+                                     "  [ commit ]  \n"
+                                     "# [comment]\n"
+                                     "-m = \"message\"\n"
+                                     "[merge]\n"
+                                     "-m = merged\n";
+    const ConfigSections sections = ConfigFile::GetSections(content);
+
+    ASSERT_EQ(sections.size(), 3U);
+    EXPECT_EQ(sections[0U].first, "");
+    EXPECT_EQ(sections[0U].second, ConfigEntries({{"-option", "value"}}));
+    EXPECT_EQ(sections[1U].first, "merge");
+    EXPECT_EQ(sections[1U].second, ConfigEntries({{"-s", "recursive"}, {"-m", "merged"}}));
+    EXPECT_EQ(sections[2U].first, "commit");
+    EXPECT_EQ(sections[2U].second, ConfigEntries({{"-m", "message"}}));
+}
+
+TEST(TestConfigFile, GetSectionsReturnsOnlyUnnamedSectionForContentWithoutSections)
+{
+    const ConfigSections sections = ConfigFile::GetSections("-option = value\n");
+
+    ASSERT_EQ(sections.size(), 1U);
+    EXPECT_EQ(sections[0U].first, "");
+    EXPECT_EQ(sections[0U].second, ConfigEntries({{"-option", "value"}}));
+}
+
+TEST(TestConfigFile, GetSectionsThrowsForInvalidLineInAnySection)
+{
+    EXPECT_THROW(ConfigFile::GetSections("[merge]\n-s = recursive\n[commit]\ninvalid line\n"), InvalidConfigFile);
+}
\ No newline at end of file
@@ -0,0 +1,49 @@
+#include <gtest/gtest.h>
+
+#include "comlint/environment_variables.hpp"
+
+using namespace comlint;
+
+TEST(TestEnvironmentVariables, ConstructorDoesNotThrowForNullEnvironment)
+{
+    EXPECT_NO_THROW(EnvironmentVariables(nullptr));
+}
+
+TEST(TestEnvironmentVariables, ConstructorDoesNotThrowForProcessEnvironment)
+{
+    EXPECT_NO_THROW(EnvironmentVariables(EnvironmentVariables::GetProcessEnvironment()));
+}
+
+TEST(TestEnvironmentVariables, GetReturnsValueOfExistingVariable)
+{
+    char variable_1[] = "VARIABLE_1=value_1";
+    char variable_2[] = "VARIABLE_2=value=with=separators";
+    char variable_3[] = "VARIABLE_3=";
+    char* environment[] = {variable_1, variable_2, variable_3, nullptr};
+    const EnvironmentVariables environment_variables(environment);
+
+    EXPECT_EQ(environment_variables.Get("VARIABLE_1"), "value_1");
+    EXPECT_EQ(environment_variables.Get("VARIABLE_2"), "value=with=separators");
+    EXPECT_EQ(environment_variables.Get("VARIABLE_3"), "");
+}
+
+TEST(TestEnvironmentVariables, GetReturnsNothingForMissingVariable)
+{
+    char variable_1[] = "VARIABLE_1=value_1";
+    char* environment[] = {variable_1, nullptr};
+    const EnvironmentVariables environment_variables(environment);
+
+    EXPECT_FALSE(environment_variables.Get("VARIABLE").has_value());
+    EXPECT_FALSE(environment_variables.Get("VARIABLE_2").has_value());
+}
+
+TEST(TestEnvironmentVariables, GetIgnoresEntriesWithoutName)
+{
+    char variable_1[] = "=C:=C:\\some\\path";
+    char variable_2[] = "NO_SEPARATOR";
+    char* environment[] = {variable_1, variable_2, nullptr};
+    const EnvironmentVariables environment_variables(environment);
+
+    EXPECT_FALSE(environment_variables.Get("").has_value());
+    EXPECT_FALSE(environment_variables.Get("NO_SEPARATOR").has_value());
+}
\ No newline at end of file
@@ -0,0 +1,71 @@
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "comlint/function_command_handler.hpp"
+
+using namespace comlint;
+
+TEST(TestFunctionCommandHandler, FunctionTakingCommandIsCalledByBothOverloads)
+{
+    unsigned int num_of_calls = 0U;
+    const ParsedCommand parsed_command("add", {"file.txt"}, {}, {});
+    std::ostringstream stream {};
+    OutputSink output(stream);
+    FunctionCommandHandler handler([&](const ParsedCommand &command) {
+        EXPECT_EQ(command, parsed_command);
+        num_of_calls++;
+    });
+
+    handler.Run(parsed_command);
+    handler.Run(parsed_command, output);
+
+    EXPECT_EQ(num_of_calls, 2U);
+}
+
+TEST(TestFunctionCommandHandler, FunctionTakingOutputWritesToGivenSink)
+{
+    std::ostringstream stream {};
+    FunctionCommandHandler handler([](const ParsedCommand &command, OutputSink &output) {
+        output << "Running " << std::string_view(command.name) << '\n';
+    });
+
+    {
+        OutputSink output(stream);
+
+        handler.Run(ParsedCommand("commit", {}, {}, {}), output);
+    }
+
+    EXPECT_EQ(stream.str(), "Running commit\n");
+}
+
+TEST(TestFunctionCommandHandler, FunctionTakingTokenGetsTokenOfTheRun)
+{
+    std::ostringstream stream {};
+    OutputSink output(stream);
+    CancellationToken cancellation_token {};
+    bool was_cancelled = false;
+    FunctionCommandHandler handler([&](const ParsedCommand&, OutputSink&, const CancellationToken &token) {
+        was_cancelled = token.IsCancelled();
+    });
+
+    cancellation_token.Cancel();
+    handler.Run(ParsedCommand("sync", {}, {}, {}), output, cancellation_token);
+
+    EXPECT_TRUE(was_cancelled);
+}
+
+TEST(TestFunctionCommandHandler, OnlyCallablesTakingParsedCommandAreHandlerFunctions)
+{
+    const auto command_function = [](const ParsedCommand&) {};
+    const auto output_function = [](const ParsedCommand&, OutputSink&) {};
+    const auto factory = []() { return CommandHandlerPtr{}; };
+
+    EXPECT_TRUE(kIsCommandHandlerFunction<decltype(command_function)>);
+    EXPECT_TRUE(kIsCommandHandlerFunction<decltype(output_function)>);
+    EXPECT_FALSE(kIsCommandHandlerFunction<decltype(factory)>);
+    EXPECT_FALSE(kIsCommandHandlerFunction<CommandHandlerPtr>);
+    EXPECT_FALSE(kIsCommandHandlerFunction<std::nullptr_t>);
+}
\ No newline at end of file
@@ -0,0 +1,193 @@
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <variant>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "comlint/command_line_interface.hpp"
+#include "comlint/interface_schema.hpp"
+#include "comlint/mapped_file.hpp"
+#include "differential_schema_parser.hpp"
+#include "mock_command_handler.hpp"
+
+using namespace comlint;
+
+namespace {
+
+using Parser = generated::differential_schema::Parser;
+using Command = generated::differential_schema::Command;
+// result of parsing: either parsed command together with the written output, or message of the thrown exception
+using ParsingResult = std::variant<std::pair<ParsedCommand, std::string>, std::string>;
+
+std::vector<std::string> ToVector(const std::pmr::vector<std::pmr::string> &strings)
+{
+    return std::vector<std::string>(strings.begin(), strings.end());
+}
+
+/**
+ * @brief Differential test comparing the generated parser with CommandLineInterface declared with the same schema.
+ */
+class TestGeneratedParser : public testing::Test
+{
+protected:
+    void TearDown() override
+    {
+        unsetenv("COMLINT_DIFFERENTIAL_AUTHOR");
+        unsetenv("COMLINT_DIFFERENTIAL_REMOTE");
+    }
+
+    static CompiledInterface CompileInterface(const int argc, char** argv)
+    {
+        const MappedFile schema_file(std::string(COMLINT_TEST_SCHEMAS_DIR) + "/differential_schema.ini");
+        const InterfaceSchema schema = InterfaceSchema::Parse(schema_file.GetContent());
+        CommandLineInterface cli(argc, argv, std::string(schema.program_name), std::string(schema.description));
+
+        for (const auto &[command_name, command] : schema.commands) {
+            cli.AddCommand(std::string(command_name), std::string(command.description), command.num_of_required_values,
+                           ToVector(command.allowed_values), ToVector(command.allowed_options), ToVector(command.allowed_flags),
+                           ToVector(command.required_options));
+        }
+        for (const auto &[option_name, option] : schema.options) {
+            cli.AddOption(std::string(option_name), std::string(option.description), ToVector(option.allowed_values),
+                          std::string(option.environment_variable), std::string(option.default_value));
+        }
+        for (const auto &[flag_name, flag] : schema.flags) {
+            cli.AddFlag(std::string(flag_name), std::string(flag.description));
+        }
+
+        return cli.Compile();
+    }
+
+    template <typename ParseFunction>
+    static ParsingResult GetResult(const ParseFunction &parse)
+    {
+        std::ostringstream stream {};
+
+        try {
+            ParsedCommand parsed_command {};
+
+            {
+                OutputSink output(stream);
+                parsed_command = parse(output);
+            }
+
+            return std::make_pair(parsed_command, stream.str());
+        }
+        catch (const std::exception &exception) {
+            return std::string(exception.what());
+        }
+    }
+
+    static void ExpectSameResults(std::vector<std::string> arguments)
+    {
+        std::vector<char*> argv {};
+
+        arguments.insert(arguments.begin(), "vcs");
+
+        for (auto &argument : arguments) {
+            argv.push_back(argument.data());
+        }
+
+        const int argc = static_cast<int>(argv.size());
+        const CompiledInterface compiled_interface = CompileInterface(argc, argv.data());
+        const ParsingResult expected_result = GetResult([&](OutputSink &output) { return compiled_interface.Parse(argc, argv.data(), output); });
+        const ParsingResult result = GetResult([&](OutputSink &output) { return Parser::Parse(argc, argv.data(), output); });
+
+        ASSERT_EQ(result.index(), expected_result.index()) << "Results differ for " << testing::PrintToString(arguments);
+
+        if (std::holds_alternative<std::string>(expected_result)) {
+            EXPECT_EQ(std::get<std::string>(result), std::get<std::string>(expected_result));
+        } else {
+            EXPECT_EQ(std::get<0U>(result).first, std::get<0U>(expected_result).first) << testing::PrintToString(arguments);
+            EXPECT_EQ(std::get<0U>(result).second, std::get<0U>(expected_result).second) << testing::PrintToString(arguments);
+        }
+    }
+};
+
+} // namespace
+
+TEST_F(TestGeneratedParser, ValidCommandLinesAreParsedInTheSameWay)
+{
+    ExpectSameResults({});
+    ExpectSameResults({"status"});
+    ExpectSameResults({"add", "a.txt", "b.txt", "--force", "--verbose"});
+    ExpectSameResults({"add", "a.txt", "b.txt", "--force", "--force"});
+    ExpectSameResults({"checkout", "develop", "-b", "feature"});
+    ExpectSameResults({"commit", "-m", "message", "--amend"});
+    ExpectSameResults({"commit", "-m", "first", "-m", "second", "-a", "bob"});
+    ExpectSameResults({"publish", "-r", "origin", "-undeclared", "value"});
+    ExpectSameResults({"-verbosity", "high", "--verbose"});
+    ExpectSameResults({"-m", "message"});
+}
+
+TEST_F(TestGeneratedParser, HelpIsWrittenInTheSameWay)
+{
+    ExpectSameResults({"help"});
+    ExpectSameResults({"-h"});
+    ExpectSameResults({"--help", "status"});
+}
+
+TEST_F(TestGeneratedParser, InvalidCommandLinesAreRejectedInTheSameWay)
+{
+    ExpectSameResults({"stat"});
+    ExpectSameResults({"comit", "-m", "message"});
+    ExpectSameResults({"add", "a.txt"});
+    ExpectSameResults({"add", "a.txt", "--force"});
+    ExpectSameResults({"add", "--force", "a.txt", "b.txt"});
+    ExpectSameResults({"checkout", "release"});
+    ExpectSameResults({"checkout", "main", "-m", "message"});
+    ExpectSameResults({"commit"});
+    ExpectSameResults({"commit", "-m"});
+    ExpectSameResults({"commit", "-m", "message", "-a", "carol"});
+    ExpectSameResults({"commit", "-m", "message", "--force"});
+    ExpectSameResults({"commit", "-m", "message", "--unknown"});
+    ExpectSameResults({"commit", "-message", "text"});
+    ExpectSameResults({"publish", "-r", "origin"});
+    ExpectSameResults({"status", "--verbose"});
+    ExpectSameResults({"status", "-m", "message"});
+}
+
+TEST_F(TestGeneratedParser, EnvironmentVariablesAreUsedInTheSameWay)
+{
+    setenv("COMLINT_DIFFERENTIAL_AUTHOR", "bob", 1);
+    setenv("COMLINT_DIFFERENTIAL_REMOTE", "upstream", 1);
+
+    ExpectSameResults({"commit", "-m", "message"});
+    ExpectSameResults({"commit", "-m", "message", "-a", "alice"});
+    ExpectSameResults({"publish", "-undeclared", "value"});
+    ExpectSameResults({"status"});
+
+    setenv("COMLINT_DIFFERENTIAL_AUTHOR", "carol", 1);
+
+    ExpectSameResults({"commit", "-m", "message"});
+}
+
+TEST_F(TestGeneratedParser, NamesAreResolvedByGeneratedLookup)
+{
+    EXPECT_EQ(generated::differential_schema::Interface::FindCommand("checkout"), static_cast<std::uint32_t>(Command::kCheckout));
+    EXPECT_EQ(generated::differential_schema::Interface::FindOption("-verbosity"), 4U);
+    EXPECT_EQ(generated::differential_schema::Interface::FindFlag("--verbos"), Parser::kNoIndex);
+    EXPECT_EQ(generated::differential_schema::Interface::FindCommand(""), Parser::kNoIndex);
+}
+
+TEST_F(TestGeneratedParser, HandlerIsDispatchedByCommandEnumerator)
+{
+    char program_name[] = "vcs";
+    char commit[] = "commit";
+    char option[] = "-m";
+    char message[] = "message";
+    char* argv[] = {program_name, commit, option, message};
+    const auto commit_handler = std::make_shared<MockCommandHandler>();
+    Parser::CommandHandlers command_handlers {};
+    std::ostringstream stream {};
+    OutputSink output(stream);
+
+    command_handlers[static_cast<std::size_t>(Command::kCommit)] = commit_handler;
+
+    EXPECT_CALL(*commit_handler, Run(Parser::Parse(4, argv))).Times(1);
+    EXPECT_EQ(Parser::GetCommand(Parser::Parse(4, argv)), Command::kCommit);
+
+    Parser::Run(4, argv, command_handlers, output);
+}
\ No newline at end of file
@@ -0,0 +1,133 @@
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "comlint/glob_expander.hpp"
+
+using namespace comlint;
+
+class TestGlobExpander : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        for (const std::string file : {"main.cpp", "README.md", ".hidden.cpp", "src/a.cpp", "src/b.hpp", "src/net/socket.cpp",
+                                       "src/net/tls/session.cpp", "src/.cache/object.cpp"}) {
+            std::filesystem::create_directories((root_path_ / file).parent_path());
+            std::ofstream(root_path_ / file) << file;
+        }
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(root_path_);
+    }
+
+    std::vector<std::string> Expand(const std::string &pattern, const GlobExpansion glob_expansion)
+    {
+        std::vector<std::string> matches {};
+        std::mutex matches_mutex {};
+
+        GlobExpander::Expand(root_ + "/" + pattern, glob_expansion, [this, &matches, &matches_mutex](const std::string &path) {
+            const std::lock_guard<std::mutex> lock(matches_mutex);
+
+            matches.push_back(path.substr(root_.size() + 1U));
+        });
+
+        return matches;
+    }
+
+    std::vector<std::string> ExpandSorted(const std::string &pattern)
+    {
+        std::vector<std::string> matches = Expand(pattern, GlobExpansion::kUnordered);
+
+        std::sort(matches.begin(), matches.end());
+
+        return matches;
+    }
+
+    const std::filesystem::path root_path_ {std::filesystem::temp_directory_path() / "comlint_test_glob_expander"};
+    const std::string root_ {root_path_.string()};
+};
+
+TEST(TestGlobExpanderMatching, PatternIsRecognisedByUnescapedWildcard)
+{
+    EXPECT_TRUE(GlobExpander::IsPattern("*.cpp"));
+    EXPECT_TRUE(GlobExpander::IsPattern("file?.txt"));
+    EXPECT_TRUE(GlobExpander::IsPattern("file[0-9].txt"));
+    EXPECT_FALSE(GlobExpander::IsPattern("src/main.cpp"));
+    EXPECT_FALSE(GlobExpander::IsPattern("literal\\*.txt"));
+}
+
+TEST(TestGlobExpanderMatching, SegmentMatchesWildcardsAndClasses)
+{
+    EXPECT_TRUE(GlobExpander::MatchesSegment("*.cpp", "main.cpp"));
+    EXPECT_TRUE(GlobExpander::MatchesSegment("*", ""));
+    EXPECT_TRUE(GlobExpander::MatchesSegment("a*b*c", "aXXbYYbZc"));
+    EXPECT_TRUE(GlobExpander::MatchesSegment("file?.txt", "file1.txt"));
+    EXPECT_TRUE(GlobExpander::MatchesSegment("file[0-9].txt", "file7.txt"));
+    EXPECT_TRUE(GlobExpander::MatchesSegment("file[!0-9].txt", "fileX.txt"));
+    EXPECT_TRUE(GlobExpander::MatchesSegment("[]]", "]"));
+    EXPECT_TRUE(GlobExpander::MatchesSegment("literal\\*", "literal*"));
+    EXPECT_FALSE(GlobExpander::MatchesSegment("*.cpp", "main.hpp"));
+    EXPECT_FALSE(GlobExpander::MatchesSegment("file?.txt", "file.txt"));
+    EXPECT_FALSE(GlobExpander::MatchesSegment("file[!0-9].txt", "file7.txt"));
+    EXPECT_FALSE(GlobExpander::MatchesSegment("literal\\*", "literalX"));
+}
+
+TEST_F(TestGlobExpander, ValueWhichIsNotPatternIsGivenAsIs)
+{
+    std::vector<std::string> matches {};
+
+    GlobExpander::Expand("not/existing/file.txt", GlobExpansion::kUnordered, [&matches](const std::string &path) { matches.push_back(path); });
+
+    EXPECT_EQ(matches, std::vector<std::string>({"not/existing/file.txt"}));
+}
+
+TEST_F(TestGlobExpander, ValueWithEscapedWildcardsIsGivenUnescaped)
+{
+    std::vector<std::string> matches {};
+
+    GlobExpander::Expand("dir/file\\*.txt", GlobExpansion::kUnordered, [&matches](const std::string &path) { matches.push_back(path); });
+
+    EXPECT_EQ(matches, std::vector<std::string>({"dir/file*.txt"}));
+}
+
+TEST_F(TestGlobExpander, WildcardsMatchWithinSingleDirectory)
+{
+    EXPECT_EQ(ExpandSorted("*.cpp"), std::vector<std::string>({"main.cpp"}));
+    EXPECT_EQ(ExpandSorted("src/*"), std::vector<std::string>({"src/a.cpp", "src/b.hpp", "src/net"}));
+    EXPECT_EQ(ExpandSorted("*/?.cpp"), std::vector<std::string>({"src/a.cpp"}));
+    EXPECT_EQ(ExpandSorted(".*.cpp"), std::vector<std::string>({".hidden.cpp"}));
+    EXPECT_TRUE(ExpandSorted("*.txt").empty());
+}
+
+TEST_F(TestGlobExpander, AnyDirectoriesMatchesWholeTreeExceptHiddenDirectories)
+{
+    EXPECT_EQ(ExpandSorted("src/**/*.cpp"), std::vector<std::string>({"src/a.cpp", "src/net/socket.cpp", "src/net/tls/session.cpp"}));
+    EXPECT_EQ(ExpandSorted("**/tls"), std::vector<std::string>({"src/net/tls"}));
+    EXPECT_EQ(ExpandSorted("src/net/**"), std::vector<std::string>({"src/net/socket.cpp", "src/net/tls", "src/net/tls/session.cpp"}));
+}
+
+TEST_F(TestGlobExpander, OrderedExpansionIsDeterministic)
+{
+    const std::vector<std::string> expected_matches {"main.cpp", "src/a.cpp", "src/net/socket.cpp", "src/net/tls/session.cpp"};
+
+    for (unsigned int i = 0U; i < 10U; ++i) {
+        EXPECT_EQ(Expand("**/*.cpp", GlobExpansion::kOrdered), expected_matches);
+    }
+}
+TEST_F(TestGlobExpander, EveryMatchIsReportedOnceWhenAnyDirectoriesOverlap)
+{
+    std::filesystem::create_directories(root_path_ / "a/a");
+    std::ofstream(root_path_ / "a/a/b") << "b";
+
+    EXPECT_EQ(ExpandSorted("**/a/**/b"), std::vector<std::string>({"a/a/b"}));
+    EXPECT_EQ(Expand("**/a/**/b", GlobExpansion::kOrdered), std::vector<std::string>({"a/a/b"}));
+    EXPECT_EQ(ExpandSorted("**/a/**"), std::vector<std::string>({"a/a", "a/a/b"}));
+}
\ No newline at end of file
@@ -113,4 +113,100 @@ TEST(TestInterfaceHelper, GetHelpReturnsProperText)
     const std::string help = InterfaceHelper::GetHelp(program_name, program_description, commands, options, flags);
 
     EXPECT_EQ(help, expected_help);
+}
+
+TEST(TestInterfaceHelper, GetHelpContainsOptionEnvironmentVariable)
+{
+    const Options options {{"-config", OptionProperties("Path to the configuration file", {}, "", "APP_CONFIG")}};
+    const std::string expected_options_help = "OPTIONS:\n"
+                                              "-config                  Path to the configuration file\n"
+                                              "  environment variable   APP_CONFIG\n";
+
+    const std::string help = InterfaceHelper::GetHelp("SomeProgram", "", {}, options, {});
+
+    EXPECT_NE(help.find(expected_options_help), std::string::npos);
+}
+
+TEST(TestInterfaceHelper, GetHelpContainsOptionDefaultValue)
+{
+    const Options options {{"-mode", OptionProperties("Mode in which file is opened", {"read_only", "read_write"}, "read_only")}};
+    const std::string expected_options_help = "OPTIONS:\n"
+                                              "-mode                    Mode in which file is opened\n"
+                                              "  allowed values         [read_only, read_write]\n"
+                                              "  default value          read_only\n";
+
+    const std::string help = InterfaceHelper::GetHelp("SomeProgram", "", {}, options, {});
+
+    EXPECT_NE(help.find(expected_options_help), std::string::npos);
+}
+
+TEST(TestInterfaceHelper, GetManPageReturnsProperText)
+{
+    const Commands commands {{"add", CommandProperties({}, {}, {"--force"}, "Add file", 1U)}};
+    const Options options {{"-m", OptionProperties("Commit message", {}, "")}};
+    const Flags flags {{"--force", FlagProperties(".hidden files too")}};
+    const std::string expected_man_page = ".TH GIT\\-LIKE 1\n"
+                                          ".SH NAME\n"
+                                          "git\\-like \\- Version control\n"
+                                          ".SH SYNOPSIS\n"
+                                          ".B git\\-like\n"
+                                          "[command] [command values] [options] [flags]\n"
+                                          ".SH COMMANDS\n"
+                                          ".TP\n"
+                                          ".B add\n"
+                                          "Add file\n"
+                                          ".br\n"
+                                          "Number of values: 1\n"
+                                          ".br\n"
+                                          "Allowed flags: \\-\\-force\n"
+                                          ".SH OPTIONS\n"
+                                          ".TP\n"
+                                          ".B \\-m\n"
+                                          "Commit message\n"
+                                          ".SH FLAGS\n"
+                                          ".TP\n"
+                                          ".B \\-\\-force\n"
+                                          "\\&.hidden files too\n";
+
+    const std::string man_page = InterfaceHelper::GetManPage("git-like", "Version control", commands, options, flags);
+
+    EXPECT_EQ(man_page, expected_man_page);
+}
+
+TEST(TestInterfaceHelper, GetMarkdownReturnsProperText)
+{
+    const Commands commands {{"commit", CommandProperties({}, {"-m"}, {}, "Record changes", 0U, {"-m"})}};
+    const Options options {{"-m", OptionProperties("Commit message", {}, "", "GIT_MESSAGE")}};
+    const Flags flags {{"--amend", FlagProperties("Amend previous commit")}};
+    const std::string expected_markdown = "# git\n"
+                                          "\n"
+                                          "Version control\n"
+                                          "\n"
+                                          "## Commands\n"
+                                          "\n"
+                                          "### `commit`\n"
+                                          "\n"
+                                          "Record changes\n"
+                                          "\n"
+                                          "* Allowed options: `-m`\n"
+                                          "* Required options: `-m`\n"
+                                          "\n"
+                                          "## Options\n"
+                                          "\n"
+                                          "### `-m`\n"
+                                          "\n"
+                                          "Commit message\n"
+                                          "\n"
+                                          "* Environment variable: `GIT_MESSAGE`\n"
+                                          "\n"
+                                          "## Flags\n"
+                                          "\n"
+                                          "### `--amend`\n"
+                                          "\n"
+                                          "Amend previous commit\n"
+                                          "\n";
+
+    const std::string markdown = InterfaceHelper::GetMarkdown("git", "Version control", commands, options, flags);
+
+    EXPECT_EQ(markdown, expected_markdown);
 }
\ No newline at end of file
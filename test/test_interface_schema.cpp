@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+
+#include "comlint/interface_schema.hpp"
+#include "comlint/mapped_file.hpp"
+#include "comlint/exceptions/invalid_interface_schema.hpp"
+#include "example_schema_help.hpp"
+
+using namespace comlint;
+
+TEST(TestInterfaceSchema, ParseReturnsDeclaredInterface)
+{
+    const std::string_view content = "[program]\n"
+                                     "name = git\n"
+                                     "description = Version control\n"
+                                     "[command:commit]\n"
+                                     "description = Record changes\n"
+                                     "allowed_options = -m , -a\n"
+                                     "allowed_flags = --amend\n"
+                                     "required_options = -m\n"
+                                     "[command:add]\n"
+                                     "description = Add file\n"
+                                     "num_of_values = 2\n"
+                                     "allowed_values = a,b\n"
+                                     "[option:-m]\n"
+                                     "description = Commit message\n"
+                                     "[option:-a]\n"
+                                     "description = Author\n"
+                                     "allowed_values = alice, bob\n"
+                                     "default_value = bob\n"
+                                     "environment_variable = GIT_AUTHOR\n"
+                                     "[flag:--amend]\n"
+                                     "description = Amend previous commit\n";
+
+    const InterfaceSchema schema = InterfaceSchema::Parse(content);
+
+    EXPECT_EQ(std::string_view(schema.program_name), "git");
+    EXPECT_EQ(std::string_view(schema.description), "Version control");
+    ASSERT_EQ(schema.commands.size(), 2U);
+    ASSERT_EQ(schema.options.size(), 2U);
+    ASSERT_EQ(schema.flags.size(), 1U);
+
+    const CommandProperties &commit = schema.commands.find("commit")->second;
+    const CommandProperties &add = schema.commands.find("add")->second;
+    const OptionProperties &author = schema.options.find("-a")->second;
+
+    EXPECT_EQ(std::string_view(commit.description), "Record changes");
+    EXPECT_EQ(commit.num_of_required_values, 0U);
+    ASSERT_EQ(commit.allowed_options.size(), 2U);
+    EXPECT_EQ(std::string_view(commit.allowed_options[1U]), "-a");
+    ASSERT_EQ(commit.required_options.size(), 1U);
+    EXPECT_EQ(add.num_of_required_values, 2U);
+    EXPECT_EQ(add.allowed_values.size(), 2U);
+    EXPECT_EQ(author.allowed_values.size(), 2U);
+    EXPECT_EQ(std::string_view(author.default_value), "bob");
+    EXPECT_EQ(std::string_view(author.environment_variable), "GIT_AUTHOR");
+    EXPECT_EQ(std::string_view(schema.flags.find("--amend")->second.description), "Amend previous commit");
+}
+
+TEST(TestInterfaceSchema, ParseThrowsInvalidInterfaceSchemaForUnsupportedSection)
+{
+    EXPECT_THROW(InterfaceSchema::Parse("[something]\ndescription = text\n"), InvalidInterfaceSchema);
+}
+
+TEST(TestInterfaceSchema, ParseThrowsInvalidInterfaceSchemaForUnsupportedKey)
+{
+    EXPECT_THROW(InterfaceSchema::Parse("[flag:--flag]\nvalue = text\n"), InvalidInterfaceSchema);
+}
+
+TEST(TestInterfaceSchema, ParseThrowsInvalidInterfaceSchemaForEntriesOutsideOfSections)
+{
+    EXPECT_THROW(InterfaceSchema::Parse("name = git\n[program]\n"), InvalidInterfaceSchema);
+}
+
+TEST(TestInterfaceSchema, ParseThrowsInvalidInterfaceSchemaForInvalidNames)
+{
+    EXPECT_THROW(InterfaceSchema::Parse("[command:-command]\n"), InvalidInterfaceSchema);
+    EXPECT_THROW(InterfaceSchema::Parse("[option:--option]\n"), InvalidInterfaceSchema);
+    EXPECT_THROW(InterfaceSchema::Parse("[flag:-flag]\n"), InvalidInterfaceSchema);
+}
+
+TEST(TestInterfaceSchema, ParseThrowsInvalidInterfaceSchemaForInvalidNumberOfValues)
+{
+    EXPECT_THROW(InterfaceSchema::Parse("[command:add]\nnum_of_values = one\n"), InvalidInterfaceSchema);
+}
+
+TEST(TestInterfaceSchema, ParseThrowsInvalidInterfaceSchemaForDefaultValueWhichIsNotAllowed)
+{
+    EXPECT_THROW(InterfaceSchema::Parse("[option:-a]\nallowed_values = alice\ndefault_value = bob\n"), InvalidInterfaceSchema);
+}
+
+TEST(TestInterfaceSchema, GeneratedHelpIsEqualToHelpRenderedAtRuntime)
+{
+    const MappedFile schema_file {std::string(COMLINT_TEST_SCHEMAS_DIR "/example_schema.ini")};
+
+    ASSERT_TRUE(schema_file.IsMapped());
+
+    const InterfaceSchema schema = InterfaceSchema::Parse(schema_file.GetContent());
+    const std::string help = InterfaceHelper::GetHelp(schema.program_name, schema.description, schema.commands, schema.options, schema.flags);
+
+    EXPECT_EQ(generated::example_schema::kHelp, help);
+}
\ No newline at end of file
@@ -0,0 +1,140 @@
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+#include "comlint/invocation_log.hpp"
+#include "comlint/parsed_command.hpp"
+#include "comlint/exceptions/invalid_invocation_log.hpp"
+
+using namespace comlint;
+
+class TestInvocationLog : public ::testing::Test
+{
+protected:
+    void TearDown() override
+    {
+        std::filesystem::remove(log_path_);
+    }
+
+    std::string ReadLog() const
+    {
+        std::ifstream log_file(log_path_, std::ios::binary);
+        std::stringstream log {};
+
+        log << log_file.rdbuf();
+
+        return log.str();
+    }
+
+    static Commands GetCommands()
+    {
+        Commands commands {};
+
+        commands.emplace(std::piecewise_construct, std::forward_as_tuple("commit"),
+                         std::forward_as_tuple(CommandValues{}, OptionNames{"-m"}, FlagNames{"--amend"}, "Record changes", 0U, OptionNames{}));
+
+        return commands;
+    }
+    static Options GetOptions(const std::string &description = "Commit message")
+    {
+        Options options {};
+
+        options.emplace(std::piecewise_construct, std::forward_as_tuple("-m"), std::forward_as_tuple(description, OptionValues{}, "", ""));
+
+        return options;
+    }
+    static Flags GetFlags()
+    {
+        Flags flags {};
+
+        flags.emplace(std::piecewise_construct, std::forward_as_tuple("--amend"), std::forward_as_tuple("Amend the previous commit"));
+
+        return flags;
+    }
+
+    const InvocationRecord parsed_record_ {0x0123456789ABCDEFULL, {"commit", "-m", "message with spaces"}, InvocationOutcome::kParsed,
+                                           "commit -m=message with spaces", std::chrono::nanoseconds(1500), std::chrono::nanoseconds(300000)};
+    const InvocationRecord failed_record_ {1U, {"comit"}, InvocationOutcome::kFailed, "UnsupportedCommand: Command comit is not supported!",
+                                           std::chrono::nanoseconds(900), std::chrono::nanoseconds(0)};
+    const std::string log_path_ {(std::filesystem::temp_directory_path() / "comlint_test_invocation_log.bin").string()};
+};
+
+TEST_F(TestInvocationLog, SerializedRecordsAreReadBack)
+{
+    const std::string content = InvocationLog::Serialize(parsed_record_) + InvocationLog::Serialize(failed_record_);
+    const std::vector<InvocationRecord> expected_records {parsed_record_, failed_record_};
+
+    EXPECT_EQ(InvocationLog::Read(content), expected_records);
+}
+
+TEST_F(TestInvocationLog, RecordsAreAppendedToFile)
+{
+    ASSERT_TRUE(InvocationLog::Append(log_path_, parsed_record_));
+    ASSERT_TRUE(InvocationLog::Append(log_path_, failed_record_));
+
+    const std::vector<InvocationRecord> expected_records {parsed_record_, failed_record_};
+
+    EXPECT_EQ(InvocationLog::Read(ReadLog()), expected_records);
+}
+
+TEST_F(TestInvocationLog, AppendingToUnwritablePathFails)
+{
+    EXPECT_FALSE(InvocationLog::Append((std::filesystem::temp_directory_path() / "comlint_missing_directory" / "log.bin").string(),
+                                       parsed_record_));
+}
+
+TEST_F(TestInvocationLog, EmptyLogHasNoRecords)
+{
+    EXPECT_TRUE(InvocationLog::Read("").empty());
+}
+
+TEST_F(TestInvocationLog, ReadingThrowsForTruncatedRecord)
+{
+    const std::string content = InvocationLog::Serialize(parsed_record_);
+
+    EXPECT_THROW(InvocationLog::Read(content.substr(0U, content.size() - 1U)), InvalidInvocationLog);
+}
+
+TEST_F(TestInvocationLog, ReadingThrowsForMissingRecordMarker)
+{
+    EXPECT_THROW(InvocationLog::Read("not a log"), InvalidInvocationLog);
+}
+
+TEST_F(TestInvocationLog, SchemaHashDependsOnlyOnParsingRelatedProperties)
+{
+    const std::uint64_t schema_hash = InvocationLog::GetSchemaHash(GetCommands(), GetOptions(), GetFlags(), true, false, "");
+    Flags other_flags = GetFlags();
+
+    other_flags.emplace(std::piecewise_construct, std::forward_as_tuple("--verbose"), std::forward_as_tuple("Be verbose"));
+
+    EXPECT_EQ(InvocationLog::GetSchemaHash(GetCommands(), GetOptions(), GetFlags(), true, false, ""), schema_hash);
+    EXPECT_EQ(InvocationLog::GetSchemaHash(GetCommands(), GetOptions("Reworded description"), GetFlags(), true, false, ""), schema_hash);
+    EXPECT_NE(InvocationLog::GetSchemaHash(GetCommands(), GetOptions(), other_flags, true, false, ""), schema_hash);
+    EXPECT_NE(InvocationLog::GetSchemaHash(GetCommands(), Options{}, GetFlags(), true, false, ""), schema_hash);
+}
+
+TEST_F(TestInvocationLog, SchemaHashDependsOnValueChecksAndInterfaceSettings)
+{
+    const std::uint64_t schema_hash = InvocationLog::GetSchemaHash(GetCommands(), GetOptions(), GetFlags(), true, false, "");
+    Commands constrained_commands = GetCommands();
+    Options checked_options = GetOptions();
+
+    constrained_commands.at("commit").value_constraint = std::make_shared<const ValueConstraint>(ValueConstraint::Range(1, 10));
+    checked_options.at("-m").path_requirement = PathRequirement::kFile;
+
+    EXPECT_NE(InvocationLog::GetSchemaHash(GetCommands(), GetOptions(), GetFlags(), false, false, ""), schema_hash);
+    EXPECT_NE(InvocationLog::GetSchemaHash(GetCommands(), GetOptions(), GetFlags(), true, true, ""), schema_hash);
+    EXPECT_NE(InvocationLog::GetSchemaHash(GetCommands(), GetOptions(), GetFlags(), true, false, "settings.ini"), schema_hash);
+    EXPECT_NE(InvocationLog::GetSchemaHash(constrained_commands, GetOptions(), GetFlags(), true, false, ""), schema_hash);
+    EXPECT_NE(InvocationLog::GetSchemaHash(GetCommands(), checked_options, GetFlags(), true, false, ""), schema_hash);
+}
+
+TEST_F(TestInvocationLog, ResultDescribesParsedCommand)
+{
+    const ParsedCommand parsed_command("merge", {"feature", "main"}, {{"-m", "message"}, {"-s", "recursive"}},
+                                       {{"--verbose", true}, {"--quiet", false}});
+
+    EXPECT_EQ(InvocationLog::GetResult(parsed_command), "merge feature main -m=message -s=recursive --verbose");
+}
\ No newline at end of file
@@ -0,0 +1,89 @@
+#include <atomic>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "comlint/lazy_command_handler.hpp"
+#include "comlint/exceptions/invalid_command_handler.hpp"
+
+using namespace comlint;
+
+namespace {
+
+class CountingCommandHandler : public CommandHandlerInterface
+{
+public:
+    explicit CountingCommandHandler(std::atomic<unsigned int> &num_of_runs)
+    : num_of_runs_{num_of_runs}
+    {}
+
+    void Run(const ParsedCommand&) final
+    {
+        num_of_runs_++;
+    }
+
+private:
+    std::atomic<unsigned int> &num_of_runs_;
+};
+
+} // namespace
+
+TEST(TestLazyCommandHandler, HandlerIsCreatedOnceOnFirstRun)
+{
+    std::atomic<unsigned int> num_of_creations {0U};
+    std::atomic<unsigned int> num_of_runs {0U};
+    LazyCommandHandler lazy_command_handler([&]() {
+        num_of_creations++;
+        return std::make_shared<CountingCommandHandler>(num_of_runs);
+    });
+    std::vector<std::thread> threads {};
+
+    EXPECT_FALSE(lazy_command_handler.IsCreated());
+
+    for (unsigned int i = 0U; i < 8U; i++) {
+        threads.emplace_back([&lazy_command_handler]() {
+            std::ostringstream stream {};
+            OutputSink output(stream);
+
+            lazy_command_handler.Run(ParsedCommand("command", {}, {}, {}), output);
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_TRUE(lazy_command_handler.IsCreated());
+    EXPECT_EQ(num_of_creations, 1U);
+    EXPECT_EQ(num_of_runs, 8U);
+}
+
+TEST(TestLazyCommandHandler, FailedCreationIsRetried)
+{
+    std::atomic<unsigned int> num_of_runs {0U};
+    bool is_available = false;
+    LazyCommandHandler lazy_command_handler([&]() -> CommandHandlerPtr {
+        if (!is_available) {
+            throw std::runtime_error("database is not available");
+        }
+        return std::make_shared<CountingCommandHandler>(num_of_runs);
+    });
+
+    EXPECT_THROW(lazy_command_handler.Run(ParsedCommand("command", {}, {}, {})), std::runtime_error);
+    EXPECT_FALSE(lazy_command_handler.IsCreated());
+
+    is_available = true;
+    lazy_command_handler.Run(ParsedCommand("command", {}, {}, {}));
+
+    EXPECT_EQ(num_of_runs, 1U);
+}
+
+TEST(TestLazyCommandHandler, FactoryReturningNullptrIsRejected)
+{
+    LazyCommandHandler lazy_command_handler([]() { return CommandHandlerPtr{}; });
+
+    EXPECT_THROW(lazy_command_handler.Run(ParsedCommand("command", {}, {}, {})), InvalidCommandHandler);
+}
\ No newline at end of file
@@ -0,0 +1,59 @@
+#include <filesystem>
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+#include "comlint/mapped_file.hpp"
+
+using namespace comlint;
+
+class TestMappedFile : public ::testing::Test
+{
+protected:
+    std::string CreateFile(const std::string &content)
+    {
+        std::ofstream file(path_, std::ios::binary);
+
+        file << content;
+
+        return path_.string();
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove(path_);
+    }
+
+private:
+    const std::filesystem::path path_ {std::filesystem::temp_directory_path() / "comlint_test_mapped_file.txt"};
+};
+
+TEST_F(TestMappedFile, ConstructorDoesNotThrowForNotExistingFile)
+{
+    EXPECT_NO_THROW(MappedFile("/not/existing/file.txt"));
+}
+
+TEST_F(TestMappedFile, IsMappedReturnsFalseForNotExistingFile)
+{
+    const MappedFile file("/not/existing/file.txt");
+
+    EXPECT_FALSE(file.IsMapped());
+    EXPECT_TRUE(file.GetContent().empty());
+}
+
+TEST_F(TestMappedFile, GetContentReturnsFileContent)
+{
+    const std::string content {"[command]\n-option = value\n"};
+    const MappedFile file(CreateFile(content));
+
+    EXPECT_TRUE(file.IsMapped());
+    EXPECT_EQ(file.GetContent(), content);
+}
+
+TEST_F(TestMappedFile, EmptyFileIsMapped)
+{
+    const MappedFile file(CreateFile(""));
+
+    EXPECT_TRUE(file.IsMapped());
+    EXPECT_TRUE(file.GetContent().empty());
+}
\ No newline at end of file
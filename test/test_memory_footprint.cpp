@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+
+#include <memory_resource>
+#include <sstream>
+#include <string>
+
+#include "comlint/memory_footprint.hpp"
+#include "comlint/command_line_interface.hpp"
+
+using namespace comlint;
+
+TEST(TestMemoryFootprint, TotalIsSumOfAllCategories)
+{
+    MemoryFootprint footprint {};
+
+    footprint.names = 1U;
+    footprint.descriptions = 2U;
+    footprint.allowed_values = 4U;
+    footprint.lookup_indexes = 8U;
+    footprint.handlers = 16U;
+
+    EXPECT_EQ(footprint.GetTotal(), 31U);
+    EXPECT_EQ((footprint + footprint).GetTotal(), 62U);
+}
+
+TEST(TestMemoryFootprint, ShortStringTakesNoHeap)
+{
+    const std::pmr::string short_string {"-v"};
+    const std::pmr::string long_string(100U, 'x');
+
+    EXPECT_EQ(MemoryFootprint::GetHeapSize(short_string), 0U);
+    EXPECT_GE(MemoryFootprint::GetHeapSize(long_string), 101U);
+}
+
+TEST(TestMemoryFootprint, HeapSizeOfStringsIncludesVectorAndElements)
+{
+    std::pmr::vector<std::pmr::string> strings {};
+
+    strings.reserve(2U);
+    strings.emplace_back("short");
+    strings.emplace_back(100U, 'x');
+
+    EXPECT_EQ(MemoryFootprint::GetHeapSize(strings), 2U * sizeof(std::pmr::string) + MemoryFootprint::GetHeapSize(strings.back()));
+}
+
+TEST(TestMemoryFootprint, CommandFootprintIsSplitIntoCategories)
+{
+    const std::pmr::string command_name {"a_very_long_command_name_stored_on_heap"};
+    const CommandProperties command_properties {{"read", "write"}, {"-mode"}, {"--verbose"}, std::string(64U, 'd'), 1U, {}};
+
+    const MemoryFootprint footprint = MemoryFootprint::GetCommandFootprint(command_name, command_properties);
+
+    EXPECT_EQ(footprint.names, MemoryFootprint::GetHeapSize(command_name));
+    EXPECT_EQ(footprint.descriptions, MemoryFootprint::GetHeapSize(command_properties.description));
+    EXPECT_EQ(footprint.allowed_values, 4U * sizeof(std::pmr::string));
+    EXPECT_GT(footprint.lookup_indexes, sizeof(CommandProperties));
+    EXPECT_EQ(footprint.handlers, 0U);
+}
+
+TEST(TestMemoryFootprint, CompiledInterfaceIsSmallerThanDeclaredInterface)
+{
+    char program_name[] = "program";
+    char* argv[] = {program_name};
+    CommandLineInterface cli(1, argv, "program", "Program description");
+
+    for (unsigned int i = 0U; i < 100U; ++i) {
+        const std::string index = std::to_string(i);
+        cli.AddOption("-option_" + index, "Description of option " + index, {"first_allowed_value", "second_allowed_value"});
+        cli.AddFlag("--flag_" + index, "Description of flag " + index);
+    }
+    cli.AddCommand("command", "Command description", {"-option_0", "-option_1"}, {"--flag_0"});
+    cli.SetHelp("Static help prompt");
+
+    const MemoryFootprint declared_footprint = cli.GetMemoryFootprint();
+    const MemoryFootprint compiled_footprint = cli.Compile().GetMemoryFootprint();
+
+    EXPECT_EQ(compiled_footprint.descriptions, 0U);
+    EXPECT_EQ(compiled_footprint.handlers, 0U);
+    EXPECT_EQ(compiled_footprint.names, declared_footprint.names);
+    EXPECT_GT(compiled_footprint.allowed_values, 0U);
+    EXPECT_LT(compiled_footprint.lookup_indexes, declared_footprint.lookup_indexes);
+    EXPECT_LT(compiled_footprint.GetTotal(), declared_footprint.GetTotal());
+}
+
+TEST(TestMemoryFootprint, HelpOfCompiledInterfaceTakesMemoryOnlyAfterItIsRequested)
+{
+    char program_name[] = "program";
+    char help[] = "help";
+    char* argv[] = {program_name, help};
+    CommandLineInterface cli(2, argv, "program", "Program description");
+    std::stringstream help_stream {};
+
+    cli.AddCommand("command", "Command description");
+
+    const CompiledInterface compiled_interface = cli.Compile();
+
+    EXPECT_EQ(compiled_interface.GetMemoryFootprint().descriptions, 0U);
+    {
+        OutputSink output(help_stream);
+        compiled_interface.Parse(2, argv, output);
+    }
+    EXPECT_GE(compiled_interface.GetMemoryFootprint().descriptions, help_stream.str().size());
+}
\ No newline at end of file
@@ -0,0 +1,163 @@
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "comlint/metrics_collector.hpp"
+#include "comlint/exceptions/command_timed_out.hpp"
+
+using namespace comlint;
+
+namespace {
+
+std::string ReadFile(const std::string &path)
+{
+    std::ifstream file(path);
+    std::stringstream content {};
+
+    content << file.rdbuf();
+
+    return content.str();
+}
+
+} // namespace
+
+TEST(TestMetricsCollector, LatencyFallsIntoBucketBelowItsUpperBound)
+{
+    for (const std::uint64_t nanoseconds : {0ULL, 1ULL, 3ULL, 4ULL, 7ULL, 8ULL, 1000ULL, 1024ULL, 123456789ULL, 1ULL << 41U}) {
+        const std::size_t bucket = LatencyHistogram::GetBucket(nanoseconds);
+
+        EXPECT_LT(nanoseconds, LatencyHistogram::GetUpperBound(bucket));
+        EXPECT_TRUE(bucket == 0U || nanoseconds >= LatencyHistogram::GetUpperBound(bucket - 1U)) << nanoseconds;
+    }
+
+    EXPECT_EQ(LatencyHistogram::GetBucket(1ULL << 50U), LatencyHistogram::kNumOfBuckets - 1U);
+    EXPECT_EQ(LatencyHistogram::GetUpperBound(LatencyHistogram::kNumOfBuckets - 1U), UINT64_MAX);
+}
+
+TEST(TestMetricsCollector, RelativeErrorOfBucketIsBounded)
+{
+    for (std::size_t bucket = LatencyHistogram::kNumOfSubBuckets; bucket + 1U < LatencyHistogram::kNumOfBuckets; bucket++) {
+        const std::uint64_t lower_bound = LatencyHistogram::GetUpperBound(bucket - 1U);
+        const std::uint64_t upper_bound = LatencyHistogram::GetUpperBound(bucket);
+
+        EXPECT_LE((upper_bound - lower_bound) * LatencyHistogram::kNumOfSubBuckets, lower_bound) << bucket;
+    }
+}
+
+TEST(TestMetricsCollector, RunsOfAllThreadsAreSummed)
+{
+    MetricsCollector collector("git", {"add", "commit"}, {});
+    std::vector<std::thread> threads {};
+
+    for (unsigned int i = 0U; i < 4U; i++) {
+        threads.emplace_back([&collector]() {
+            for (unsigned int run = 0U; run < 1000U; run++) {
+                collector.RecordRun(1U, std::chrono::microseconds(run));
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    const std::vector<CommandMetrics> snapshot = collector.GetSnapshot();
+
+    ASSERT_EQ(snapshot.size(), 2U);
+    EXPECT_EQ(snapshot[0U].num_of_runs, 0U);
+    EXPECT_EQ(snapshot[1U].name, "commit");
+    EXPECT_EQ(snapshot[1U].num_of_runs, 4000U);
+    EXPECT_EQ(snapshot[1U].total_latency, std::chrono::microseconds(4U * 999U * 1000U / 2U));
+    // median is 500 us, bucket bound may exceed it by a quarter at most
+    EXPECT_GE(snapshot[1U].GetQuantile(0.5), std::chrono::microseconds(500));
+    EXPECT_LE(snapshot[1U].GetQuantile(0.5), std::chrono::microseconds(625));
+}
+
+TEST(TestMetricsCollector, ErrorsAreCountedByExceptionType)
+{
+    MetricsCollector collector("git", {"add"}, {});
+
+    collector.RecordRun(0U, std::chrono::milliseconds(1));
+    collector.RecordRun(0U, std::chrono::milliseconds(1), &typeid(std::runtime_error));
+    collector.RecordRun(0U, std::chrono::milliseconds(1), &typeid(std::runtime_error));
+    collector.RecordRun(0U, std::chrono::milliseconds(1), &typeid(CommandTimedOut));
+    collector.RecordRun(0U, std::chrono::milliseconds(1), &typeid(void));
+
+    const std::map<std::string, std::uint64_t> expected_errors {{"comlint::CommandTimedOut", 1U}, {"std::runtime_error", 2U}, {"unknown", 1U}};
+
+    EXPECT_EQ(collector.GetSnapshot()[0U].num_of_runs, 5U);
+    EXPECT_EQ(collector.GetSnapshot()[0U].num_of_errors, expected_errors);
+}
+
+TEST(TestMetricsCollector, CountersAreKeptWhenCommandsAreAdded)
+{
+    MetricsCollector collector("git", {"add"}, {});
+
+    collector.RecordRun(0U, std::chrono::milliseconds(1));
+
+    EXPECT_EQ(collector.AddCommand("add"), 0U);
+    EXPECT_EQ(collector.AddCommand("commit"), 1U);
+
+    collector.RecordRun(1U, std::chrono::milliseconds(1));
+    collector.RecordRun(0U, std::chrono::milliseconds(1));
+
+    const std::vector<CommandMetrics> snapshot = collector.GetSnapshot();
+
+    ASSERT_EQ(snapshot.size(), 2U);
+    EXPECT_EQ(snapshot[0U].num_of_runs, 2U);
+    EXPECT_EQ(snapshot[1U].name, "commit");
+    EXPECT_EQ(snapshot[1U].num_of_runs, 1U);
+}
+
+TEST(TestMetricsCollector, PrometheusTextContainsCountersAndCumulativeHistogram)
+{
+    MetricsCollector collector("my \"tool\"", {"add", "commit"}, {});
+
+    collector.RecordRun(0U, std::chrono::microseconds(3));
+    collector.RecordRun(0U, std::chrono::milliseconds(3), &typeid(std::runtime_error));
+
+    const std::string text = collector.GetPrometheusText();
+    const std::string labels = "program=\"my \\\"tool\\\"\",command=\"add\"";
+
+    EXPECT_NE(text.find("# TYPE comlint_command_runs_total counter\ncomlint_command_runs_total{" + labels + "} 2\n"), std::string::npos);
+    EXPECT_NE(text.find("comlint_command_errors_total{" + labels + ",exception=\"std::runtime_error\"} 1\n"), std::string::npos);
+    EXPECT_NE(text.find("comlint_command_latency_seconds_bucket{" + labels + ",le=\"2.048e-06\"} 0\n"), std::string::npos);
+    EXPECT_NE(text.find("comlint_command_latency_seconds_bucket{" + labels + ",le=\"4.096e-06\"} 1\n"), std::string::npos);
+    EXPECT_NE(text.find("comlint_command_latency_seconds_bucket{" + labels + ",le=\"+Inf\"} 2\n"), std::string::npos);
+    EXPECT_NE(text.find("comlint_command_latency_seconds_sum{" + labels + "} 0.003003\n"), std::string::npos);
+    EXPECT_NE(text.find("comlint_command_latency_seconds_count{" + labels + "} 2\n"), std::string::npos);
+    EXPECT_EQ(text.find("command=\"commit\""), std::string::npos);
+}
+
+TEST(TestMetricsCollector, MetricsFileIsReplacedOrAppendedTo)
+{
+    const std::string metrics_path = testing::TempDir() + "comlint_metrics.prom";
+
+    std::remove(metrics_path.c_str());
+
+    for (const bool is_appending : {false, false, true, true}) {
+        MetricsCollector collector("git", {"add"}, {metrics_path, std::chrono::milliseconds(0), is_appending});
+
+        collector.RecordRun(0U, std::chrono::milliseconds(1));
+    }
+
+    const std::string content = ReadFile(metrics_path);
+    std::size_t num_of_snapshots = 0U;
+
+    for (std::size_t position = content.find("comlint_command_runs_total{"); position != std::string::npos;
+         position = content.find("comlint_command_runs_total{", position + 1U)) {
+        num_of_snapshots++;
+    }
+
+    // the second collector replaced the file written by the first one, the others appended to it
+    EXPECT_EQ(num_of_snapshots, 3U);
+    EXPECT_EQ(content.find("# HELP"), 0U);
+    EXPECT_NE(content.find("# Written at ", content.find("# Written at ") + 1U), std::string::npos);
+    std::remove(metrics_path.c_str());
+}
\ No newline at end of file
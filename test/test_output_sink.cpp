@@ -0,0 +1,146 @@
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "comlint/output_sink.hpp"
+
+using namespace comlint;
+
+TEST(TestOutputSink, TextIsWrittenOnlyWhenFlushed)
+{
+    std::ostringstream stream {};
+    OutputSink output(stream);
+
+    output << "port " << 8080 << ' ' << -1 << '\n';
+
+    EXPECT_TRUE(stream.str().empty());
+
+    output.Flush();
+
+    EXPECT_EQ(stream.str(), "port 8080 -1\n");
+}
+
+TEST(TestOutputSink, FullBufferIsWrittenAutomatically)
+{
+    std::ostringstream stream {};
+    OutputSink output(stream, 8U);
+
+    output << "1234";
+    output << "5678";
+
+    EXPECT_TRUE(stream.str().empty());
+
+    output << "9";
+
+    EXPECT_EQ(stream.str(), "12345678");
+
+    output << "text longer than buffer";
+
+    EXPECT_EQ(stream.str(), "123456789text longer than buffer");
+}
+
+TEST(TestOutputSink, RootSinkIsFlushedOnDestruction)
+{
+    std::ostringstream stream {};
+
+    {
+        OutputSink output(stream);
+
+        output << "captured";
+    }
+
+    EXPECT_EQ(stream.str(), "captured");
+}
+
+TEST(TestOutputSink, ChildrenAreMergedInCreationOrder)
+{
+    std::ostringstream stream {};
+    OutputSink output(stream);
+    auto first_child = output.CreateChild();
+    auto second_child = output.CreateChild();
+    auto third_child = output.CreateChild();
+
+    *third_child << "third\n";
+    *first_child << "first\n";
+    *second_child << "second\n";
+    third_child->Close();
+    second_child.reset();
+    output.Flush();
+
+    EXPECT_TRUE(stream.str().empty());
+
+    first_child.reset();
+    output.Flush();
+
+    EXPECT_EQ(stream.str(), "first\nsecond\nthird\n");
+}
+
+TEST(TestOutputSink, EldestOpenChildPassesOutputToParentWhenFlushed)
+{
+    std::ostringstream stream {};
+    OutputSink output(stream, 8U);
+    auto first_child = output.CreateChild();
+    auto second_child = output.CreateChild();
+
+    *second_child << "second\n";
+    second_child->Flush();
+    *first_child << "first\n";
+
+    EXPECT_TRUE(stream.str().empty());
+
+    first_child->Flush();
+
+    EXPECT_EQ(stream.str(), "first\n");
+
+    *first_child << "full buffer\n";
+
+    EXPECT_EQ(stream.str(), "first\nfull buffer\n");
+
+    first_child.reset();
+    second_child->Flush();
+
+    EXPECT_EQ(stream.str(), "first\nfull buffer\nsecond\n");
+}
+
+TEST(TestOutputSink, WritesToClosedChildAreIgnored)
+{
+    std::ostringstream stream {};
+    OutputSink output(stream);
+    auto child = output.CreateChild();
+
+    *child << "kept";
+    child->Close();
+    *child << "ignored";
+    child->Flush();
+    child.reset();
+    output.Flush();
+
+    EXPECT_EQ(stream.str(), "kept");
+}
+
+TEST(TestOutputSink, OutputOfConcurrentChildrenIsNotInterleaved)
+{
+    std::ostringstream stream {};
+    std::string expected_output {};
+
+    {
+        OutputSink output(stream, 16U);
+        std::vector<std::thread> threads {};
+
+        for (char id = 'a'; id <= 'h'; ++id) {
+            threads.emplace_back([child = output.CreateChild(), id]() {
+                for (unsigned int i = 0U; i < 100U; ++i) {
+                    *child << id;
+                }
+            });
+            expected_output.append(100U, id);
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+    }
+
+    EXPECT_EQ(stream.str(), expected_output);
+}
\ No newline at end of file
@@ -62,4 +62,49 @@ TEST(TestParsedCommand, ComparsonOperatorReturnsFalseForDifferentParsedCommands)
                                          {{"--flag_name", true}, {"--other_flag_name", true}});
 
     EXPECT_FALSE(parsed_command_1 == parsed_command_2);
+}
+
+TEST(TestPmrParsedCommand, ConstructorUsesGivenMemoryResource)
+{
+    std::pmr::monotonic_buffer_resource memory_resource {};
+    const pmr::ParsedCommand command(&memory_resource);
+
+    EXPECT_EQ(command.get_allocator().resource(), &memory_resource);
+    EXPECT_EQ(command.values.get_allocator().resource(), &memory_resource);
+    EXPECT_EQ(command.options.get_allocator().resource(), &memory_resource);
+    EXPECT_EQ(command.flags.get_allocator().resource(), &memory_resource);
+}
+
+TEST(TestPmrParsedCommand, IsOptionUsedReturnsTrue)
+{
+    pmr::ParsedCommand command {};
+
+    command.options.emplace("-option_name", "option_value");
+
+    EXPECT_TRUE(command.IsOptionUsed("-option_name"));
+}
+
+TEST(TestPmrParsedCommand, IsOptionUsedReturnsFalse)
+{
+    pmr::ParsedCommand command {};
+
+    command.options.emplace("-option_name", "option_value");
+
+    EXPECT_FALSE(command.IsOptionUsed("-some_option_name"));
+}
+
+TEST(TestPmrParsedCommand, ComparsonOperatorIgnoresMemoryResource)
+{
+    std::pmr::monotonic_buffer_resource memory_resource {};
+    pmr::ParsedCommand parsed_command_1(&memory_resource);
+    pmr::ParsedCommand parsed_command_2 {};
+
+    parsed_command_1.name = "command";
+    parsed_command_1.values.emplace_back("value_1");
+    parsed_command_1.flags.emplace("--flag_name", true);
+    parsed_command_2.name = "command";
+    parsed_command_2.values.emplace_back("value_1");
+    parsed_command_2.flags.emplace("--flag_name", true);
+
+    EXPECT_TRUE(parsed_command_1 == parsed_command_2);
 }
\ No newline at end of file
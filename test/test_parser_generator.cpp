@@ -0,0 +1,45 @@
+#include <gtest/gtest.h>
+
+#include "comlint/interface_schema.hpp"
+#include "comlint/parser_generator.hpp"
+
+using namespace comlint;
+
+TEST(TestParserGenerator, GetIdentifierReplacesInvalidCharacters)
+{
+    EXPECT_EQ(ParserGenerator::GetIdentifier("example_schema"), "example_schema");
+    EXPECT_EQ(ParserGenerator::GetIdentifier("my-tool.v2"), "my_tool_v2");
+    EXPECT_EQ(ParserGenerator::GetIdentifier("2fa"), "_2fa");
+}
+
+TEST(TestParserGenerator, GetStringLiteralEscapesTextAndSplitsLines)
+{
+    EXPECT_EQ(ParserGenerator::GetStringLiteral("say \"hi\"\\"), "\"say \\\"hi\\\"\\\\\"");
+    EXPECT_EQ(ParserGenerator::GetStringLiteral("a\nb"), "\"a\\n\"\n    \"b\"");
+}
+
+TEST(TestParserGenerator, GetParserHeaderDeclaresTablesAndLookups)
+{
+    const InterfaceSchema schema = InterfaceSchema::Parse("[program]\n"
+                                                          "name = git\n"
+                                                          "[command:commit]\n"
+                                                          "allowed_options = -m\n"
+                                                          "allowed_flags = --amend\n"
+                                                          "required_options = -m\n"
+                                                          "[command:commit-all]\n"
+                                                          "num_of_values = 1\n"
+                                                          "[option:-m]\n"
+                                                          "environment_variable = GIT_MESSAGE\n"
+                                                          "[flag:--amend]\n");
+
+    const std::string header = ParserGenerator::GetParserHeader(schema, "git_schema", "git_schema.ini");
+
+    EXPECT_NE(header.find("#include \"git_schema_help.hpp\""), std::string::npos);
+    EXPECT_NE(header.find("namespace git_schema"), std::string::npos);
+    EXPECT_NE(header.find("enum class Command : std::uint32_t"), std::string::npos);
+    EXPECT_NE(header.find("kCommit,"), std::string::npos);
+    EXPECT_NE(header.find("kCommitAll,"), std::string::npos);
+    EXPECT_NE(header.find("\"GIT_MESSAGE\""), std::string::npos);
+    EXPECT_NE(header.find("static std::uint32_t FindCommand(const std::string_view name)"), std::string::npos);
+    EXPECT_NE(header.find("using Parser = GeneratedParser<Interface>;"), std::string::npos);
+}
\ No newline at end of file
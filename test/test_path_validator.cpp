@@ -0,0 +1,95 @@
+#include <filesystem>
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+#include "comlint/path_validator.hpp"
+#include "comlint/exceptions/invalid_path.hpp"
+
+using namespace comlint;
+
+class TestPathValidator : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        std::filesystem::create_directories(directory_path_);
+        std::ofstream(file_path_) << "content";
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(directory_path_);
+    }
+
+    const std::filesystem::path directory_path_ {std::filesystem::temp_directory_path() / "comlint_test_path_validator"};
+    const std::string directory_ {directory_path_.string()};
+    const std::string file_path_ {(directory_path_ / "file.txt").string()};
+    const std::string missing_path_ {(directory_path_ / "missing.txt").string()};
+};
+
+TEST_F(TestPathValidator, MetadataDescribesFileSystemEntry)
+{
+    const PathMetadata file_metadata = PathValidator::GetMetadata(file_path_, true);
+    const PathMetadata directory_metadata = PathValidator::GetMetadata(directory_, false);
+    const PathMetadata missing_metadata = PathValidator::GetMetadata(missing_path_, true);
+
+    EXPECT_EQ(file_metadata.type, PathType::kFile);
+    EXPECT_EQ(file_metadata.size, 7U);
+    EXPECT_TRUE(file_metadata.is_readable);
+    EXPECT_GT(file_metadata.modification_time, 0);
+    EXPECT_EQ(directory_metadata.type, PathType::kDirectory);
+    EXPECT_FALSE(directory_metadata.is_readable);
+    EXPECT_EQ(missing_metadata.type, PathType::kNotFound);
+    EXPECT_FALSE(missing_metadata.is_readable);
+}
+
+TEST_F(TestPathValidator, ValidPathsAreReturnedOnceAndSorted)
+{
+    const PathRequirement readable_file = PathRequirement::kFile | PathRequirement::kReadable;
+    const PathChecks path_checks {{file_path_, readable_file, "-input", true},
+                                  {directory_, PathRequirement::kDirectory, "-output", true},
+                                  {file_path_, PathRequirement::kExists, "open", false}};
+
+    const CheckedPaths checked_paths = PathValidator::Validate(path_checks);
+
+    ASSERT_EQ(checked_paths.size(), 2U);
+    EXPECT_EQ(checked_paths[0].first, directory_);
+    EXPECT_EQ(checked_paths[0].second.type, PathType::kDirectory);
+    EXPECT_EQ(checked_paths[1].first, file_path_);
+    EXPECT_EQ(checked_paths[1].second.type, PathType::kFile);
+    EXPECT_TRUE(checked_paths[1].second.is_readable);
+}
+
+TEST_F(TestPathValidator, AllViolationsAreReportedTogether)
+{
+    const PathChecks path_checks {{missing_path_, PathRequirement::kExists, "-input", true},
+                                  {directory_, PathRequirement::kFile, "open", false},
+                                  {file_path_, PathRequirement::kDirectory, "-output", true}};
+
+    try {
+        PathValidator::Validate(path_checks);
+        FAIL() << "InvalidPath has not been thrown";
+    } catch (const InvalidPath &exception) {
+        const std::string expected_message = "InvalidPath: Invalid paths given!\n"
+                                             "Path " + missing_path_ + " given for -input option does not exist.\n"
+                                             "Path " + directory_ + " given for open command is not a file.\n"
+                                             "Path " + file_path_ + " given for -output option is not a directory.";
+
+        EXPECT_EQ(std::string(exception.what()), expected_message);
+    }
+}
+
+TEST_F(TestPathValidator, PathWithoutRequirementIsNotChecked)
+{
+    const PathChecks path_checks {{missing_path_, PathRequirement::kNone, "-input", true}};
+
+    EXPECT_NO_THROW(PathValidator::Validate(path_checks));
+}
+
+TEST(TestPathRequirement, DescriptionListsRequirements)
+{
+    EXPECT_EQ(PathValidator::GetDescription(PathRequirement::kExists), "existing path");
+    EXPECT_EQ(PathValidator::GetDescription(PathRequirement::kFile | PathRequirement::kReadable), "existing readable file");
+    EXPECT_EQ(PathValidator::GetDescription(PathRequirement::kDirectory), "existing directory");
+}
\ No newline at end of file
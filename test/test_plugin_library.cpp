@@ -0,0 +1,38 @@
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+#include "comlint/plugin_library.hpp"
+#include "comlint/exceptions/invalid_command_handler.hpp"
+
+using namespace comlint;
+
+TEST(TestPluginLibrary, HandlerIsCreatedFromPlugin)
+{
+    const CommandHandlerFactory factory = PluginLibrary::GetHandlerFactory(COMLINT_TEST_PLUGIN_PATH, "create_printing_handler");
+    std::ostringstream stream {};
+
+    {
+        OutputSink output(stream);
+        const CommandHandlerPtr command_handler = factory();
+
+        ASSERT_TRUE(command_handler);
+        command_handler->Run(ParsedCommand("commit", {}, {}, {}), output);
+    }
+
+    EXPECT_EQ(stream.str(), "Running commit from plugin\n");
+}
+
+TEST(TestPluginLibrary, MissingLibraryIsReportedWhenFactoryIsCalled)
+{
+    const CommandHandlerFactory factory = PluginLibrary::GetHandlerFactory("non_existing_plugin.so", "create_printing_handler");
+
+    EXPECT_THROW(factory(), InvalidCommandHandler);
+}
+
+TEST(TestPluginLibrary, MissingSymbolIsReported)
+{
+    const CommandHandlerFactory factory = PluginLibrary::GetHandlerFactory(COMLINT_TEST_PLUGIN_PATH, "create_missing_handler");
+
+    EXPECT_THROW(factory(), InvalidCommandHandler);
+}
\ No newline at end of file
@@ -0,0 +1,311 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <ctime>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "allocation_counter.hpp"
+#include "comlint/command_line_interface.hpp"
+#include "comlint/exceptions/unsupported_command.hpp"
+#include "comlint/exceptions/unsupported_command_value.hpp"
+#include "comlint/interface_helper.hpp"
+#include "comlint/interface_schema.hpp"
+#include "comlint/utils.hpp"
+#include "synthetic_interface.hpp"
+
+using namespace comlint;
+
+namespace {
+
+// sizes are 16 times apart, so a linear operation gets 16 times more expensive and a quadratic one 256 times
+constexpr std::size_t kSmallSize {128U};
+constexpr std::size_t kLargeSize {2048U};
+constexpr unsigned int kNumOfBatches {7U};
+constexpr double kMinBatchTime {0.002};
+
+using Operation = std::function<void()>;
+
+/**
+ * @brief Processor time depends on the load of the machine, so it's checked only when COMLINT_TEST_TIMING environment variable is set,
+ *        which the separate ComlintCppTimingTests test (labelled "timing") does.
+ */
+bool IsTimeChecked()
+{
+    return std::getenv("COMLINT_TEST_TIMING") != nullptr;
+}
+
+double GetProcessorTime()
+{
+    return static_cast<double>(std::clock()) / CLOCKS_PER_SEC;
+}
+
+std::size_t GetAllocatedBytes(const Operation &operation)
+{
+    AllocationCounter allocation_counter {};
+
+    operation();
+    allocation_counter.Stop();
+
+    return allocation_counter.GetNumOfAllocatedBytes();
+}
+
+/**
+ * @brief Returns number of calls of the operation taking at least kMinBatchTime.
+ */
+std::size_t GetBatchSize(const Operation &operation)
+{
+    std::size_t num_of_calls = 1U;
+
+    while (true) {
+        const double begin = GetProcessorTime();
+
+        for (std::size_t i = 0U; i < num_of_calls; i++) {
+            operation();
+        }
+
+        if (GetProcessorTime() - begin >= kMinBatchTime) {
+            return num_of_calls;
+        }
+
+        num_of_calls *= 2U;
+    }
+}
+
+double GetCallTime(const Operation &operation, const std::size_t num_of_calls)
+{
+    const double begin = GetProcessorTime();
+
+    for (std::size_t i = 0U; i < num_of_calls; i++) {
+        operation();
+    }
+
+    return (GetProcessorTime() - begin) / static_cast<double>(num_of_calls);
+}
+
+/**
+ * @brief Growth of the cost between the small and the large size expressed as exponent of the size (1 for linear, 2 for quadratic).
+ */
+double GetExponent(const double small_cost, const double large_cost)
+{
+    return std::log(large_cost / small_cost) / std::log(static_cast<double>(kLargeSize) / kSmallSize);
+}
+
+/**
+ * @brief Measures the operation created for both sizes and checks that its cost doesn't grow faster than allowed. Allocated bytes are
+ *        deterministic, so their limit may be tight. Time (if it's checked, see IsTimeChecked()) is processor time of the fastest of
+ *        several batches of calls, with batches of both sizes interleaved, so that load of the machine affects both of them alike.
+ */
+void ExpectGrowth(const std::function<Operation(const std::size_t)> &create_operation, const double max_time_exponent,
+                  const double max_bytes_exponent)
+{
+    const Operation small_operation = create_operation(kSmallSize);
+    const Operation large_operation = create_operation(kLargeSize);
+    const double small_bytes = static_cast<double>(std::max<std::size_t>(GetAllocatedBytes(small_operation), 1U));
+    const double large_bytes = static_cast<double>(std::max<std::size_t>(GetAllocatedBytes(large_operation), 1U));
+
+    EXPECT_LE(GetExponent(small_bytes, large_bytes), max_bytes_exponent) << "Allocated bytes grow from " << small_bytes << " to "
+                                                                         << large_bytes;
+
+    if (!IsTimeChecked()) {
+        return;
+    }
+
+    const std::size_t small_batch_size = GetBatchSize(small_operation);
+    const std::size_t large_batch_size = GetBatchSize(large_operation);
+    double small_time = std::numeric_limits<double>::max();
+    double large_time = std::numeric_limits<double>::max();
+
+    for (unsigned int batch = 0U; batch < kNumOfBatches; batch++) {
+        small_time = std::min(small_time, GetCallTime(small_operation, small_batch_size));
+        large_time = std::min(large_time, GetCallTime(large_operation, large_batch_size));
+    }
+
+    EXPECT_LE(GetExponent(small_time, large_time), max_time_exponent) << "Time grows from " << small_time << " s to " << large_time << " s";
+}
+
+SyntheticInterfaceSettings GetSettings(const std::size_t size)
+{
+    SyntheticInterfaceSettings settings {};
+
+    settings.num_of_commands = size;
+    settings.num_of_options = size;
+    settings.num_of_flags = size;
+
+    return settings;
+}
+
+/**
+ * @brief Compiled synthetic interface kept alive by the measured operation.
+ */
+struct SyntheticParser
+{
+    explicit SyntheticParser(const SyntheticInterfaceSettings &settings)
+    : synthetic_interface{settings},
+      compiled_interface{Compile(synthetic_interface)}
+    {}
+
+    static CompiledInterface Compile(const SyntheticInterface &synthetic_interface)
+    {
+        CommandLineInterface cli(0, nullptr, "synthetic");
+
+        synthetic_interface.AddTo(cli);
+
+        return cli.Compile();
+    }
+
+    SyntheticInterface synthetic_interface;
+    CompiledInterface compiled_interface;
+};
+
+} // namespace
+
+// linear operations are allowed some slack for caches and logarithmic lookups (n log n between the sizes gives exponent of about 1.15),
+// time is given more of it than allocated bytes, but still far less than quadratic operations need
+constexpr double kLinearTime {1.6};
+constexpr double kLinearBytes {1.25};
+
+TEST(TestScaling, ParsingIsLinearInNumberOfValues)
+{
+    ExpectGrowth([](const std::size_t size) {
+        SyntheticInterfaceSettings settings {};
+
+        settings.num_of_values = static_cast<unsigned int>(size);
+
+        auto parser = std::make_shared<SyntheticParser>(settings);
+        auto command_line = std::make_shared<SyntheticCommandLine>("synthetic", parser->synthetic_interface.GetInvocation(0U));
+
+        return [parser, command_line]() { parser->compiled_interface.Parse(command_line->GetArgc(), command_line->GetArgv()); };
+    }, kLinearTime, kLinearBytes);
+}
+
+TEST(TestScaling, ParsingIsLinearInNumberOfOptionsAndFlags)
+{
+    ExpectGrowth([](const std::size_t size) {
+        SyntheticInterfaceSettings settings {};
+
+        settings.num_of_commands = 1U;
+        settings.num_of_options = size;
+        settings.num_of_flags = size;
+        settings.num_of_allowed_options = size;
+        settings.num_of_allowed_flags = size;
+
+        auto parser = std::make_shared<SyntheticParser>(settings);
+        auto command_line = std::make_shared<SyntheticCommandLine>("synthetic", parser->synthetic_interface.GetInvocation(0U));
+
+        return [parser, command_line]() { parser->compiled_interface.Parse(command_line->GetArgc(), command_line->GetArgv()); };
+    }, kLinearTime, kLinearBytes);
+}
+
+TEST(TestScaling, ParsingIsLinearInInterfaceSize)
+{
+    // parsed command contains all the flags of the interface, so parsing can't be cheaper than linear in their number
+    ExpectGrowth([](const std::size_t size) {
+        auto parser = std::make_shared<SyntheticParser>(GetSettings(size));
+        auto command_line = std::make_shared<SyntheticCommandLine>("synthetic", parser->synthetic_interface.GetInvocation(0U));
+
+        return [parser, command_line]() { parser->compiled_interface.Parse(command_line->GetArgc(), command_line->GetArgv()); };
+    }, kLinearTime, kLinearBytes);
+}
+
+TEST(TestScaling, RegistrationIsLinearInInterfaceSize)
+{
+    ExpectGrowth([](const std::size_t size) {
+        auto synthetic_interface = std::make_shared<SyntheticInterface>(GetSettings(size));
+
+        return [synthetic_interface]() { SyntheticParser::Compile(*synthetic_interface); };
+    }, kLinearTime, kLinearBytes);
+}
+
+TEST(TestScaling, SchemaParsingIsLinearInInterfaceSize)
+{
+    ExpectGrowth([](const std::size_t size) {
+        auto schema = std::make_shared<std::string>(SyntheticInterface(GetSettings(size)).GetSchema());
+
+        return [schema]() { InterfaceSchema::Parse(*schema); };
+    }, kLinearTime, kLinearBytes);
+}
+
+TEST(TestScaling, HelpGenerationIsLinearInInterfaceSize)
+{
+    ExpectGrowth([](const std::size_t size) {
+        auto schema = std::make_shared<InterfaceSchema>(InterfaceSchema::Parse(SyntheticInterface(GetSettings(size)).GetSchema()));
+
+        return [schema]() {
+            InterfaceHelper::GetHelp(schema->program_name, schema->description, schema->commands, schema->options, schema->flags);
+            InterfaceHelper::GetManPage(schema->program_name, schema->description, schema->commands, schema->options, schema->flags);
+            InterfaceHelper::GetMarkdown(schema->program_name, schema->description, schema->commands, schema->options, schema->flags);
+        };
+    }, kLinearTime, kLinearBytes);
+}
+
+TEST(TestScaling, HelpGenerationIsLinearInSizeOfAllowedLists)
+{
+    ExpectGrowth([](const std::size_t size) {
+        SyntheticInterfaceSettings settings {};
+
+        // a single option, as allowed values of all the options together would grow quadratically
+        settings.num_of_commands = 1U;
+        settings.num_of_options = 1U;
+        settings.num_of_flags = size;
+        settings.num_of_allowed_values = size;
+        settings.num_of_allowed_flags = size;
+
+        auto schema = std::make_shared<InterfaceSchema>(InterfaceSchema::Parse(SyntheticInterface(settings).GetSchema()));
+
+        return [schema]() {
+            InterfaceHelper::GetManPage(schema->program_name, schema->description, schema->commands, schema->options, schema->flags);
+            InterfaceHelper::GetMarkdown(schema->program_name, schema->description, schema->commands, schema->options, schema->flags);
+        };
+    }, kLinearTime, kLinearBytes);
+}
+
+TEST(TestScaling, HintForUnsupportedCommandIsLinearInNumberOfCommands)
+{
+    ExpectGrowth([](const std::size_t size) {
+        auto parser = std::make_shared<SyntheticParser>(GetSettings(size));
+        // prefix of an existing command is similar to it
+        const std::string misspelled_command = parser->synthetic_interface.GetCommands().front().name.substr(0U, 3U);
+        auto command_line = std::make_shared<SyntheticCommandLine>("synthetic", std::vector<std::string>{misspelled_command});
+
+        return [parser, command_line]() {
+            EXPECT_THROW(parser->compiled_interface.Parse(command_line->GetArgc(), command_line->GetArgv()), UnsupportedCommand);
+        };
+    }, kLinearTime, kLinearBytes);
+}
+
+TEST(TestScaling, HintForNotAllowedValueIsLinearInNumberOfAllowedValues)
+{
+    ExpectGrowth([](const std::size_t size) {
+        SyntheticInterfaceSettings settings {};
+
+        settings.num_of_commands = 1U;
+        settings.num_of_allowed_values = size;
+
+        auto parser = std::make_shared<SyntheticParser>(settings);
+        std::vector<std::string> arguments = parser->synthetic_interface.GetInvocation(0U);
+
+        arguments.at(1U).append("_misspelled");
+
+        auto command_line = std::make_shared<SyntheticCommandLine>("synthetic", arguments);
+
+        return [parser, command_line]() {
+            EXPECT_THROW(parser->compiled_interface.Parse(command_line->GetArgc(), command_line->GetArgv()), UnsupportedCommandValue);
+        };
+    }, kLinearTime, kLinearBytes);
+}
+
+TEST(TestScaling, VectorToStringIsLinearInNumberOfElements)
+{
+    ExpectGrowth([](const std::size_t size) {
+        auto vector = std::make_shared<std::vector<std::string>>(size, "element");
+
+        return [vector]() { utils::VectorToString(*vector, ", "); };
+    }, kLinearTime, kLinearBytes);
+}
\ No newline at end of file
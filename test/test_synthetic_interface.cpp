@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+
+#include "comlint/interface_schema.hpp"
+#include "synthetic_interface.hpp"
+
+using namespace comlint;
+
+TEST(TestSyntheticInterface, InterfaceHasRequestedShape)
+{
+    SyntheticInterfaceSettings settings {};
+
+    settings.num_of_commands = 10U;
+    settings.num_of_options = 3U;
+    settings.num_of_flags = 5U;
+    settings.num_of_allowed_values = 2U;
+    settings.num_of_allowed_options = 4U;
+    settings.num_of_allowed_flags = 1U;
+    settings.min_name_length = 2U;
+    settings.max_name_length = 3U;
+
+    const SyntheticInterface synthetic_interface(settings);
+
+    ASSERT_EQ(synthetic_interface.GetCommands().size(), 10U);
+    ASSERT_EQ(synthetic_interface.GetOptions().size(), 3U);
+    ASSERT_EQ(synthetic_interface.GetFlags().size(), 5U);
+
+    for (const SyntheticInterface::Command &command : synthetic_interface.GetCommands()) {
+        EXPECT_GE(command.name.size(), 2U);
+        EXPECT_LE(command.name.size(), 3U);
+        EXPECT_EQ(command.allowed_values.size(), 2U);
+        EXPECT_EQ(command.allowed_options.size(), 3U);
+        EXPECT_EQ(command.allowed_flags.size(), 1U);
+    }
+    for (const SyntheticInterface::Option &option : synthetic_interface.GetOptions()) {
+        EXPECT_EQ(option.name.front(), '-');
+        EXPECT_EQ(option.allowed_values.size(), 2U);
+    }
+    for (const std::string &flag : synthetic_interface.GetFlags()) {
+        EXPECT_EQ(flag.substr(0U, 2U), "--");
+    }
+}
+
+TEST(TestSyntheticInterface, SameSeedGivesSameInterface)
+{
+    SyntheticInterfaceSettings settings {};
+
+    settings.seed = 7U;
+
+    const SyntheticInterface interface(settings);
+    const SyntheticInterface same_interface(settings);
+
+    settings.seed = 8U;
+
+    const SyntheticInterface other_interface(settings);
+
+    EXPECT_EQ(interface.GetSchema(), same_interface.GetSchema());
+    EXPECT_NE(interface.GetSchema(), other_interface.GetSchema());
+}
+
+TEST(TestSyntheticInterface, SchemaDeclaresWholeInterface)
+{
+    SyntheticInterfaceSettings settings {};
+
+    settings.num_of_allowed_values = 3U;
+
+    const SyntheticInterface synthetic_interface(settings);
+    const InterfaceSchema schema = InterfaceSchema::Parse(synthetic_interface.GetSchema());
+
+    EXPECT_EQ(schema.commands.size(), settings.num_of_commands);
+    EXPECT_EQ(schema.options.size(), settings.num_of_options);
+    EXPECT_EQ(schema.flags.size(), settings.num_of_flags);
+}
+
+TEST(TestSyntheticInterface, InvocationIsParsedByInterface)
+{
+    SyntheticInterfaceSettings settings {};
+
+    settings.num_of_values = 2U;
+    settings.num_of_allowed_values = 2U;
+
+    const SyntheticInterface synthetic_interface(settings);
+    const std::vector<std::string> arguments = synthetic_interface.GetInvocation(3U);
+    SyntheticCommandLine command_line("synthetic", arguments);
+
+    CommandLineInterface cli(command_line.GetArgc(), command_line.GetArgv(), "synthetic");
+
+    synthetic_interface.AddTo(cli);
+
+    const ParsedCommand parsed_command = cli.Parse();
+
+    EXPECT_EQ(parsed_command.name, arguments.front());
+    EXPECT_EQ(parsed_command.values.size(), 2U);
+    EXPECT_EQ(parsed_command.options.size(), settings.num_of_allowed_options);
+    EXPECT_EQ(parsed_command.flags.size(), settings.num_of_flags);
+}
\ No newline at end of file
@@ -0,0 +1,85 @@
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "comlint/thread_pool.hpp"
+
+using namespace comlint;
+
+TEST(TestThreadPool, EveryTaskIsExecutedExactlyOnce)
+{
+    ThreadPool thread_pool(4U);
+    std::vector<std::atomic<unsigned int>> executions(1000U);
+
+    thread_pool.ParallelFor(executions.size(), [&executions](const std::size_t i) { executions[i]++; });
+
+    for (const auto &execution : executions) {
+        EXPECT_EQ(execution.load(), 1U);
+    }
+}
+
+TEST(TestThreadPool, EmptyBatchFinishesImmediately)
+{
+    ThreadPool thread_pool(2U);
+    bool is_called = false;
+
+    thread_pool.ParallelFor(0U, [&is_called](const std::size_t) { is_called = true; });
+
+    EXPECT_FALSE(is_called);
+}
+
+TEST(TestThreadPool, PoolWithoutWorkersRunsTasksInCallingThread)
+{
+    ThreadPool thread_pool(0U);
+    const std::thread::id caller_id = std::this_thread::get_id();
+    unsigned int num_of_tasks = 0U;
+
+    thread_pool.ParallelFor(10U, [&caller_id, &num_of_tasks](const std::size_t) {
+        EXPECT_EQ(std::this_thread::get_id(), caller_id);
+        num_of_tasks++;
+    });
+
+    EXPECT_EQ(thread_pool.GetNumOfThreads(), 0U);
+    EXPECT_EQ(num_of_tasks, 10U);
+}
+
+TEST(TestThreadPool, ExceptionThrownByTaskIsRethrownAfterAllTasksFinish)
+{
+    ThreadPool thread_pool(3U);
+    std::atomic<unsigned int> num_of_tasks {0U};
+
+    EXPECT_THROW(thread_pool.ParallelFor(100U, [&num_of_tasks](const std::size_t i) {
+        num_of_tasks++;
+        if (i == 50U) {
+            throw std::runtime_error("task failed");
+        }
+    }), std::runtime_error);
+    EXPECT_EQ(num_of_tasks.load(), 100U);
+}
+
+TEST(TestThreadPool, BatchesMayBeSubmittedConcurrently)
+{
+    ThreadPool thread_pool(2U);
+    std::atomic<unsigned int> num_of_tasks {0U};
+    std::vector<std::thread> threads {};
+
+    for (unsigned int i = 0U; i < 8U; ++i) {
+        threads.emplace_back([&thread_pool, &num_of_tasks]() {
+            thread_pool.ParallelFor(100U, [&num_of_tasks](const std::size_t) { num_of_tasks++; });
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(num_of_tasks.load(), 800U);
+}
+
+TEST(TestThreadPool, SharedPoolIsCreatedOnce)
+{
+    EXPECT_EQ(&ThreadPool::GetShared(), &ThreadPool::GetShared());
+    EXPECT_GT(ThreadPool::GetShared().GetNumOfThreads(), 0U);
+}
\ No newline at end of file
@@ -0,0 +1,88 @@
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "comlint/tracer.hpp"
+
+using namespace comlint;
+
+class TestTracer : public ::testing::Test
+{
+protected:
+    void TearDown() override
+    {
+        Tracer::Stop();
+        std::filesystem::remove(trace_path_);
+    }
+
+    std::string ReadTrace() const
+    {
+        std::ifstream trace_file(trace_path_);
+        std::stringstream trace {};
+
+        trace << trace_file.rdbuf();
+
+        return trace.str();
+    }
+
+    const std::string trace_path_ {(std::filesystem::temp_directory_path() / "comlint_test_tracer.json").string()};
+};
+
+TEST_F(TestTracer, SpansAreWrittenAsCompleteEvents)
+{
+    Tracer::Start(trace_path_);
+
+    {
+        const TraceSpan outer_span("outer \"span\"");
+        const TraceSpan inner_span("inner", "custom");
+    }
+    std::thread([]() { const TraceSpan thread_span("other thread"); }).join();
+
+    Tracer::Stop();
+    const std::string trace = ReadTrace();
+
+    EXPECT_EQ(trace.rfind("{\"traceEvents\":[", 0U), 0U);
+    EXPECT_NE(trace.find("{\"name\":\"inner\",\"cat\":\"custom\",\"ph\":\"X\",\"ts\":"), std::string::npos);
+    EXPECT_NE(trace.find("{\"name\":\"outer \\\"span\\\"\",\"cat\":\"user\",\"ph\":\"X\""), std::string::npos);
+    EXPECT_NE(trace.find("\"name\":\"other thread\""), std::string::npos);
+    EXPECT_NE(trace.find("\"tid\":"), std::string::npos);
+    EXPECT_FALSE(Tracer::IsEnabled());
+}
+
+TEST_F(TestTracer, NothingIsRecordedWhenDisabled)
+{
+    {
+        const TraceSpan span("ignored");
+    }
+    Tracer::Start(trace_path_);
+    Tracer::Stop();
+
+    EXPECT_EQ(ReadTrace().find("ignored"), std::string::npos);
+}
+
+TEST_F(TestTracer, ConsecutiveCallsOfSameKindAreJoinedInBatch)
+{
+    Tracer::Start(trace_path_);
+
+    {
+        TraceBatch batch {};
+
+        for (unsigned int i = 0U; i < 3U; ++i) {
+            const TraceBatchScope scope(batch, "AddOption");
+        }
+        {
+            const TraceBatchScope scope(batch, "AddFlag");
+        }
+    }
+
+    Tracer::Stop();
+    const std::string trace = ReadTrace();
+    const std::size_t add_option = trace.find("\"name\":\"AddOption\"");
+
+    EXPECT_NE(add_option, std::string::npos);
+    EXPECT_EQ(trace.find("\"name\":\"AddOption\"", add_option + 1U), std::string::npos);
+    EXPECT_NE(trace.find("\"name\":\"AddFlag\""), std::string::npos);
+}
\ No newline at end of file
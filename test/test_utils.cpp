@@ -37,6 +37,17 @@ TEST(TestUtils, VectorToStringReturnsProperValueWhenDelimiterProvided)
     EXPECT_EQ(output, expected_outptut);
 }
 
+TEST(TestUtils, VectorToStringSkipsDelimiterAfterLeadingEmptyElements)
+{
+    const std::vector<std::string> vector {"", "", "one", "", "two"};
+    const std::string expected_outptut {"[one, , two]"};
+    const std::string delimiter {", "};
+
+    const std::string output = utils::VectorToString(vector, delimiter, "[", "]");
+
+    EXPECT_EQ(output, expected_outptut);
+}
+
 TEST(TestUtils, VectorToStringReturnsProperValueWhenOpeningStringProvided)
 {
     const std::vector<std::string> vector {"one", "two", "three"};
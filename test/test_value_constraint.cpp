@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+
+#include "comlint/value_constraint.hpp"
+#include "comlint/exceptions/invalid_value_constraint.hpp"
+
+using namespace comlint;
+
+TEST(TestValueConstraint, RangeAcceptsIntegersWithinBounds)
+{
+    const ValueConstraint constraint = ValueConstraint::Range(1, 65535);
+
+    EXPECT_TRUE(constraint.IsSatisfied("1"));
+    EXPECT_TRUE(constraint.IsSatisfied("8080"));
+    EXPECT_TRUE(constraint.IsSatisfied("65535"));
+    EXPECT_EQ(constraint.GetDescription(), "integer in range [1, 65535]");
+}
+
+TEST(TestValueConstraint, RangeRejectsOtherValues)
+{
+    const ValueConstraint constraint = ValueConstraint::Range(-10, 10);
+
+    EXPECT_TRUE(constraint.IsSatisfied("-10"));
+    EXPECT_FALSE(constraint.IsSatisfied("-11"));
+    EXPECT_FALSE(constraint.IsSatisfied("11"));
+    EXPECT_FALSE(constraint.IsSatisfied(""));
+    EXPECT_FALSE(constraint.IsSatisfied("5a"));
+    EXPECT_FALSE(constraint.IsSatisfied(" 5"));
+    EXPECT_FALSE(constraint.IsSatisfied("99999999999999999999999"));
+}
+
+TEST(TestValueConstraint, RangeWithMinimumGreaterThanMaximumThrows)
+{
+    EXPECT_THROW(ValueConstraint::Range(10, 1), InvalidValueConstraint);
+}
+
+TEST(TestValueConstraint, PatternMatchesWholeValue)
+{
+    const ValueConstraint constraint = ValueConstraint::Pattern("[a-z][a-z0-9_]*");
+
+    EXPECT_TRUE(constraint.IsSatisfied("a"));
+    EXPECT_TRUE(constraint.IsSatisfied("user_name42"));
+    EXPECT_FALSE(constraint.IsSatisfied(""));
+    EXPECT_FALSE(constraint.IsSatisfied("42user"));
+    EXPECT_FALSE(constraint.IsSatisfied("user-name"));
+    EXPECT_EQ(constraint.GetDescription(), "value matching [a-z][a-z0-9_]*");
+}
+
+TEST(TestValueConstraint, PatternSupportsGroupsAlternationsAndBounds)
+{
+    const ValueConstraint version = ValueConstraint::Pattern("v?\\d{1,3}(\\.\\d{1,3}){2}(-(alpha|beta|rc)\\d*)?");
+
+    EXPECT_TRUE(version.IsSatisfied("1.2.3"));
+    EXPECT_TRUE(version.IsSatisfied("v10.20.300"));
+    EXPECT_TRUE(version.IsSatisfied("1.0.0-rc2"));
+    EXPECT_TRUE(version.IsSatisfied("1.0.0-beta"));
+    EXPECT_FALSE(version.IsSatisfied("1.2"));
+    EXPECT_FALSE(version.IsSatisfied("1.2.3.4"));
+    EXPECT_FALSE(version.IsSatisfied("1234.2.3"));
+    EXPECT_FALSE(version.IsSatisfied("1.2.3-gamma"));
+}
+
+TEST(TestValueConstraint, PatternSupportsNegatedClassesAndEscapes)
+{
+    const ValueConstraint constraint = ValueConstraint::Pattern("[^/\\s]+\\.(cpp|hpp)|\\S*\\*");
+
+    EXPECT_TRUE(constraint.IsSatisfied("main.cpp"));
+    EXPECT_TRUE(constraint.IsSatisfied("a.b.hpp"));
+    EXPECT_TRUE(constraint.IsSatisfied("src*"));
+    EXPECT_FALSE(constraint.IsSatisfied("src/main.cpp"));
+    EXPECT_FALSE(constraint.IsSatisfied("my file.cpp"));
+    EXPECT_FALSE(constraint.IsSatisfied("main.c"));
+}
+
+TEST(TestValueConstraint, PatternWithNestedRepetitionsDoesNotBacktrack)
+{
+    const ValueConstraint constraint = ValueConstraint::Pattern("(a*)*b");
+
+    EXPECT_FALSE(constraint.IsSatisfied(std::string(10000U, 'a')));
+    EXPECT_TRUE(constraint.IsSatisfied(std::string(10000U, 'a') + "b"));
+}
+
+TEST(TestValueConstraint, InvalidPatternsThrow)
+{
+    EXPECT_THROW(ValueConstraint::Pattern("(abc"), InvalidValueConstraint);
+    EXPECT_THROW(ValueConstraint::Pattern("abc)"), InvalidValueConstraint);
+    EXPECT_THROW(ValueConstraint::Pattern("[abc"), InvalidValueConstraint);
+    EXPECT_THROW(ValueConstraint::Pattern("[z-a]"), InvalidValueConstraint);
+    EXPECT_THROW(ValueConstraint::Pattern("*a"), InvalidValueConstraint);
+    EXPECT_THROW(ValueConstraint::Pattern("a{3,1}"), InvalidValueConstraint);
+    EXPECT_THROW(ValueConstraint::Pattern("a{1000}"), InvalidValueConstraint);
+    EXPECT_THROW(ValueConstraint::Pattern("abc\\"), InvalidValueConstraint);
+}
+
+TEST(TestValueConstraint, PatternRejectsAnchorsButAcceptsEscapedOnes)
+{
+    EXPECT_THROW(ValueConstraint::Pattern("^abc"), InvalidValueConstraint);
+    EXPECT_THROW(ValueConstraint::Pattern("abc$"), InvalidValueConstraint);
+    EXPECT_THROW(ValueConstraint::Pattern("(a|^b)"), InvalidValueConstraint);
+
+    const ValueConstraint escaped = ValueConstraint::Pattern("\\^[$^]\\$");
+
+    EXPECT_TRUE(escaped.IsSatisfied("^$$"));
+    EXPECT_TRUE(escaped.IsSatisfied("^^$"));
+    EXPECT_FALSE(escaped.IsSatisfied("^a$"));
+}
\ No newline at end of file
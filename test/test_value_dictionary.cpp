@@ -0,0 +1,111 @@
+#include <filesystem>
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+#include "comlint/value_dictionary.hpp"
+#include "comlint/exceptions/invalid_value_dictionary.hpp"
+
+using namespace comlint;
+
+class TestValueDictionary : public ::testing::Test
+{
+protected:
+    std::string CreateFile(const std::string &content)
+    {
+        std::ofstream file(path_, std::ios::binary);
+
+        file << content;
+
+        return path_.string();
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove(path_);
+    }
+
+private:
+    const std::filesystem::path path_ {std::filesystem::temp_directory_path() / "comlint_test_value_dictionary.txt"};
+};
+
+TEST_F(TestValueDictionary, ConstructorThrowsForNotExistingFile)
+{
+    EXPECT_THROW(ValueDictionary("/not/existing/dictionary.txt"), InvalidValueDictionary);
+}
+
+TEST_F(TestValueDictionary, ContainsFindsEveryListedValue)
+{
+    const ValueDictionary dictionary(CreateFile("alpha\nbeta\ndelta\ngamma\nomega\n"));
+
+    EXPECT_TRUE(dictionary.Contains("alpha"));
+    EXPECT_TRUE(dictionary.Contains("beta"));
+    EXPECT_TRUE(dictionary.Contains("delta"));
+    EXPECT_TRUE(dictionary.Contains("gamma"));
+    EXPECT_TRUE(dictionary.Contains("omega"));
+}
+
+TEST_F(TestValueDictionary, ContainsRejectsValuesNotListed)
+{
+    const ValueDictionary dictionary(CreateFile("alpha\nbeta\ndelta\ngamma\nomega"));
+
+    EXPECT_FALSE(dictionary.Contains(""));
+    EXPECT_FALSE(dictionary.Contains("aaa"));
+    EXPECT_FALSE(dictionary.Contains("alph"));
+    EXPECT_FALSE(dictionary.Contains("alphabet"));
+    EXPECT_FALSE(dictionary.Contains("epsilon"));
+    EXPECT_FALSE(dictionary.Contains("zeta"));
+}
+
+TEST_F(TestValueDictionary, WindowsLineEndingsAndEmptyLinesAreIgnored)
+{
+    const ValueDictionary dictionary(CreateFile("\r\nalpha\r\n\r\nbeta\r\ngamma\r\n\n"));
+
+    EXPECT_TRUE(dictionary.Contains("alpha"));
+    EXPECT_TRUE(dictionary.Contains("beta"));
+    EXPECT_TRUE(dictionary.Contains("gamma"));
+    EXPECT_EQ(dictionary.GetSize(), 3U);
+}
+
+TEST_F(TestValueDictionary, EmptyLinesInTheMiddleDoNotBreakSearch)
+{
+    const ValueDictionary dictionary(CreateFile("a\n\nc\n\n\n\ne\nf\n\n\n"));
+
+    EXPECT_TRUE(dictionary.Contains("a"));
+    EXPECT_TRUE(dictionary.Contains("c"));
+    EXPECT_TRUE(dictionary.Contains("e"));
+    EXPECT_TRUE(dictionary.Contains("f"));
+    EXPECT_FALSE(dictionary.Contains("b"));
+    EXPECT_FALSE(dictionary.Contains("d"));
+    EXPECT_FALSE(dictionary.Contains("g"));
+    EXPECT_EQ(dictionary.GetSize(), 4U);
+}
+
+TEST_F(TestValueDictionary, LargeDictionaryIsSearchedCorrectly)
+{
+    std::string content {};
+
+    for (unsigned int i = 0U; i < 100000U; i += 2U) {
+        content.append("tenant_").append(std::to_string(1000000U + i)).append("\n");
+    }
+
+    const ValueDictionary dictionary(CreateFile(content));
+
+    EXPECT_EQ(dictionary.GetSize(), 50000U);
+    EXPECT_TRUE(dictionary.Contains("tenant_1000000"));
+    EXPECT_TRUE(dictionary.Contains("tenant_1054320"));
+    EXPECT_TRUE(dictionary.Contains("tenant_1099998"));
+    EXPECT_FALSE(dictionary.Contains("tenant_1054321"));
+    EXPECT_FALSE(dictionary.Contains("tenant_1100000"));
+}
+
+TEST_F(TestValueDictionary, GetNeighboursReturnsValuesAroundGivenOne)
+{
+    const ValueDictionary dictionary(CreateFile("a\nb\nc\nd\ne\nf\n"));
+
+    const auto neighbours = dictionary.GetNeighbours("cc", 4U);
+    const auto first_neighbours = dictionary.GetNeighbours("0", 3U);
+
+    EXPECT_EQ(neighbours, (std::pmr::vector<std::string_view>{"b", "c", "d", "e"}));
+    EXPECT_EQ(first_neighbours, (std::pmr::vector<std::string_view>{"a", "b", "c"}));
+}
\ No newline at end of file
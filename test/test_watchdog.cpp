@@ -0,0 +1,61 @@
+#include <chrono>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "comlint/watchdog.hpp"
+
+using namespace comlint;
+
+TEST(TestWatchdog, TokenIsCancelledWhenDeadlinePasses)
+{
+    Watchdog watchdog {};
+    CancellationToken cancellation_token {};
+
+    watchdog.Watch(cancellation_token, Watchdog::Clock::now() + std::chrono::milliseconds(10));
+
+    for (unsigned int i = 0U; i < 1000U && !cancellation_token.IsCancelled(); i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    EXPECT_TRUE(cancellation_token.IsCancelled());
+}
+
+TEST(TestWatchdog, UnwatchedTokenIsNotCancelled)
+{
+    Watchdog watchdog {};
+    CancellationToken cancellation_token {};
+    const Watchdog::WatchId watch_id = watchdog.Watch(cancellation_token, Watchdog::Clock::now() + std::chrono::milliseconds(20));
+
+    watchdog.Unwatch(watch_id);
+    std::this_thread::sleep_for(std::chrono::milliseconds(40));
+
+    EXPECT_FALSE(cancellation_token.IsCancelled());
+}
+
+TEST(TestWatchdog, EarlierDeadlineAddedLaterIsEnforcedFirst)
+{
+    Watchdog watchdog {};
+    CancellationToken late_token {};
+    CancellationToken early_token {};
+
+    const Watchdog::WatchId late_watch_id = watchdog.Watch(late_token, Watchdog::Clock::now() + std::chrono::hours(1));
+    watchdog.Watch(early_token, Watchdog::Clock::now() + std::chrono::milliseconds(10));
+
+    for (unsigned int i = 0U; i < 1000U && !early_token.IsCancelled(); i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    EXPECT_TRUE(early_token.IsCancelled());
+    EXPECT_FALSE(late_token.IsCancelled());
+    watchdog.Unwatch(late_watch_id);
+}
+
+TEST(TestWatchdog, CancelledTokenThrowsCommandCancelled)
+{
+    CancellationToken cancellation_token {};
+
+    EXPECT_NO_THROW(cancellation_token.ThrowIfCancelled());
+    cancellation_token.Cancel();
+    EXPECT_THROW(cancellation_token.ThrowIfCancelled(), CommandCancelled);
+}
\ No newline at end of file
@@ -0,0 +1,93 @@
+/**
+ * Build-time generator of help prompt, man page, Markdown documentation and specialized parser from an interface schema (see
+ * comlint/interface_schema.hpp).
+ * It is executed by comlint_generate_help CMake function. Usage:
+ *                  comlint_help_generator [schema_file] [output_directory] [name]
+ * Generated files:
+ *   - [name]_help.hpp - header defining comlint::generated::[name]::kHelp, which may be passed to CommandLineInterface::SetHelp
+ *   - [name].1 - man page
+ *   - [name].md - Markdown documentation
+ *   - [name]_parser.hpp - header defining comlint::generated::[name]::Parser (see comlint/generated_parser.hpp)
+ */
+
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#include "comlint/interface_schema.hpp"
+#include "comlint/mapped_file.hpp"
+#include "comlint/parser_generator.hpp"
+
+namespace {
+
+const int kNumOfArguments {4};
+
+void WriteFile(const std::filesystem::path &path, const std::string_view content)
+{
+    std::ofstream file(path, std::ios::binary);
+
+    file.write(content.data(), static_cast<std::streamsize>(content.size()));
+
+    if (!file) {
+        throw std::runtime_error("Unable to write " + path.string());
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc != kNumOfArguments) {
+        std::cerr << "Usage: " << argv[0] << " [schema_file] [output_directory] [name]" << std::endl;
+        return 1;
+    }
+
+    try {
+        const comlint::MappedFile schema_file {std::string(argv[1])};
+        const std::filesystem::path output_directory(argv[2]);
+        const std::string name(argv[3]);
+        const std::string schema_file_name = std::filesystem::path(argv[1]).filename().string();
+
+        if (!schema_file.IsMapped()) {
+            throw std::runtime_error("Unable to read schema file " + std::string(argv[1]));
+        }
+
+        const comlint::InterfaceSchema schema = comlint::InterfaceSchema::Parse(schema_file.GetContent());
+        const std::string help = comlint::InterfaceHelper::GetHelp(schema.program_name, schema.description, schema.commands, schema.options,
+                                                                   schema.flags);
+        std::stringstream header {};
+
+        header << "// Generated by comlint_help_generator from " << schema_file_name << ". Do not edit." << std::endl;
+        header << std::endl;
+        header << "#pragma once" << std::endl;
+        header << std::endl;
+        header << "#include <string_view>" << std::endl;
+        header << std::endl;
+        header << "namespace comlint {" << std::endl;
+        header << "namespace generated {" << std::endl;
+        header << "namespace " << comlint::ParserGenerator::GetIdentifier(name) << " {" << std::endl;
+        header << std::endl;
+        header << "inline constexpr std::string_view kHelp {" << std::endl;
+        header << "    " << comlint::ParserGenerator::GetStringLiteral(help) << std::endl;
+        header << "};" << std::endl;
+        header << std::endl;
+        header << "} // " << comlint::ParserGenerator::GetIdentifier(name) << std::endl;
+        header << "} // generated" << std::endl;
+        header << "} // comlint" << std::endl;
+
+        std::filesystem::create_directories(output_directory);
+        WriteFile(output_directory / (name + "_help.hpp"), header.str());
+        WriteFile(output_directory / (name + ".1"), comlint::InterfaceHelper::GetManPage(schema.program_name, schema.description, schema.commands,
+                                                                                        schema.options, schema.flags));
+        WriteFile(output_directory / (name + "_parser.hpp"), comlint::ParserGenerator::GetParserHeader(schema, name, schema_file_name));
+        WriteFile(output_directory / (name + ".md"), comlint::InterfaceHelper::GetMarkdown(schema.program_name, schema.description, schema.commands,
+                                                                                          schema.options, schema.flags));
+    }
+    catch (const std::exception &exception) {
+        std::cerr << exception.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,288 @@
+/**
+ * Replays invocations recorded by CommandLineInterface::EnableRecording (or COMLINT_RECORD environment variable) against an interface
+ * schema (see comlint/interface_schema.hpp) and reports throughput, latency percentiles and invocations whose result differs from the
+ * recorded one. Usage:
+ *                  comlint_invocation_replayer [schema_file] [log_file] [mode] [num_of_repetitions]
+ * Modes:
+ *   - parse (default) - every invocation is parsed by the interface compiled once, as by CompiledInterface::Parse
+ *   - run - every invocation is run as the program runs it: the interface is declared, compiled and parsed, then the command is
+ *           dispatched to a handler which does nothing
+ * Options are still read from the environment of the replayer, so invocations depending on environment variables may differ.
+ * Invocations of programs using features which the schema can't describe (constraints, dictionaries, path requirements, glob expansion,
+ * configuration files, abbreviations, refusing to run without arguments) can't be reproduced, so they are counted as recorded with
+ * another interface and not compared.
+ * Exit code is 0 if all the results match, 2 if some differ and 1 on error.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "comlint/command_line_interface.hpp"
+#include "comlint/interface_schema.hpp"
+#include "comlint/invocation_log.hpp"
+#include "comlint/mapped_file.hpp"
+
+namespace {
+
+const int kMinNumOfArguments {3};
+const int kMaxNumOfArguments {5};
+const std::size_t kMaxNumOfReportedDifferences {10U};
+const double kPercentiles[] {0.5, 0.9, 0.99, 1.0};
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * @brief Command line of a recorded invocation, with the program name of the schema in front.
+ */
+class CommandLine
+{
+public:
+    CommandLine(const std::string &program_name, const std::vector<std::string> &arguments)
+    : arguments_{}
+    {
+        arguments_.push_back(program_name);
+        arguments_.insert(arguments_.end(), arguments.begin(), arguments.end());
+
+        for (std::string &argument : arguments_) {
+            argv_.push_back(argument.data());
+        }
+    }
+
+    int GetArgc() const { return static_cast<int>(argv_.size()); }
+    char** GetArgv() { return argv_.data(); }
+
+private:
+    std::vector<std::string> arguments_;
+    std::vector<char*> argv_;
+};
+
+struct ReplayResult
+{
+    comlint::InvocationOutcome outcome;
+    std::string result;
+};
+
+std::vector<std::string> ToVector(const std::pmr::vector<std::pmr::string> &strings)
+{
+    return std::vector<std::string>(strings.begin(), strings.end());
+}
+
+void DeclareInterface(comlint::CommandLineInterface &cli, const comlint::InterfaceSchema &schema)
+{
+    for (const auto &[command_name, command] : schema.commands) {
+        cli.AddCommand(std::string(command_name), std::string(command.description), command.num_of_required_values,
+                       ToVector(command.allowed_values), ToVector(command.allowed_options), ToVector(command.allowed_flags),
+                       ToVector(command.required_options));
+    }
+    for (const auto &[option_name, option] : schema.options) {
+        cli.AddOption(std::string(option_name), std::string(option.description), ToVector(option.allowed_values),
+                      std::string(option.environment_variable), std::string(option.default_value));
+    }
+    for (const auto &[flag_name, flag] : schema.flags) {
+        cli.AddFlag(std::string(flag_name), std::string(flag.description));
+    }
+}
+
+ReplayResult Parse(const comlint::CompiledInterface &compiled_interface, CommandLine &command_line)
+{
+    std::ostringstream help_stream {};
+
+    try {
+        comlint::OutputSink output(help_stream);
+        const comlint::ParsedCommand parsed_command = compiled_interface.Parse(command_line.GetArgc(), command_line.GetArgv(), output);
+
+        if (parsed_command.name == "help") {
+            return {comlint::InvocationOutcome::kHelp, {}};
+        }
+
+        return {comlint::InvocationOutcome::kParsed, comlint::InvocationLog::GetResult(parsed_command)};
+    }
+    catch (const std::exception &exception) {
+        return {comlint::InvocationOutcome::kFailed, exception.what()};
+    }
+}
+
+ReplayResult Run(const comlint::InterfaceSchema &schema, CommandLine &command_line)
+{
+    std::ostringstream help_stream {};
+    std::optional<std::string> result {};
+
+    try {
+        comlint::CommandLineInterface cli(command_line.GetArgc(), command_line.GetArgv(), std::string(schema.program_name),
+                                          std::string(schema.description));
+
+        // replayed invocations must not be recorded again
+        cli.EnableRecording("");
+        DeclareInterface(cli, schema);
+
+        for (const auto &[command_name, command] : schema.commands) {
+            cli.AddCommandHandler(std::string(command_name), [&result](const comlint::ParsedCommand &parsed_command) {
+                result = comlint::InvocationLog::GetResult(parsed_command);
+            });
+        }
+
+        comlint::OutputSink output(help_stream);
+
+        cli.Run(output);
+    }
+    catch (const std::exception &exception) {
+        return {comlint::InvocationOutcome::kFailed, exception.what()};
+    }
+
+    // handler is not run only when the help is requested
+    return result ? ReplayResult{comlint::InvocationOutcome::kParsed, *result} : ReplayResult{comlint::InvocationOutcome::kHelp, {}};
+}
+
+std::string GetOutcomeName(const comlint::InvocationOutcome outcome)
+{
+    switch (outcome) {
+        case comlint::InvocationOutcome::kParsed:
+            return "parsed";
+        case comlint::InvocationOutcome::kHelp:
+            return "help";
+        default:
+            return "failed";
+    }
+}
+
+std::string JoinArguments(const std::vector<std::string> &arguments)
+{
+    std::string joined_arguments {};
+
+    for (const std::string &argument : arguments) {
+        joined_arguments.append(joined_arguments.empty() ? "" : " ").append(argument);
+    }
+
+    return joined_arguments;
+}
+
+double ToMicroseconds(const Clock::duration time)
+{
+    return std::chrono::duration<double, std::micro>(time).count();
+}
+
+// nearest-rank percentile of the sorted latencies
+Clock::duration GetPercentile(const std::vector<Clock::duration> &latencies, const double percentile)
+{
+    const auto rank = static_cast<std::size_t>(percentile * static_cast<double>(latencies.size()) + 0.999999);
+
+    return latencies[std::clamp<std::size_t>(rank, 1U, latencies.size()) - 1U];
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc < kMinNumOfArguments || argc > kMaxNumOfArguments) {
+        std::cerr << "Usage: " << argv[0] << " [schema_file] [log_file] [parse|run] [num_of_repetitions]" << std::endl;
+        return 1;
+    }
+
+    try {
+        const comlint::MappedFile schema_file {std::string(argv[1])};
+        const comlint::MappedFile log_file {std::string(argv[2])};
+        const std::string mode = argc > 3 ? argv[3] : "parse";
+        const unsigned long num_of_repetitions = argc > 4 ? std::stoul(argv[4]) : 1UL;
+
+        if (!schema_file.IsMapped()) {
+            throw std::runtime_error("Unable to read schema file " + std::string(argv[1]));
+        }
+        if (!log_file.IsMapped()) {
+            throw std::runtime_error("Unable to read invocation log " + std::string(argv[2]));
+        }
+        if (mode != "parse" && mode != "run") {
+            throw std::runtime_error("Unknown mode " + mode + ", expected parse or run");
+        }
+        if (num_of_repetitions == 0UL) {
+            throw std::runtime_error("Number of repetitions must be positive");
+        }
+
+        const comlint::InterfaceSchema schema = comlint::InterfaceSchema::Parse(schema_file.GetContent());
+        // interface is declared with the defaults of CommandLineInterface for everything the schema doesn't describe
+        const std::uint64_t schema_hash = comlint::InvocationLog::GetSchemaHash(schema.commands, schema.options, schema.flags, true, false, "");
+        const std::vector<comlint::InvocationRecord> records = comlint::InvocationLog::Read(log_file.GetContent());
+        std::vector<CommandLine> command_lines {};
+
+        if (records.empty()) {
+            throw std::runtime_error("Invocation log " + std::string(argv[2]) + " contains no invocations");
+        }
+
+        for (const comlint::InvocationRecord &record : records) {
+            command_lines.emplace_back(std::string(schema.program_name), record.arguments);
+        }
+
+        comlint::CommandLineInterface cli(0, nullptr, std::string(schema.program_name), std::string(schema.description));
+
+        cli.EnableRecording("");
+        DeclareInterface(cli, schema);
+
+        const comlint::CompiledInterface compiled_interface = cli.Compile();
+        std::vector<Clock::duration> latencies {};
+        std::vector<Clock::duration> recorded_latencies {};
+        std::size_t num_of_schema_mismatches = 0U;
+        std::size_t num_of_differences = 0U;
+
+        latencies.reserve(records.size() * num_of_repetitions);
+
+        const Clock::time_point replay_start_time = Clock::now();
+
+        for (unsigned long repetition = 0UL; repetition < num_of_repetitions; repetition++) {
+            for (std::size_t i = 0U; i < records.size(); i++) {
+                const Clock::time_point start_time = Clock::now();
+                const ReplayResult result = mode == "run" ? Run(schema, command_lines[i]) : Parse(compiled_interface, command_lines[i]);
+
+                latencies.push_back(Clock::now() - start_time);
+
+                // results are compared only once, invocations recorded with another interface are expected to differ
+                if (repetition > 0UL) {
+                    continue;
+                }
+
+                const comlint::InvocationRecord &record = records[i];
+
+                recorded_latencies.push_back(std::chrono::duration_cast<Clock::duration>(record.parse_time + record.run_time));
+
+                if (record.schema_hash != schema_hash) {
+                    num_of_schema_mismatches++;
+                    continue;
+                }
+                if (result.outcome == record.outcome && result.result == record.result) {
+                    continue;
+                }
+                if (++num_of_differences <= kMaxNumOfReportedDifferences) {
+                    std::cout << "Difference in invocation " << i << ": " << JoinArguments(record.arguments) << std::endl
+                              << "  recorded: " << GetOutcomeName(record.outcome) << " " << record.result << std::endl
+                              << "  replayed: " << GetOutcomeName(result.outcome) << " " << result.result << std::endl;
+                }
+            }
+        }
+
+        const Clock::duration replay_time = Clock::now() - replay_start_time;
+
+        std::sort(latencies.begin(), latencies.end());
+        std::sort(recorded_latencies.begin(), recorded_latencies.end());
+
+        std::cout << "Replayed " << records.size() << " invocations " << num_of_repetitions << " times (" << mode << ")" << std::endl;
+        std::cout << "Throughput: " << static_cast<double>(latencies.size()) / std::chrono::duration<double>(replay_time).count()
+                  << " invocations/s" << std::endl;
+
+        for (const double percentile : kPercentiles) {
+            std::cout << "p" << percentile * 100.0 << ": " << ToMicroseconds(GetPercentile(latencies, percentile)) << " us (recorded "
+                      << ToMicroseconds(GetPercentile(recorded_latencies, percentile)) << " us)" << std::endl;
+        }
+
+        std::cout << "Recorded with another interface: " << num_of_schema_mismatches << std::endl;
+        std::cout << "Differences: " << num_of_differences << std::endl;
+
+        return num_of_differences == 0U ? 0 : 2;
+    }
+    catch (const std::exception &exception) {
+        std::cerr << exception.what() << std::endl;
+        return 1;
+    }
+}
\ No newline at end of file